@@ -5,10 +5,20 @@
 #include "global_settings.h"
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
+#include <strings.h>
 
 int GLOBAL_SETTINGS_cancel_requested;
+int GLOBAL_SETTINGS_reload_requested;
 int GLOBAL_SETTING_read_timeout;
+int GLOBAL_SETTING_cleartext;
+size_t GLOBAL_SETTING_http1_max_requests;
+int GLOBAL_SETTING_http1_keep_alive_timeout;
+size_t GLOBAL_SETTING_http1_chunk_size;
+size_t GLOBAL_SETTING_request_body_max;
+size_t GLOBAL_SETTING_h2_window_size;
+size_t GLOBAL_SETTING_h2_max_concurrent_streams;
 
 int GLOBAL_SETTINGS_log_h2_recv_goaway;
 int GLOBAL_SETTINGS_log_tls_errors;
@@ -34,11 +44,37 @@ static void globset_set(char **dest, const char *value, char *initial) {
 
 void GLOBAL_SETTINGS_load(config_t config) {
 	GLOBAL_SETTINGS_cancel_requested = 0;
+	GLOBAL_SETTINGS_reload_requested = 0;
 	GLOBAL_SETTING_read_timeout = 200;
 
 	GLOBAL_SETTINGS_log_h2_recv_goaway = config_get_bool(config, "log-h2-receive-goaway", 0);
 	GLOBAL_SETTINGS_log_tls_errors = config_get_bool(config, "log-tls-errors", 0);
 
+	const char *transport = config_get(config, "transport");
+	GLOBAL_SETTING_cleartext = transport && !strcasecmp(transport, "cleartext");
+	if (transport && !GLOBAL_SETTING_cleartext && strcasecmp(transport, "tls"))
+		printf("[Config] Invalid transport: '%s', using TLS\n", transport);
+
+	GLOBAL_SETTING_http1_max_requests = config_get_size(config, "http1-max-requests", 100);
+	GLOBAL_SETTING_http1_keep_alive_timeout = config_get_size(config, "http1-keep-alive-timeout", 5000);
+	GLOBAL_SETTING_http1_chunk_size = config_get_size(config, "http1-chunk-size", GLOBAL_SETTING_http1_chunk_size_initial);
+	if (GLOBAL_SETTING_http1_chunk_size == 0 || GLOBAL_SETTING_http1_chunk_size > GLOBAL_SETTING_http1_chunk_size_max) {
+		printf("[Config] Invalid http1-chunk-size: %zu, using %u\n", GLOBAL_SETTING_http1_chunk_size, GLOBAL_SETTING_http1_chunk_size_initial);
+		GLOBAL_SETTING_http1_chunk_size = GLOBAL_SETTING_http1_chunk_size_initial;
+	}
+
+	GLOBAL_SETTING_request_body_max = config_get_size(config, "request-body-max", GLOBAL_SETTING_request_body_max_initial);
+	GLOBAL_SETTING_h2_window_size = config_get_size(config, "h2-window-size", GLOBAL_SETTING_h2_window_size_initial);
+	if (GLOBAL_SETTING_h2_window_size < GLOBAL_SETTING_h2_window_size_min || GLOBAL_SETTING_h2_window_size > GLOBAL_SETTING_h2_window_size_max) {
+		printf("[Config] Invalid h2-window-size: %zu, using %u\n", GLOBAL_SETTING_h2_window_size, GLOBAL_SETTING_h2_window_size_initial);
+		GLOBAL_SETTING_h2_window_size = GLOBAL_SETTING_h2_window_size_initial;
+	}
+	GLOBAL_SETTING_h2_max_concurrent_streams = config_get_size(config, "h2-max-concurrent-streams", GLOBAL_SETTING_h2_max_concurrent_streams_initial);
+	if (GLOBAL_SETTING_h2_max_concurrent_streams == 0 || GLOBAL_SETTING_h2_max_concurrent_streams > GLOBAL_SETTING_h2_max_concurrent_streams_max) {
+		printf("[Config] Invalid h2-max-concurrent-streams: %zu, using %u\n", GLOBAL_SETTING_h2_max_concurrent_streams, GLOBAL_SETTING_h2_max_concurrent_streams_initial);
+		GLOBAL_SETTING_h2_max_concurrent_streams = GLOBAL_SETTING_h2_max_concurrent_streams_initial;
+	}
+
 	globset_set(&GLOBAL_SETTING_host, config_get(config, "hostname"), NULL);
 	globset_set(&GLOBAL_SETTING_origin, config_get(config, "origin"), NULL);
 	globset_set(&GLOBAL_SETTING_HEADER_sts, config_get(config, "strict-transport-security"), NULL);
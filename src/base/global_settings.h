@@ -23,9 +23,54 @@ void GLOBAL_SETTINGS_destroy();
   * This isn't really a setting as much as it is a global variable. */
 extern int GLOBAL_SETTINGS_cancel_requested;
 
+/** Set by the SIGHUP handler, the main thread will reload the certificates. */
+extern int GLOBAL_SETTINGS_reload_requested;
+
 /** The 'log-received-goaway' option in the config file. */
 extern int GLOBAL_SETTINGS_log_h2_recv_goaway;
 
+/** (boolean) The 'transport' option in the config file is "cleartext": TLS is
+  * terminated by a load balancer in front of the server. */
+extern int GLOBAL_SETTING_cleartext;
+
+/** HTTP/1.1 persistent connections: the 'http1-max-requests' option (the
+  * amount of requests served on one connection, 0 disables keep-alive) and the
+  * 'http1-keep-alive-timeout' option (in milliseconds) in the config file. */
+extern size_t GLOBAL_SETTING_http1_max_requests;
+extern int GLOBAL_SETTING_http1_keep_alive_timeout;
+
+/** The 'http1-chunk-size' option: the maximum amount of body bytes that are
+  * coalesced into one chunk of a 'Transfer-Encoding: chunked' response. The
+  * default makes a chunk, with its size line and CRLF, fill one 16 KiB TLS
+  * record. */
+#define GLOBAL_SETTING_http1_chunk_size_initial 16376
+#define GLOBAL_SETTING_http1_chunk_size_max 1048576
+extern size_t GLOBAL_SETTING_http1_chunk_size;
+
+/** The 'request-body-max' option: the maximum size of a request body in bytes.
+  * A larger Content-Length gets '413 Payload Too Large', a body without one
+  * fails to read when it gets larger. */
+#define GLOBAL_SETTING_request_body_max_initial 8388608
+extern size_t GLOBAL_SETTING_request_body_max;
+
+/** The 'h2-window-size' option: the HTTP/2 flow control window of a request
+  * body. The client can send this many bytes ahead of the handler, the window
+  * is updated as the handler reads. It can't be smaller than the initial
+  * window of RFC 7540, since the client may use that until it has received
+  * the settings. */
+#define GLOBAL_SETTING_h2_window_size_initial 1048576
+#define GLOBAL_SETTING_h2_window_size_min 65535
+#define GLOBAL_SETTING_h2_window_size_max 2147483647
+extern size_t GLOBAL_SETTING_h2_window_size;
+
+/** The 'h2-max-concurrent-streams' option: the amount of requests that are
+  * handled at the same time on an HTTP/2 connection, it is advertised as
+  * SETTINGS_MAX_CONCURRENT_STREAMS. Every request is handled by a thread of
+  * its own. */
+#define GLOBAL_SETTING_h2_max_concurrent_streams_initial 100
+#define GLOBAL_SETTING_h2_max_concurrent_streams_max 1024
+extern size_t GLOBAL_SETTING_h2_max_concurrent_streams;
+
 /** The 'log-tls-errors' option in the config file. */
 extern int GLOBAL_SETTINGS_log_tls_errors;
 
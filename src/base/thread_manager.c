@@ -17,6 +17,8 @@
 
 static unsigned max_threads;
 static unsigned thread_count;
+/* the threads that are counted with thread_manager_reserve */
+static unsigned reserved_count;
 static unsigned threads_size; /* the size of */
 static pthread_t *threads = NULL;
 static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -38,6 +40,7 @@ int thread_manager_setup(config_t config) {
 	}
 
 	thread_count = 0;
+	reserved_count = 0;
 	threads_size = umin(max_threads, THREADS_STEP_SIZE);
 	threads = calloc(threads_size, sizeof(pthread_t));
 
@@ -80,15 +83,22 @@ void thread_manager_wait_or_kill(void) {
 */
 int thread_manager_add(void *(*start_routine) (void *), void *arguments) {
 	pthread_mutex_lock(&mutex);
+	if (thread_count + reserved_count >= max_threads) {
+		pthread_mutex_unlock(&mutex);
+		puts("ThreadManager: thread pool full.");
+		return 0;
+	}
 	if (thread_count == threads_size) {
 		if (threads_size != max_threads) {
-			pthread_t *new_threads = realloc(threads, umin(threads_size + THREADS_STEP_SIZE, max_threads));
+			unsigned new_size = umin(threads_size + THREADS_STEP_SIZE, max_threads);
+			pthread_t *new_threads = realloc(threads, new_size * sizeof(pthread_t));
 			if (new_threads == NULL) {
 				pthread_mutex_unlock(&mutex);
 				puts("ThreadManager: allocation error.");
 				return -1;
 			}
-			threads = threads;
+			threads = new_threads;
+			threads_size = new_size;
 		} else {
 			pthread_mutex_unlock(&mutex);
 			puts("ThreadManager: thread pool full.");
@@ -96,7 +106,15 @@ int thread_manager_add(void *(*start_routine) (void *), void *arguments) {
 		}
 	}
 
-	if (pthread_create(&threads[thread_count], NULL, start_routine, arguments) != 0) {
+	/* the thread inherits the signal mask, SIGHUP (reload) is left to the
+	 * accept loop so it doesn't interrupt the poll() of a connection */
+	sigset_t reload, old;
+	sigemptyset(&reload);
+	sigaddset(&reload, SIGHUP);
+	pthread_sigmask(SIG_BLOCK, &reload, &old);
+	int result = pthread_create(&threads[thread_count], NULL, start_routine, arguments);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	if (result != 0) {
 		pthread_mutex_unlock(&mutex);
 		puts("ThreadManager: pthread_create error.");
 		return -2;
@@ -107,8 +125,25 @@ int thread_manager_add(void *(*start_routine) (void *), void *arguments) {
 	return 1;
 }
 
+int thread_manager_reserve(void) {
+	pthread_mutex_lock(&mutex);
+	int success = thread_count + reserved_count < max_threads;
+	if (success)
+		reserved_count += 1;
+	pthread_mutex_unlock(&mutex);
+	return success;
+}
+
+void thread_manager_release(void) {
+	pthread_mutex_lock(&mutex);
+	reserved_count -= 1;
+	pthread_mutex_unlock(&mutex);
+}
+
 void thread_manager_finished(void) {
 	pthread_t current = pthread_self();
+	/* nobody joins the client threads, so they release their resources themselves */
+	pthread_detach(current);
 	pthread_mutex_lock(&mutex);
 	size_t i;
 	for (i = 0; i < thread_count; i++) {
@@ -116,7 +151,7 @@ void thread_manager_finished(void) {
 			if (i == thread_count - 1) {
 				threads[i] = 0;
 			} else {
-				memcpy(threads+i, threads+i+1, thread_count - i - 1);
+				memmove(threads+i, threads+i+1, (thread_count - i - 1) * sizeof(pthread_t));
 			}
 			thread_count -= 1;
 			pthread_mutex_unlock(&mutex);
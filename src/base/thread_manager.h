@@ -44,6 +44,22 @@ void thread_manager_wait_or_kill(void);
  */
 int thread_manager_add(void *(*start_routine) (void *), void *);
 
+/**
+ * Description:
+ *   Counts a thread that is created and joined elsewhere (e.g. the worker of
+ *   an HTTP/2 stream) against the maximum of the thread manager.
+ *
+ * Return Value:
+ *   (boolean) Success Status, 0 if the thread pool is full.
+ */
+int thread_manager_reserve(void);
+
+/**
+ * Description:
+ *   Releases a thread counted by thread_manager_reserve, once it has exited.
+ */
+void thread_manager_release(void);
+
 /**
  * Description:
  *   Signals the thread manager that this thread has been finished. 
@@ -12,11 +12,12 @@
 #include <fcntl.h>
 #include <netinet/tcp.h>
 
+#include "base/global_settings.h"
 #include "base/thread_manager.h"
 #include "handling/handlers.h"
 #include "http/http1.h"
 #include "http2/core.h"
-#include "secure/tlsutil.h"
+#include "transport/transport.h"
 
 void client_start_actual(void *data) {
 	int client = *((int *) data);
@@ -39,38 +40,26 @@ void client_start_actual(void *data) {
 		return;
 	}
 
-	TLS tls = tls_setup_client(client);
+	transport_t *transport = GLOBAL_SETTING_cleartext ? transport_create_cleartext(client) : transport_create_tls(client);
 
-	if (tls) {
-		TLS_AP ap = tls_get_ap(tls);
-		switch (ap) {
-			case TLS_AP_HTTP11: {
-				http_header_list_t *request = http1_parse(tls);
-				if (request) {
-					http_response_t *response = http_handle_request(request, NULL);
-					http1_write_response(tls, response);
-
-					if (response->is_dynamic) {
-						free(response->body);
-						http_response_headers_destroy(response->headers);
-						free(response);
-					}
-					http_destroy_header_list(request);
-				}
-			} break;
-			case TLS_AP_HTTP2:
-				http2_handle(tls);
+	if (transport) {
+		switch (transport_get_protocol(transport)) {
+			case TRANSPORT_PROTOCOL_HTTP1:
+				http1_handle(transport);
+				break;
+			case TRANSPORT_PROTOCOL_HTTP2:
+				http2_handle(transport);
 				break;
 			default:
-				fputs("Invalid AP!\n", stderr);
-				goto clean;
+				if (GLOBAL_SETTINGS_log_tls_errors)
+					printf("[%s] Failed to determine the protocol.\n", transport->ops->name);
+				break;
 		}
 
-		tls_destroy_client(tls);
+		transport_destroy(transport);
 	} else {
-		puts("failed to setup TLS.");
+		puts("failed to setup the transport.");
 	}
-	clean:
 	close(client);
 }
 
@@ -15,6 +15,9 @@ typedef struct config_t {
 	size_t count;
 	char **keys;
 	char **values;
+	/* (nullable) for every key in keys.txt: the index of its first value + 1,
+	 * or 0 if it isn't in the file */
+	size_t *known;
 } config_t;
 
 /** Things implemented by reader.c: **/
@@ -29,6 +32,8 @@ const char *config_get(config_t config, const char *key);
 /* Gets the value in the config, but returns 'default' if the key doesn't exists. */
 const char *config_get_default(config_t config, const char *key, const char *def);
 int config_get_bool(config_t config, const char *key, int def);
+/* Gets the value in the config as an unsigned number, but returns 'default' if the key doesn't exists or isn't a number. */
+size_t config_get_size(config_t config, const char *key, size_t def);
 
 /** Things implemented by validator.c: **/
 int config_validate(config_t config);
@@ -0,0 +1,138 @@
+/**
+ * Generated by tools/perfect-hash.c from src/configuration/keys.txt, don't edit.
+ * 39 words in 128 slots, seed 281.
+ */
+#include "key_table.h"
+
+#include <string.h>
+
+#include "utils/perfect_hash.h"
+
+const char *const config_key_words[CONFIG_KEY_COUNT] = {
+	"compression",
+	"h2-max-concurrent-streams",
+	"h2-window-size",
+	"handlers",
+	"header-tk",
+	"headers-strict",
+	"hostname",
+	"hostname-strict",
+	"http1-chunk-size",
+	"http1-keep-alive-timeout",
+	"http1-max-requests",
+	"log-h2-receive-goaway",
+	"log-request",
+	"log-tls-errors",
+	"max-child-threads",
+	"mime-types",
+	"ocsp",
+	"ocsp-file",
+	"origin",
+	"port",
+	"request-body-max",
+	"send-modified",
+	"server-name",
+	"strict-transport-security",
+	"tls-cert",
+	"tls-certificate",
+	"tls-certificate-compression",
+	"tls-chain",
+	"tls-cipher-list",
+	"tls-cipher-suites",
+	"tls-early-data",
+	"tls-early-data-window",
+	"tls-key",
+	"tls-min-version",
+	"tls-mode",
+	"tls-record-boost-threshold",
+	"tls-record-idle-timeout",
+	"tls-record-size",
+	"transport"
+};
+
+int config_key_lookup(const char *word, size_t length) {
+	if (length < 4 || length > 27)
+		return -1;
+	switch (perfect_hash(word, length, 281UL, 0) & 127UL) {
+		case 1:
+			return length == 4 && !memcmp(word, "ocsp", 4) ? 16 : -1;
+		case 4:
+			return length == 15 && !memcmp(word, "hostname-strict", 15) ? 7 : -1;
+		case 6:
+			return length == 9 && !memcmp(word, "tls-chain", 9) ? 27 : -1;
+		case 14:
+			return length == 10 && !memcmp(word, "mime-types", 10) ? 15 : -1;
+		case 17:
+			return length == 14 && !memcmp(word, "log-tls-errors", 14) ? 13 : -1;
+		case 22:
+			return length == 26 && !memcmp(word, "tls-record-boost-threshold", 26) ? 35 : -1;
+		case 23:
+			return length == 8 && !memcmp(word, "tls-cert", 8) ? 24 : -1;
+		case 24:
+			return length == 14 && !memcmp(word, "headers-strict", 14) ? 5 : -1;
+		case 27:
+			return length == 16 && !memcmp(word, "http1-chunk-size", 16) ? 8 : -1;
+		case 29:
+			return length == 21 && !memcmp(word, "tls-early-data-window", 21) ? 31 : -1;
+		case 30:
+			return length == 11 && !memcmp(word, "server-name", 11) ? 22 : -1;
+		case 41:
+			return length == 27 && !memcmp(word, "tls-certificate-compression", 27) ? 26 : -1;
+		case 42:
+			return length == 6 && !memcmp(word, "origin", 6) ? 18 : -1;
+		case 47:
+			return length == 24 && !memcmp(word, "http1-keep-alive-timeout", 24) ? 9 : -1;
+		case 51:
+			return length == 21 && !memcmp(word, "log-h2-receive-goaway", 21) ? 11 : -1;
+		case 54:
+			return length == 15 && !memcmp(word, "tls-cipher-list", 15) ? 28 : -1;
+		case 57:
+			return length == 9 && !memcmp(word, "header-tk", 9) ? 4 : -1;
+		case 58:
+			return length == 25 && !memcmp(word, "strict-transport-security", 25) ? 23 : -1;
+		case 65:
+			return length == 9 && !memcmp(word, "ocsp-file", 9) ? 17 : -1;
+		case 69:
+			return length == 18 && !memcmp(word, "http1-max-requests", 18) ? 10 : -1;
+		case 71:
+			return length == 15 && !memcmp(word, "tls-record-size", 15) ? 37 : -1;
+		case 72:
+			return length == 14 && !memcmp(word, "tls-early-data", 14) ? 30 : -1;
+		case 75:
+			return length == 11 && !memcmp(word, "compression", 11) ? 0 : -1;
+		case 78:
+			return length == 8 && !memcmp(word, "handlers", 8) ? 3 : -1;
+		case 80:
+			return length == 11 && !memcmp(word, "log-request", 11) ? 12 : -1;
+		case 85:
+			return length == 15 && !memcmp(word, "tls-min-version", 15) ? 33 : -1;
+		case 92:
+			return length == 8 && !memcmp(word, "tls-mode", 8) ? 34 : -1;
+		case 94:
+			return length == 14 && !memcmp(word, "h2-window-size", 14) ? 2 : -1;
+		case 96:
+			return length == 17 && !memcmp(word, "max-child-threads", 17) ? 14 : -1;
+		case 112:
+			return length == 4 && !memcmp(word, "port", 4) ? 19 : -1;
+		case 114:
+			return length == 23 && !memcmp(word, "tls-record-idle-timeout", 23) ? 36 : -1;
+		case 115:
+			return length == 7 && !memcmp(word, "tls-key", 7) ? 32 : -1;
+		case 116:
+			return length == 13 && !memcmp(word, "send-modified", 13) ? 21 : -1;
+		case 119:
+			return length == 25 && !memcmp(word, "h2-max-concurrent-streams", 25) ? 1 : -1;
+		case 121:
+			return length == 9 && !memcmp(word, "transport", 9) ? 38 : -1;
+		case 122:
+			return length == 16 && !memcmp(word, "request-body-max", 16) ? 20 : -1;
+		case 125:
+			return length == 8 && !memcmp(word, "hostname", 8) ? 6 : -1;
+		case 126:
+			return length == 15 && !memcmp(word, "tls-certificate", 15) ? 25 : -1;
+		case 127:
+			return length == 17 && !memcmp(word, "tls-cipher-suites", 17) ? 29 : -1;
+		default:
+			return -1;
+	}
+}
@@ -0,0 +1,71 @@
+/**
+ * Generated by tools/perfect-hash.c from src/configuration/keys.txt, don't edit.
+ */
+#ifndef CONFIG_KEY_TABLE_H
+#define CONFIG_KEY_TABLE_H
+
+#include <stddef.h>
+
+#define CONFIG_KEY_COUNT 39
+#define CONFIG_KEY_LENGTH_MAX 27
+
+/* the indices of the words */
+#define CONFIG_KEY_COMPRESSION 0
+#define CONFIG_KEY_H2_MAX_CONCURRENT_STREAMS 1
+#define CONFIG_KEY_H2_WINDOW_SIZE 2
+#define CONFIG_KEY_HANDLERS 3
+#define CONFIG_KEY_HEADER_TK 4
+#define CONFIG_KEY_HEADERS_STRICT 5
+#define CONFIG_KEY_HOSTNAME 6
+#define CONFIG_KEY_HOSTNAME_STRICT 7
+#define CONFIG_KEY_HTTP1_CHUNK_SIZE 8
+#define CONFIG_KEY_HTTP1_KEEP_ALIVE_TIMEOUT 9
+#define CONFIG_KEY_HTTP1_MAX_REQUESTS 10
+#define CONFIG_KEY_LOG_H2_RECEIVE_GOAWAY 11
+#define CONFIG_KEY_LOG_REQUEST 12
+#define CONFIG_KEY_LOG_TLS_ERRORS 13
+#define CONFIG_KEY_MAX_CHILD_THREADS 14
+#define CONFIG_KEY_MIME_TYPES 15
+#define CONFIG_KEY_OCSP 16
+#define CONFIG_KEY_OCSP_FILE 17
+#define CONFIG_KEY_ORIGIN 18
+#define CONFIG_KEY_PORT 19
+#define CONFIG_KEY_REQUEST_BODY_MAX 20
+#define CONFIG_KEY_SEND_MODIFIED 21
+#define CONFIG_KEY_SERVER_NAME 22
+#define CONFIG_KEY_STRICT_TRANSPORT_SECURITY 23
+#define CONFIG_KEY_TLS_CERT 24
+#define CONFIG_KEY_TLS_CERTIFICATE 25
+#define CONFIG_KEY_TLS_CERTIFICATE_COMPRESSION 26
+#define CONFIG_KEY_TLS_CHAIN 27
+#define CONFIG_KEY_TLS_CIPHER_LIST 28
+#define CONFIG_KEY_TLS_CIPHER_SUITES 29
+#define CONFIG_KEY_TLS_EARLY_DATA 30
+#define CONFIG_KEY_TLS_EARLY_DATA_WINDOW 31
+#define CONFIG_KEY_TLS_KEY 32
+#define CONFIG_KEY_TLS_MIN_VERSION 33
+#define CONFIG_KEY_TLS_MODE 34
+#define CONFIG_KEY_TLS_RECORD_BOOST_THRESHOLD 35
+#define CONFIG_KEY_TLS_RECORD_IDLE_TIMEOUT 36
+#define CONFIG_KEY_TLS_RECORD_SIZE 37
+#define CONFIG_KEY_TRANSPORT 38
+
+/* the words, in the order of src/configuration/keys.txt */
+extern const char *const config_key_words[CONFIG_KEY_COUNT];
+
+/**
+ * Description:
+ *   Finds the word.
+ *
+ * Parameters:
+ *   const char *
+ *     The word, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the word.
+ *
+ * Return Value:
+ *   The index of the word in config_key_words, or -1
+ */
+int config_key_lookup(const char *, size_t);
+
+#endif /* CONFIG_KEY_TABLE_H */
@@ -10,6 +10,8 @@
 #include <string.h>
 #include <strings.h>
 
+#include "key_table.h"
+
 #define CONFIG_CHUCK_SIZE		256
 #define CONFIG_INITIAL_SIZE 8
 #define CONFIG_STEP_SIZE		8
@@ -25,6 +27,7 @@ config_t config_readf(FILE *fp) {
 	config.count = 0;
 	config.keys = malloc(current_size * sizeof(const char *));
 	config.values = malloc(current_size * sizeof(const char *));
+	config.known = calloc(CONFIG_KEY_COUNT, sizeof(size_t));
 
 	if (!fp) {
 		perror("Config: failed to read configuration file.");
@@ -90,6 +93,10 @@ config_t config_readf(FILE *fp) {
 		config.keys[config.count] = key;
 		config.values[config.count] = value;
 
+		int known = config_key_lookup(key, key_size);
+		if (known >= 0 && config.known && !config.known[known])
+			config.known[known] = config.count + 1;
+
 		config.count++;
 	}
 
@@ -107,6 +114,10 @@ const char *config_get(config_t config, const char *key) {
 		return NULL;
 	}
 	
+	int known = config.known ? config_key_lookup(key, strlen(key)) : -1;
+	if (known >= 0)
+		return config.known[known] ? config.values[config.known[known] - 1] : NULL;
+
 	size_t i;
 	for (i = 0; i < config.count; i++) {
 		if (!strcmp(key, config.keys[i])) {
@@ -147,4 +158,18 @@ void config_destroy(config_t config) {
 	}
 	free(config.keys);
 	free(config.values);
+	free(config.known);
+}
+
+size_t config_get_size(config_t config, const char *key, size_t def) {
+	const char *value = config_get(config, key);
+	if (!value)
+		return def;
+	char *end;
+	unsigned long result = strtoul(value, &end, 10);
+	if (end == value || *end != 0 || *value == '-') {
+		printf("[Config] Invalid number for %s: '%s'\n", key, value);
+		return def;
+	}
+	return result;
 }
@@ -11,12 +11,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
 int config_validate(config_t config) {
 	const char *required_keys[] = { "port", "tls-mode", "hostname" };
+	const char *transport = config_get(config, "transport");
+	int cleartext = transport && !strcasecmp(transport, "cleartext");
 
 	size_t i;
 	for (i = 0; i < sizeof(required_keys) / sizeof(required_keys[0]); i++) {
+		/* the certificates aren't needed when TLS is terminated by a load balancer */
+		if (cleartext && !strcmp(required_keys[i], "tls-mode"))
+			continue;
 		if (!config_get(config, required_keys[i])) {
 			printf("Config: configuration doesn't meet the requirements! Value for key=\"%s\" doesn't exists!\n", required_keys[i]);
 			return 0;
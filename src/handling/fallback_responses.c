@@ -2,49 +2,75 @@
  * Copyright (C) 2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
  *
- * TODO: Improve code documentation.
+ * The responses that are sent when a request can't be handled, see
+ * create_fallback_response.
  */
 
 static http_response_t *response_invalid_request;
 static http_response_t *response_no_service;
+static http_response_t *response_too_early;
+static http_response_t *response_payload_too_large;
+static http_response_t *response_fs_not_found;
 
 static const char *response_body_invalid_request = "<!doctype html><html lang=\"en\"><head><title>Invalid Request</title></head><body><h1>Invalid Request</h1></body></html>";
 static const char *response_body_no_service = "<!doctype html><html lang=\"en\"><head><title>Service Unavailable</title><style>*{font-family:sans-serif}</style></head><body><h1>HTTP Error 503: Service Unavailable</h1><hr><p>If you are the administrator of this server, please see your log files and check your configuration. Explanation: no handler was configured to handle this path and no error handlers were setup.</body></html>";
+static const char *response_body_too_early = "<!doctype html><html lang=\"en\"><head><title>Too Early</title></head><body><h1>HTTP Error 425: Too Early</h1></body></html>";
+static const char *response_body_payload_too_large = "<!doctype html><html lang=\"en\"><head><title>Payload Too Large</title></head><body><h1>HTTP Error 413: Payload Too Large</h1></body></html>";
 static const char *response_body_fs_not_found = "<!doctype html><html lang=\"en\"><head><title>Not Found</title><style>*{font-family:sans-serif}</style></head><body><h1>HTTP Error 404: Not Found</h1><hr><p>If you are the administrator of this server, please see your log files and check your configuration. Explanation: no handler was configured to handle this path and no error handlers were setup.</body></html>";
 
-static void setup_responses(void) {
-	response_invalid_request = malloc(sizeof(http_response_t));
-	response_invalid_request->is_dynamic = 0;
-	response_invalid_request->headers = http_create_response_headers(5);
-	http_response_headers_add(response_invalid_request->headers, HTTP_RH_STATUS_400, NULL);
-	http_response_headers_add(response_invalid_request->headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8");
-	size_t size = strlen(response_body_invalid_request);
-	handle_write_length(response_invalid_request->headers, size);
-	http_response_headers_add(response_invalid_request->headers, HTTP_RH_SERVER, GLOBAL_SETTING_server_name);
-	if (GLOBAL_SETTING_HEADER_sts)
-		http_response_headers_add(response_invalid_request->headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, GLOBAL_SETTING_HEADER_sts);
-	response_invalid_request->body = strdup(response_body_invalid_request);
-	response_invalid_request->body_size = size;
+/* Creates a response that never changes, it is rendered once by
+ * http_prebuilt_response_create so the protocols only have to patch in the
+ * date when they send it. */
+static http_response_t *create_fallback_response(http_response_header_name status, const char *body) {
+	http_response_t *response = calloc(1, sizeof(http_response_t));
+	if (!response)
+		return NULL;
+	response->is_dynamic = 0;
+	response->body = (char *) body;
+	response->body_size = strlen(body);
+	response->body_file = -1;
+	response->headers = http_create_response_headers(8);
+	if (response->headers
+		&& http_response_headers_add(response->headers, status, NULL)
+		&& http_response_headers_add(response->headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8")
+		&& handle_write_length(response->headers, response->body_size)
+		&& header_write_server(response->headers)
+		&& (response->prebuilt = http_prebuilt_response_create(response->headers, body, response->body_size)))
+		return response;
 
-	response_no_service = malloc(sizeof(http_response_t));
-	response_no_service->is_dynamic = 0;
-	response_no_service->headers = http_create_response_headers(5);
-	http_response_headers_add(response_no_service->headers, HTTP_RH_STATUS_503, NULL);
-	http_response_headers_add(response_no_service->headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8");
-	size = strlen(response_body_no_service);
-	handle_write_length(response_no_service->headers, size);
-	http_response_headers_add(response_no_service->headers, HTTP_RH_SERVER, GLOBAL_SETTING_server_name);
-	if (GLOBAL_SETTING_HEADER_sts)
-		http_response_headers_add(response_no_service->headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, GLOBAL_SETTING_HEADER_sts);
-	response_no_service->body = strdup(response_body_no_service);
-	response_no_service->body_size = size;
+	if (response->headers)
+		http_response_headers_destroy(response->headers);
+	free(response);
+	return NULL;
+}
+
+static void destroy_fallback_response(http_response_t *response) {
+	if (!response)
+		return;
+	http_prebuilt_response_destroy((http_prebuilt_response_t *) response->prebuilt);
+	http_response_headers_destroy(response->headers);
+	free(response);
 }
 
 static void destroy_fallback_responses(void) {
-	http_response_headers_destroy(response_invalid_request->headers);
-	http_response_headers_destroy(response_no_service->headers);
-	free(response_invalid_request->body);
-	free(response_no_service->body);
-	free(response_invalid_request);
-	free(response_no_service);
+	destroy_fallback_response(response_invalid_request);
+	destroy_fallback_response(response_no_service);
+	destroy_fallback_response(response_too_early);
+	destroy_fallback_response(response_payload_too_large);
+	destroy_fallback_response(response_fs_not_found);
+	response_invalid_request = response_no_service = response_too_early = NULL;
+	response_payload_too_large = response_fs_not_found = NULL;
+}
+
+/* (boolean) creates the fallback responses */
+static int setup_responses(void) {
+	response_invalid_request = create_fallback_response(HTTP_RH_STATUS_400, response_body_invalid_request);
+	response_no_service = create_fallback_response(HTTP_RH_STATUS_503, response_body_no_service);
+	response_too_early = create_fallback_response(HTTP_RH_STATUS_425, response_body_too_early);
+	response_payload_too_large = create_fallback_response(HTTP_RH_STATUS_413, response_body_payload_too_large);
+	response_fs_not_found = create_fallback_response(HTTP_RH_STATUS_404, response_body_fs_not_found);
+	if (response_invalid_request && response_no_service && response_too_early && response_payload_too_large && response_fs_not_found)
+		return 1;
+	destroy_fallback_responses();
+	return 0;
 }
@@ -4,15 +4,303 @@
  *
  * TODO: Improve code documentation.
  */
+#include <ctype.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <stdint.h>
 #include <unistd.h>
 
 #include "http/header_parser.h"
+#include "utils/encoders.h"
 #include "utils/mime.h"
 #include "utils/util.h"
 
+/* compressed files are read and compressed in parts of this size while they are sent */
+#define FS_COMPRESSION_READ_SIZE 16384
+/* smaller files aren't worth compressing */
+#define FS_COMPRESSION_MINIMUM_SIZE 1024
+
+/* the body producer data of a file that is compressed while it is sent */
+typedef struct {
+	int fd;
+	encoder_stream_t *encoder;
+} fs_compressed_body_t;
+
+/* (boolean) text formats compress well, most other formats are compressed already */
+static int fs_is_compressible(const char *mime_type) {
+	static const char *const types[] = { "application/javascript", "application/json", "application/xml", "image/svg+xml" };
+	size_t i;
+	if (!strncmp(mime_type, "text/", 5))
+		return 1;
+	for (i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+		if (!strcmp(mime_type, types[i]))
+			return 1;
+	return 0;
+}
+
+static int fs_compressed_output(void *writer, const char *data, size_t size) {
+	return ((http_body_writer_t *) writer)->write(writer, data, size);
+}
+
+static int fs_compressed_produce(http_body_writer_t *writer, void *data) {
+	fs_compressed_body_t *body = (fs_compressed_body_t *) data;
+	char *buffer = malloc(FS_COMPRESSION_READ_SIZE);
+	if (!buffer)
+		return 0;
+
+	ssize_t length;
+	int success = 1;
+	do {
+		length = read(body->fd, buffer, FS_COMPRESSION_READ_SIZE);
+		if (length < 0) {
+			perror("[FileServerHandler] Failed to read the file");
+			success = 0;
+			break;
+		}
+		/* the end of the file finishes the stream */
+		success = encoder_stream_write(body->encoder, buffer, length, length == 0, fs_compressed_output, writer);
+	} while (success && length > 0);
+
+	free(buffer);
+	return success;
+}
+
+static void fs_compressed_destroy(void *data) {
+	fs_compressed_body_t *body = (fs_compressed_body_t *) data;
+	close(body->fd);
+	encoder_stream_destroy(body->encoder);
+	free(body);
+}
+
+/* the compression the client accepts, or NULL (and 'encoder' is left NULL) */
+static const char *fs_select_compression(http_header_list_t *request_headers, encoder_stream_t **encoder) {
+	const char *accept_encoding = http_header_list_getn(request_headers, HTTP_HEADER_NAME_ACCEPT_ENCODING);
+	if (!accept_encoding)
+		return NULL;
+
+	switch (http_parse_accept_encoding(accept_encoding)) {
+		case COMPRESSION_TYPE_GZIP:
+			*encoder = encoder_stream_create(ENCODER_STREAM_GZIP);
+			return *encoder ? "gzip" : NULL;
+		case COMPRESSION_TYPE_BROTLI:
+			*encoder = encoder_stream_create(ENCODER_STREAM_BROTLI);
+			return *encoder ? "br" : NULL;
+		default:
+			return NULL;
+	}
+}
+
+/* the cookie with the digest of the resources that were pushed to the client */
+#define FS_PUSH_COOKIE "wss-push"
+
+/* the destination of a preload link of the resource, the Link has to match
+ * the request the page makes */
+static const char *fs_preload_destination(const char *resource) {
+	const char *type = mime_from_path(resource, NULL);
+	if (!type)
+		return "";
+	if (!strcmp(type, "text/css"))
+		return "; as=style";
+	if (!strcmp(type, "application/javascript") || !strcmp(type, "text/javascript"))
+		return "; as=script";
+	/* fonts are always fetched in CORS mode */
+	if (!strncmp(type, "font/", 5))
+		return "; as=font; crossorigin";
+	if (!strncmp(type, "image/", 6))
+		return "; as=image";
+	return "";
+}
+
+/* (boolean) creates the Early Hints of the page: "</style.css>; rel=preload; as=style, ..." */
+static int fs_create_hints(handler_preload_t *preload) {
+	/* a second manifest can add resources to the page */
+	if (preload->hints)
+		http_response_headers_destroy(preload->hints);
+	preload->hints = NULL;
+	if (preload->resource_count == 0)
+		return 1;
+
+	size_t i;
+	size_t length = 0;
+	for (i = 0; i < preload->resource_count; i++)
+		length += strlen(preload->resources[i]) + strlen(fs_preload_destination(preload->resources[i])) + 17;
+
+	char *link = malloc(length + 1);
+	if (!link)
+		return 0;
+	char *end = link;
+	for (i = 0; i < preload->resource_count; i++) {
+		if (i > 0)
+			end += sprintf(end, ", ");
+		end += sprintf(end, "<%s>; rel=preload%s", preload->resources[i], fs_preload_destination(preload->resources[i]));
+	}
+
+	int success = (preload->hints = http_create_response_headers(3))
+		&& http_response_headers_add(preload->hints, HTTP_RH_STATUS_103, NULL)
+		&& http_response_headers_add(preload->hints, HTTP_RH_LINK, link);
+	free(link);
+	return success;
+}
+
+/* (boolean) adds the space-separated resources to the preloads of the page */
+static int fs_add_preloads(handler_fs_t *fs, const char *path, char *resources) {
+	if (path[0] != '/') {
+		printf("[FileServerHandler] The paths of a preload manifest start with a '/': \"%s\"\n", path);
+		return 0;
+	}
+
+	handler_preload_t *preload = NULL;
+	size_t i;
+	for (i = 0; i < fs->preload_count && !preload; i++)
+		if (!strcmp(fs->preloads[i].path, path))
+			preload = &fs->preloads[i];
+	if (!preload) {
+		handler_preload_t *preloads = realloc(fs->preloads, (fs->preload_count + 1) * sizeof(handler_preload_t));
+		if (!preloads)
+			return 0;
+		fs->preloads = preloads;
+		preload = &fs->preloads[fs->preload_count];
+		memset(preload, 0, sizeof(handler_preload_t));
+		if (!(preload->path = strdup(path)))
+			return 0;
+		fs->preload_count += 1;
+	}
+
+	/* not with strtok, handle_setup is tokenizing the list of handler files */
+	char *resource = resources;
+	while (*resource) {
+		size_t length = strcspn(resource, " \t");
+		if (length == 0) {
+			resource++;
+			continue;
+		}
+		char *next = resource + length + (resource[length] ? 1 : 0);
+		resource[length] = 0;
+
+		/* only the resources of this server can be pushed */
+		if (resource[0] != '/') {
+			printf("[FileServerHandler] The resources of a preload manifest start with a '/': \"%s\"\n", resource);
+			return 0;
+		}
+		char **list = realloc(preload->resources, (preload->resource_count + 1) * sizeof(char *));
+		if (!list)
+			return 0;
+		preload->resources = list;
+		if (!(list[preload->resource_count] = strdup(resource)))
+			return 0;
+		preload->resource_count += 1;
+		resource = next;
+	}
+	return 1;
+}
+
+/* (boolean) reads a preload manifest: "path=resource..." per line, a path
+ * can be repeated when its resources don't fit on one line */
+static int fs_load_preloads(handler_fs_t *fs, const char *file_name) {
+	FILE *file = fopen(file_name, "r");
+	if (!file) {
+		printf("[FileServerHandler] Failed to open the preload manifest: \"%s\"\n", file_name);
+		return 0;
+	}
+
+	config_t manifest = config_readf(file);
+	size_t i;
+	int success = 1;
+	for (i = 0; i < manifest.count && success; i++)
+		success = fs_add_preloads(fs, manifest.keys[i], manifest.values[i]);
+	config_destroy(manifest);
+
+	for (i = 0; i < fs->preload_count && success; i++)
+		success = fs_create_hints(&fs->preloads[i]);
+	return success;
+}
+
+/* the preloads of the page, the query of the path is ignored */
+static const handler_preload_t *fs_find_preload(const handler_fs_t *fs, const char *path) {
+	size_t length = strcspn(path, "?");
+	size_t i;
+	for (i = 0; i < fs->preload_count; i++)
+		if (!strncmp(fs->preloads[i].path, path, length) && fs->preloads[i].path[length] == 0)
+			return &fs->preloads[i];
+	return NULL;
+}
+
+/* The resources that were pushed to a client are remembered in a cookie, like
+ * a cache digest: a Bloom filter of 64 bits in which every resource sets two
+ * bits. A resource of which both bits are set isn't pushed again, a false
+ * positive only means the client fetches it after the Early Hints. */
+static uint64_t fs_push_bits(const char *resource) {
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+	for (; *resource; resource++)
+		hash = (hash ^ (unsigned char) *resource) * 16777619u;
+	return ((uint64_t) 1 << (hash & 63)) | ((uint64_t) 1 << ((hash >> 6) & 63));
+}
+
+/* the digest in the cookies of the request, 0 if there isn't one */
+static uint64_t fs_push_digest(http_header_list_t *request_headers) {
+	size_t i;
+	for (i = 0; i < request_headers->count; i++) {
+		/* HTTP/2 clients may send every cookie in a header of its own */
+		if (request_headers->headers[i]->name != HTTP_HEADER_NAME_COOKIE)
+			continue;
+
+		const char *cookie = request_headers->headers[i]->value;
+		while (cookie) {
+			while (*cookie == ' ')
+				cookie++;
+			if (!strncmp(cookie, FS_PUSH_COOKIE "=", sizeof(FS_PUSH_COOKIE))) {
+				uint64_t digest = 0;
+				for (cookie += sizeof(FS_PUSH_COOKIE); isxdigit((unsigned char) *cookie); cookie++)
+					digest = (digest << 4) | (isdigit((unsigned char) *cookie) ? *cookie - '0' : (tolower((unsigned char) *cookie) - 'a' + 10));
+				return digest;
+			}
+			if ((cookie = strchr(cookie, ';')))
+				cookie++;
+		}
+	}
+	return 0;
+}
+
+/* the Set-Cookie value with the digest */
+static char *fs_push_cookie(uint64_t digest) {
+	static const char attributes[] = "; Path=/; Secure; HttpOnly; SameSite=Lax";
+	char *value = malloc(sizeof(FS_PUSH_COOKIE) + 16 + sizeof(attributes));
+	if (!value)
+		return NULL;
+
+	char *digits = value + sizeof(FS_PUSH_COOKIE);
+	int i;
+	memcpy(value, FS_PUSH_COOKIE "=", sizeof(FS_PUSH_COOKIE));
+	for (i = 15; i >= 0; i--, digest >>= 4)
+		digits[i] = "0123456789abcdef"[digest & 0xF];
+	memcpy(digits + 16, attributes, sizeof(attributes));
+	return value;
+}
+
+/* sends the Early Hints of the page and pushes the resources the client
+ * doesn't have according to the digest in its cookie, returns the Set-Cookie
+ * value with the new digest, or NULL when nothing was pushed */
+static char *fs_preload(handler_fs_t *fs, const handler_preload_t *preload, http_header_list_t *request_headers, handler_callbacks_t *callbacks) {
+	if (callbacks->early_hints)
+		callbacks->early_hints(preload->hints, callbacks->application_data_length, callbacks->application_data);
+
+	const char *method = http_header_list_getn(request_headers, HTTP_HEADER_NAME_METHOD);
+	if (!fs->push || !callbacks->push || !method || strcmp(method, "GET"))
+		return NULL;
+
+	uint64_t digest = fs_push_digest(request_headers);
+	uint64_t pushed = digest;
+	size_t i;
+	for (i = 0; i < preload->resource_count; i++) {
+		uint64_t bits = fs_push_bits(preload->resources[i]);
+		if ((digest & bits) != bits && callbacks->push(preload->resources[i], callbacks->application_data_length, callbacks->application_data))
+			pushed |= bits;
+	}
+	return pushed == digest ? NULL : fs_push_cookie(pushed);
+}
+
 char *create_full_path(const char *wdir, const char *path, const char *optional) {
 	size_t dir_length = strlen(wdir);
 	if (wdir[dir_length-1] == '/')
@@ -39,11 +327,20 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 	char *fullpath = NULL;
 	char *file_last_modified = NULL;
 	char *mime_type = NULL;
+	char *push_cookie = NULL;
+	encoder_stream_t *encoder = NULL;
 
 	http_response_t *response = malloc(sizeof(http_response_t));
 	if (!response)
 		goto error_end;
 	response->is_dynamic = 1;
+	response->body = NULL;
+	response->body_size = 0;
+	response->body_file = -1;
+	response->body_producer = NULL;
+	response->body_producer_data = NULL;
+	response->body_producer_destroy = NULL;
+	response->prebuilt = NULL;
 	response->headers = http_create_response_headers(8);
 	if (!response->headers) {
 		free(response);
@@ -96,29 +393,18 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 	if (fd <= 0 || (S_ISREG(stat_buf->st_mode) == 0)) {
 		printf("DEBUG: File \"%s\" not found!\n", fullpath);
 
-		size_t length = strlen(response_body_fs_not_found);
-		if (!http_response_headers_add(response->headers, HTTP_RH_STATUS_404, NULL) ||
-			!handle_write_length(response->headers, length) ||
-			!header_write_date(response->headers) ||
-			!http_response_headers_add(response->headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8") ||
-			!http_response_headers_add(response->headers, HTTP_RH_SERVER, GLOBAL_SETTING_server_name) ||
-			(GLOBAL_SETTING_HEADER_sts && !http_response_headers_add(response->headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, GLOBAL_SETTING_HEADER_sts)) ||
-			(GLOBAL_SETTING_HEADER_tk && !http_response_headers_add(response->headers, HTTP_RH_TK, GLOBAL_SETTING_HEADER_tk))
-			) {
-			puts("DEBUG: FS MemoryError on 404 headers.");
-			http_response_headers_destroy(response->headers);
-			free(response);
-			return NULL;
-		}
-		/* TODO ensure everything has been destroyed (?) */
-		response->body_size = length;
-		response->body = strdup(response_body_fs_not_found);
-		if (callbacks && callbacks->headers_ready)
-			callbacks->headers_ready(response->headers, callbacks->application_data_length, callbacks->application_data);
-
+		http_response_headers_destroy(response->headers);
+		free(response);
+		response = response_fs_not_found;
 		goto general_end;
 	}
 
+	/* only a page that is served hints and pushes its subresources, the
+	 * client can fetch them while the page is sent */
+	const handler_preload_t *preload = callbacks && fs->preload_count > 0 ? fs_find_preload(fs, path) : NULL;
+	if (preload && preload->hints)
+		push_cookie = fs_preload(fs, preload, request_headers, callbacks);
+
 	int should_have_charset = 0;
 	const char *temp_mime_type = mime_from_path(fullpath, fs->charset ? &should_have_charset : NULL);
 	if (!temp_mime_type) {
@@ -149,13 +435,13 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 
 	int client_has_good_cache = 0;
 	if (fs->send_mod) {
-		const char *cache_control = http_header_list_gets(request_headers, "cache-control");
+		const char *cache_control = http_header_list_getn(request_headers, HTTP_HEADER_NAME_CACHE_CONTROL);
 		if (!cache_control)
-			cache_control = http_header_list_gets(request_headers, "pragma");
+			cache_control = http_header_list_getn(request_headers, HTTP_HEADER_NAME_PRAGMA);
 
 		/* only use the client's cache when it wants to (i.e. Cache-Control or Pragma doesn't contain the '*/
 		if (!cache_control || !http_parse_cache_control(cache_control)) {
-			const char *if_modified_since = http_header_list_gets(request_headers, "if-modified-since");
+			const char *if_modified_since = http_header_list_getn(request_headers, HTTP_HEADER_NAME_IF_MODIFIED_SINCE);
 			if (if_modified_since && strlen(if_modified_since) > 0) {
 				/*
 				struct tm *tm = malloc(sizeof(struct tm));
@@ -190,6 +476,12 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 
 	size_t length = stat_buf->st_size;
 
+	/* the length of a compressed file isn't known until it is sent */
+	int compressible = fs->compress && length >= FS_COMPRESSION_MINIMUM_SIZE && fs_is_compressible(temp_mime_type);
+	const char *content_encoding = NULL;
+	if (compressible && !client_has_good_cache)
+		content_encoding = fs_select_compression(request_headers, &encoder);
+
 	if (client_has_good_cache) {
 		if (!http_response_headers_add(response->headers, HTTP_RH_STATUS_304, NULL)) {
 			puts("DEBUG: FS MemoryError on 304 headers.");
@@ -197,38 +489,54 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 		}
 	} else {
 		if (!http_response_headers_add(response->headers, HTTP_RH_STATUS_200, NULL) ||
-			!handle_write_length(response->headers, length) ||
+			(content_encoding && !http_response_headers_add(response->headers, HTTP_RH_CONTENT_ENCODING, content_encoding)) ||
+			(!content_encoding && !handle_write_length(response->headers, length)) ||
 			(fs->send_mod && !http_response_headers_add(response->headers, HTTP_RH_LAST_MODIFIED, file_last_modified))) {
 			puts("DEBUG: FS MemoryError on 200 headers.");
 			goto error_end;
 		}
 	}
 
+	if (push_cookie && !http_response_headers_add(response->headers, HTTP_RH_SET_COOKIE, push_cookie)) {
+		puts("DEBUG: FS MemoryError on Set-Cookie header.");
+		goto error_end;
+	}
+
+	if (compressible && !http_response_headers_add(response->headers, HTTP_RH_VARY, "Accept-Encoding")) {
+		puts("DEBUG: FS MemoryError on Vary header.");
+		goto error_end;
+	}
+
 	if (!header_write_date(response->headers) ||
 		(mime_type && !http_response_headers_add(response->headers, HTTP_RH_CONTENT_TYPE, mime_type)) ||
-		!http_response_headers_add(response->headers, HTTP_RH_SERVER, GLOBAL_SETTING_server_name) ||
-		(GLOBAL_SETTING_HEADER_sts && !http_response_headers_add(response->headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, GLOBAL_SETTING_HEADER_sts)) ||
-		(GLOBAL_SETTING_HEADER_tk && !http_response_headers_add(response->headers, HTTP_RH_TK, GLOBAL_SETTING_HEADER_tk))) {
+		!header_write_server(response->headers)) {
 		puts("DEBUG: FS MemoryError on General headers.");
 		goto error_end;
 	}
-	if (callbacks && callbacks->headers_ready)
-		callbacks->headers_ready(response->headers, callbacks->application_data_length, callbacks->application_data);
-
-	char *buffer = malloc(length);
-	size_t pos = 0;
-	do {
-		ssize_t r = read(fd, buffer, length-pos);
-		if (r == 0)
-			break;
-		if (r == -1) {
-			perror("FSH Reader");
+	if (content_encoding) {
+		/* the file is compressed while it is sent */
+		fs_compressed_body_t *body = malloc(sizeof(fs_compressed_body_t));
+		if (!body) {
+			puts("DEBUG: FS MemoryError on compressed body.");
 			goto error_end;
 		}
-		pos += r;
-	} while (pos != length);
-	response->body = buffer;
-	response->body_size = length;
+		body->fd = fd;
+		body->encoder = encoder;
+		response->body_producer = fs_compressed_produce;
+		response->body_producer_data = body;
+		response->body_producer_destroy = fs_compressed_destroy;
+		fd = -1;
+		encoder = NULL;
+	} else if (!client_has_good_cache) {
+		/* the file is sent by the transport (with sendfile(2) if possible) */
+		response->body_file = fd;
+		response->body_size = length;
+		fd = -1;
+	}
+
+	/* last, the response can't fail anymore once its headers are sent */
+	if (callbacks && callbacks->headers_ready)
+		callbacks->headers_ready(response->headers, callbacks->application_data_length, callbacks->application_data);
 
 	goto general_end;
 	/*
@@ -250,9 +558,11 @@ http_response_t *fs_handle(const char *path, http_handler_t *handler, http_heade
 	general_end:
 	if (fd != -1)
 		close(fd);
+	encoder_stream_destroy(encoder);
 	free(file_last_modified);
 	free(stat_buf);
 	free(mime_type);
+	free(push_cookie);
 	free(fullpath);
 	return response;
 }
@@ -44,6 +44,13 @@ static int header_write_date(http_response_headers_t *headers) {
 	return i;
 }
 
+/* (boolean) adds the Server, Strict-Transport-Security and Tk headers with the configured values */
+static int header_write_server(http_response_headers_t *headers) {
+	return http_response_headers_add(headers, HTTP_RH_SERVER, NULL)
+		&& (!GLOBAL_SETTING_HEADER_sts || http_response_headers_add(headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, NULL))
+		&& (!GLOBAL_SETTING_HEADER_tk || http_response_headers_add(headers, HTTP_RH_TK, NULL));
+}
+
 static void destroy_handler(http_handler_t *handler) {
 	if (handler->overwrite_header_count > 0) {
 		size_t i;
@@ -59,6 +66,16 @@ static void destroy_handler(http_handler_t *handler) {
 		switch (handler->type) {
 			case HTTP_HANDLER_TYPE_FILESERVER: {
 				handler_fs_t *fs = (handler_fs_t *) handler->data;
+				size_t i, j;
+				for (i = 0; i < fs->preload_count; i++) {
+					for (j = 0; j < fs->preloads[i].resource_count; j++)
+						free(fs->preloads[i].resources[j]);
+					free(fs->preloads[i].resources);
+					free(fs->preloads[i].path);
+					if (fs->preloads[i].hints)
+						http_response_headers_destroy(fs->preloads[i].hints);
+				}
+				free(fs->preloads);
 				free(fs->charset);
 				free(fs->wdir);
 			} break;
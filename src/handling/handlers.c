@@ -15,6 +15,7 @@
 #include "base/global_settings.h"
 #include "configuration/config.h"
 #include "http/header_parser.h"
+#include "http/parser.h"
 #include "utils/encoders.h"
 #include "utils/util.h"
 
@@ -26,7 +27,8 @@ static const char *handler_options[] = {
 	/* general: */
 	"name", "type", "web-root", "overwrite-header",
 	/* fileserver specific: */
-	"directory", "send-modified", "charset"
+	"directory", "send-modified", "charset", "preload-manifest", "preload-push",
+	"compress"
 };
 static const char *handler_types[] = { "NONE", "fileserver" };
 
@@ -123,6 +125,10 @@ int handle_setup(config_t main_config) {
 									handler_fs_t *fs = (handler_fs_t *) handler->data;
 									fs->send_mod = 1;
 									fs->charset = strdup("utf-8");
+									fs->preloads = NULL;
+									fs->preload_count = 0;
+									fs->push = 0;
+									fs->compress = 0;
 								}
 								break;
 							default:
@@ -208,6 +214,41 @@ int handle_setup(config_t main_config) {
 
 					break;
 				}
+				case 7: {/* "preload-manifest" */
+					if (handler->type != HTTP_HANDLER_TYPE_FILESERVER || !handler->data) {
+						printf("[Handler] The preload-manifest option can only be set on fileservers, not %ss! File name: \"%s\"\n", handler_types[handler->type], component);
+						goto error_all;
+					}
+
+					if (!fs_load_preloads((handler_fs_t *) handler->data, config.values[i])) {
+						printf("[Handler] Failed to load the preload manifest \"%s\"! File name: \"%s\"\n", config.values[i], component);
+						goto error_all;
+					}
+
+					break;
+				}
+				case 8: {/* "preload-push" */
+					if (handler->type != HTTP_HANDLER_TYPE_FILESERVER || !handler->data) {
+						printf("[Handler] The preload-push option can only be set on fileservers, not %ss! File name: \"%s\"\n", handler_types[handler->type], component);
+						goto error_all;
+					}
+
+					handler_fs_t *fs = (handler_fs_t *) handler->data;
+					fs->push = config_get_bool(config, "preload-push", 0);
+
+					break;
+				}
+				case 9: {/* "compress" */
+					if (handler->type != HTTP_HANDLER_TYPE_FILESERVER || !handler->data) {
+						printf("[Handler] The compress option can only be set on fileservers, not %ss! File name: \"%s\"\n", handler_types[handler->type], component);
+						goto error_all;
+					}
+
+					handler_fs_t *fs = (handler_fs_t *) handler->data;
+					fs->compress = config_get_bool(config, "compress", 0);
+
+					break;
+				}
 				default:
 					printf("Warning: Unknown property: \"%s\" with value \"%s\"\n", config.keys[i], config.values[i]);
 					break;
@@ -238,7 +279,10 @@ int handle_setup(config_t main_config) {
 	}	while ((component = strtok(0, " ")));
 	
 	free(filenames);
-	setup_responses();
+	if (!setup_responses()) {
+		fputs("[Handling] Failed to setup the fallback responses.\n", stderr);
+		return 0;
+	}
 	return 1;
 
 error_all:
@@ -264,14 +308,23 @@ void handle_destroy() {
 
 http_response_t *http_handle_request(http_header_list_t *request_headers, handler_callbacks_t *callbacks) {
 
-	const char *path = http_header_list_gets(request_headers, ":path");
+	const char *path = http_header_list_getn(request_headers, HTTP_HEADER_NAME_PATH);
 	if (!path) {
 		puts("DEBUG: client didn't send a path!");
-		if (callbacks && callbacks->headers_ready)
-			callbacks->headers_ready(response_invalid_request->headers, callbacks->application_data_length, callbacks->application_data);
 		return response_invalid_request;
 	}
 
+	/* Early data can be replayed, so only handle requests that are safe to repeat (RFC 8470) */
+	if (request_headers->early_data && !http_method_is_safe(http_header_list_getn(request_headers, HTTP_HEADER_NAME_METHOD))) {
+		return response_too_early;
+	}
+
+	/* the body is refused before the handler reads any of it */
+	if (request_headers->body && request_headers->body->length != HTTP_BODY_LENGTH_UNKNOWN
+		&& request_headers->body->length > GLOBAL_SETTING_request_body_max) {
+		return response_payload_too_large;
+	}
+
 	size_t i;
 	http_handler_t *handler;
 	for (i = 0; i < handler_count; i++) {
@@ -294,10 +347,6 @@ http_response_t *http_handle_request(http_header_list_t *request_headers, handle
 	}
 
 	puts("DEBUG: Warning no handler!");
-	http_response_t *response = response_no_service;
-	if (callbacks && callbacks->headers_ready) {
-		callbacks->headers_ready(response->headers, callbacks->application_data_length, callbacks->application_data);
-	}
-
-	return response;
+	/* the prebuilt responses are sent by the protocols, without the callbacks */
+	return response_no_service;
 }
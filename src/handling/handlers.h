@@ -7,6 +7,7 @@
 #ifndef HANDLERS_H
 #define HANDLERS_H
 
+#include "../configuration/config.h"
 #include "../http/common.h"
 #include "../http/header_list.h"
 
@@ -24,6 +25,14 @@ typedef struct {
 	void **application_data;
 	size_t application_data_length;
 	void (*headers_ready)(http_response_headers_t *, size_t, void **);
+	/* (nullable) sends a '103 Early Hints' response before the handler starts
+	 * on the response, so the client can fetch the subresources of a page in
+	 * the meantime (RFC 8297) */
+	void (*early_hints)(http_response_headers_t *, size_t, void **);
+	/* (nullable) promises the response to a GET request of the path, with
+	 * the other headers of the request (HTTP/2 server push), returns
+	 * (boolean) whether it was promised */
+	int (*push)(const char *, size_t, void **);
 } handler_callbacks_t;
 
 typedef enum HTTP_HANDLER_TYPE {
@@ -31,12 +40,29 @@ typedef enum HTTP_HANDLER_TYPE {
 	HTTP_HANDLER_TYPE_FILESERVER = 0x1,
 } HTTP_HANDLER_TYPE;
 
+/* the subresources of a page in the preload manifest of a fileserver */
+typedef struct handler_preload_t {
+	/* the path of the page, without the query */
+	char *path;
+	char **resources;
+	size_t resource_count;
+	/* the '103 Early Hints' response, with a Link header of the resources */
+	http_response_headers_t *hints;
+} handler_preload_t;
+
 typedef struct handler_fs_t {
 	/* working directory */
 	char *wdir;
 	char *charset;
 	/* (boolean) send modification date */
 	int send_mod;
+	/* the preload manifest, see the 'preload-manifest' option */
+	handler_preload_t *preloads;
+	size_t preload_count;
+	/* (boolean) push the subresources to HTTP/2 clients that allow it */
+	int push;
+	/* (boolean) compress text files while they are sent, see the 'compress' option */
+	int compress;
 } handler_fs_t;
 
 typedef struct http_handler_t {
@@ -13,36 +13,31 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
-#define DATE_FORMATTED_SIZE 64
+#include <unistd.h>
 
 const char *http_common_log_status_names[] = { "?", "ok", "client error", "server error" };
 
-static const char *error_statuses[] = { "405 Method Not Allowed", "414 URI Too Long", "505 HTTP Version Not Supported", "400 Bad Request" };
+static const http_response_header_name error_statuses[] = {
+	HTTP_RH_STATUS_405, HTTP_RH_STATUS_414, HTTP_RH_STATUS_505, HTTP_RH_STATUS_400,
+	HTTP_RH_STATUS_400, HTTP_RH_STATUS_431, HTTP_RH_STATUS_417, HTTP_RH_STATUS_501
+};
 #define _MALFORMEDREQ "<h1>Your browser has sent a malformed request.</h1><hr><p>"
 static const char *error_bodies[] = { 
 	_MALFORMEDREQ"We can't support the sent <b>method</b> your browser wants to use.</p>", 
 	_MALFORMEDREQ"We can't handle the <b>path</b> your browser sent us.</p>",
 	_MALFORMEDREQ"We don't support the <b>version</b> your browser uses.</p>",
-	_MALFORMEDREQ"The <b>host name</b> your browser has sent is incorrect.</p>"
+	_MALFORMEDREQ"The <b>host name</b> your browser has sent is incorrect.</p>",
+	_MALFORMEDREQ"We can't understand the <b>headers</b> your browser sent us.</p>",
+	_MALFORMEDREQ"The <b>headers</b> your browser sent us are too large.</p>",
+	_MALFORMEDREQ"We can't meet the <b>expectation</b> your browser sent us.</p>",
+	_MALFORMEDREQ"We can't decode the <b>transfer coding</b> of the body your browser sent us.</p>"
 };
+#define ERROR_COUNT (sizeof(error_bodies) / sizeof(error_bodies[0]))
 
 static const char *supported_methods = "GET";
 
-static char *get_date() {
-    time_t t = time(NULL);
-    struct tm *the_time = gmtime(&t);
-    char *formatted = malloc(DATE_FORMATTED_SIZE);
-
-    if (formatted == NULL)
-        return NULL;
-
-    size_t size = strftime(formatted, DATE_FORMATTED_SIZE, "%a, %c %b %G %T GMT", the_time);
-    char *result = realloc(formatted, size+1);
-    result[size] = '\0';
-
-    return result;
-}
+/* the responses of the errors, rendered by http_error_responses_setup */
+static http_prebuilt_response_t *error_responses[ERROR_COUNT];
 
 void http_destroy_headers(http_headers_t headers) {
 	size_t i;
@@ -53,53 +48,64 @@ void http_destroy_headers(http_headers_t headers) {
 	}
 }
 
-void http_handle_error_gracefully(TLS source, HTTP_ERROR error, const char *information, int keep_alive) {
-	if (sizeof(error_bodies) / sizeof(error_bodies[0]) <= error) {
+/* (boolean) renders the response of the error */
+static int render_error(HTTP_ERROR error) {
+	char content_length[32];
+	size_t body_size = strlen(error_bodies[error]);
+	sprintf(content_length, "%zu", body_size);
+
+	http_response_headers_t *headers = http_create_response_headers(10);
+	if (!headers)
+		return 0;
+	if (http_response_headers_add(headers, error_statuses[error], NULL)
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8")
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_LENGTH, content_length)
+		&& (error != HTTP_ERROR_UNSUPPORTED_METHOD || http_response_headers_add(headers, HTTP_RH_ALLOW, supported_methods))
+		&& http_response_headers_add(headers, HTTP_RH_SERVER, NULL)
+		&& (!GLOBAL_SETTING_HEADER_sts || http_response_headers_add(headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, NULL))
+		&& (!GLOBAL_SETTING_HEADER_tk || http_response_headers_add(headers, HTTP_RH_TK, NULL)))
+		error_responses[error] = http_prebuilt_response_create(headers, error_bodies[error], body_size);
+	http_response_headers_destroy(headers);
+	return error_responses[error] != NULL;
+}
+
+int http_error_responses_setup(void) {
+	size_t i;
+	for (i = 0; i < ERROR_COUNT; i++) {
+		if (!render_error(i)) {
+			http_error_responses_destroy();
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void http_error_responses_destroy(void) {
+	size_t i;
+	for (i = 0; i < ERROR_COUNT; i++) {
+		http_prebuilt_response_destroy(error_responses[i]);
+		error_responses[i] = NULL;
+	}
+}
+
+void http_handle_error_gracefully(transport_t *source, HTTP_ERROR error, int keep_alive) {
+	if (ERROR_COUNT <= error || !error_responses[error]) {
 		printf("[HTTP1x] Invalid graceful handling error=0x%x\n", error);
 		return;
 	}
-	
-	const char *format = "HTTP/1.1 %s\r\nStrict-Transport-Security: max-age=31536000; includeSubDomains; preload\r\nConnection: %s\r\nDate: %s\r\nAllow: %s\r\nServer: %s\r\nContent-Length: %s\r\n\r\n";
-	/* the amount of times an argument char or list of chars has occurred, for example: '%s', '%zi' etc */
-	size_t argument_chars = 10;
-	
-	const char *connection = keep_alive ? "keep-alive" : "close";
-	char *date = get_date();
-	const char *status = error_statuses[error];
-	const char *body = error_bodies[error];
-	
-	/* content-length value */
-	size_t body_size = strlen(body);
-	FILE *null_fp = fopen("/dev/null", "w");
-	char *content_length = malloc(fprintf(null_fp, "%zi", body_size) + 1);
-	fclose(null_fp);
-	sprintf(content_length, "%zi", body_size);
-	
-	size_t response_size = 
-		/* format string - argument characters */
-		strlen(format) - 
-		argument_chars + 
-		/* the header values*/
-		strlen(status) +
-		strlen(connection) + 
-		strlen(date) + 
-		strlen(GLOBAL_SETTING_server_name) +
-		strlen(supported_methods) + 
-		strlen(content_length);
-	
-	size_t buffer_size = response_size + body_size;
-	char *buffer = malloc(buffer_size);
-	size_t i;
-	for (i = 0; i < buffer_size; i++)
-		buffer[i] = 'A';
-	
-	sprintf(buffer, format, status, connection, date, supported_methods, GLOBAL_SETTING_server_name, content_length);
-	strcpy(buffer + response_size, body);
-	
-	tls_write_client(source, buffer, buffer_size);
-	
-	free(content_length);
-	free(date);
+	http1_write_prebuilt(source, error_responses[error], 0, !keep_alive);
+}
+
+void http_response_destroy(http_response_t *response) {
+	if (!response->is_dynamic)
+		return;
+	free(response->body);
+	if (response->body_file != -1)
+		close(response->body_file);
+	if (response->body_producer_destroy)
+		response->body_producer_destroy(response->body_producer_data);
+	http_response_headers_destroy(response->headers);
+	free(response);
 }
 
 const char *http_get_header(http_headers_t headers, const char *key) {
@@ -7,7 +7,8 @@
 #ifndef HTTP_COMMON_H
 #define HTTP_COMMON_H
 
-#include "../secure/tlsutil.h"
+#include "../transport/transport.h"
+#include "prebuilt_response.h"
 #include "response_headers.h"
 
 #define HTTP_PATH_MAX 2048
@@ -43,7 +44,15 @@ typedef enum HTTP_ERROR {
 	/**
 	 * The host is not equal to the one defined in the configuration, and hostname-strict is set to true.
 	 */
-	HTTP_ERROR_INVALID_HOST = 0x03
+	HTTP_ERROR_INVALID_HOST = 0x03,
+	/* A header line is malformed, or there are more than HTTP_HEADERS_MAX headers. */
+	HTTP_ERROR_MALFORMED_HEADERS = 0x04,
+	/* The request line and headers don't fit in the receive buffer. */
+	HTTP_ERROR_HEADERS_TOO_LARGE = 0x05,
+	/* The 'Expect' header has another value than '100-continue'. */
+	HTTP_ERROR_EXPECTATION_FAILED = 0x06,
+	/* The body is sent with another transfer coding than 'chunked'. */
+	HTTP_ERROR_UNSUPPORTED_TRANSFER_CODING = 0x07
 } HTTP_ERROR;
 
 typedef enum HTTP_HEADER_PARSE_ERROR {
@@ -72,6 +81,15 @@ typedef struct http_headers_t {
 	HTTP_HEADER_PARSE_ERROR error;
 } http_headers_t;
 
+/* Receives the parts of a body that is produced while it is sent, see
+ * http_response_t.body_producer. */
+typedef struct http_body_writer_t {
+	/* (boolean) writes the bytes, the body continues after them */
+	int (*write)(struct http_body_writer_t *, const char *, size_t);
+	/* the state of the protocol */
+	void *data;
+} http_body_writer_t;
+
 typedef struct http_response_t {
 	/** 
 	 * Should  we free this response and its contents 
@@ -84,6 +102,21 @@ typedef struct http_response_t {
 	size_t body_size;
 	/* "body" will be freed. */
 	char *body;
+	/* When not -1, the body is sent from this file instead of "body", so the
+	 * transport can use sendfile(2). It will be closed. */
+	int body_file;
+	/* When not NULL, the length of the body isn't known up front: the producer
+	 * is called once, with 'body_producer_data', and writes the body in as
+	 * many parts as it likes. HTTP/1.1 sends it with 'Transfer-Encoding:
+	 * chunked', so the handler shouldn't add a Content-Length. It returns
+	 * false when the body couldn't be completed. */
+	int (*body_producer)(http_body_writer_t *, void *);
+	void *body_producer_data;
+	/* (nullable) destroys 'body_producer_data' */
+	void (*body_producer_destroy)(void *);
+	/* (nullable) the rendered headers, sent instead of 'headers' (HTTP/1.1
+	 * sends the body from it too), see prebuilt_response.h */
+	const http_prebuilt_response_t *prebuilt;
 	
 	/* The status of the response. This is purely used for logging. */
 	HTTP_LOG_STATUS status;
@@ -103,18 +136,34 @@ typedef struct http_request_t {
  * Description:
  *   This function will handle the request gracefully, which means that it will send a full 
  *   request, with some 4xx or 5xx error status, required headers and an optional body.
+ *   The response of every error is rendered once, by http_error_responses_setup.
  * 
  * Parameters:
- *   TLS
- *     The TLS source to be read from.
+ *   transport_t *
+ *     The transport to be read from.
  *   HTTP_ERROR
  *     The error.
- *   const char *
- *     (Nullable) Optional information regarding the error.
  *   int
  *     (boolean) 0 for 'Connection' header to be 'close', otherwise 'keep-alive'.
  */
-void http_handle_error_gracefully(TLS, HTTP_ERROR, const char *, int);
+void http_handle_error_gracefully(transport_t *, HTTP_ERROR, int);
+
+/**
+ * Description:
+ *   Renders the responses of http_handle_error_gracefully, this should be
+ *   called after http1_serializer_setup.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int http_error_responses_setup(void);
+
+/**
+ * Description:
+ *   Destroys the responses rendered by http_error_responses_setup.
+ */
+void http_error_responses_destroy(void);
+
 /**
  * Description:
  *   This function will destroy any date from the map.
@@ -143,5 +192,15 @@ void http_destroy_headers(http_headers_t);
  */
 const char *http_get_header(http_headers_t, const char *);
 
+/**
+ * Description:
+ *   Destroys the response, if it is dynamic (see http_response_t).
+ *
+ * Parameters:
+ *   http_response_t *
+ *     The response to be destroyed.
+ */
+void http_response_destroy(http_response_t *);
+
 #endif /* HTTP_COMMON_H */
  
@@ -5,6 +5,7 @@
 #include "header_list.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
 #include <stdio.h>
 
@@ -27,6 +28,9 @@
 #define HEADER_LIST_STEP_SIZE    2
 #define HEADER_LIST_INITIAL_SIZE 8
 
+/* the headers of most requests fit in one block, see http_header_list_allocate */
+#define HEADER_LIST_BLOCK_SIZE 2048
+
 const char *http_header_type_names[] = { "HTTP_HEADER_CACHED", "HTTP_HEADER_NAME_CACHED", "HTTP_HEADER_NAME_DEFINED", "HTTP_HEADER_NOT_CACHED" };
 
 http_header_list_t *http_create_header_list() {
@@ -34,6 +38,9 @@ http_header_list_t *http_create_header_list() {
 	if (!list)
 		return list;
 	list->count = 0;
+	list->early_data = 0;
+	list->body = NULL;
+	list->blocks = NULL;
 	list->size = HEADER_LIST_INITIAL_SIZE;
 	list->headers = calloc(HEADER_LIST_INITIAL_SIZE, sizeof(http_header_t *));
 	return list;
@@ -61,6 +68,11 @@ void http_destroy_header_list(http_header_list_t *list) {
 		}
 		free(header);
 	}
+	while (list->blocks) {
+		http_header_block_t *next = list->blocks->next;
+		free(list->blocks);
+		list->blocks = next;
+	}
 	free(list->headers);
 	free(list);
 }
@@ -75,8 +87,23 @@ const char *http_header_list_getd(http_header_list_t *list, http_defined_name_ty
 	return NULL;
 }
 
+const char *http_header_list_getn(http_header_list_t *list, int name) {
+	size_t i;
+	for (i = 0; i < list->count; i++) {
+		if (list->headers[i]->name == name) {
+			return list->headers[i]->value;
+		}
+	}
+	return NULL;
+}
+
 const char *http_header_list_gets(http_header_list_t *list, const char *key) {
 	size_t i;
+	/* a known name is compared by its index, the key was hashed when it was added */
+	int name = http_header_name_lookup(key, strlen(key));
+	if (name >= 0)
+		return http_header_list_getn(list, name);
+
 	for (i = 0; i < list->count; i++) {
 		if (strcasecmp(list->headers[i]->key, key) == 0) {
 			return list->headers[i]->value;
@@ -131,6 +158,7 @@ int http_header_list_add(http_header_list_t *list, const char *key, char *value,
 		default:
 			header->key = key;
 			header->value = value;
+			header->name = key ? http_header_name_lookup(key, strlen(key)) : -1;
 			break;
 	}
 
@@ -143,3 +171,24 @@ int http_header_list_add(http_header_list_t *list, const char *key, char *value,
 	list->count += 1;
 	return 1;
 }
+
+char *http_header_list_allocate(http_header_list_t *list, size_t size) {
+	http_header_block_t *block = list->blocks;
+	if (!block || block->size - block->used < size) {
+		size_t block_size = size > HEADER_LIST_BLOCK_SIZE ? size : HEADER_LIST_BLOCK_SIZE;
+		if (!(block = malloc(sizeof(http_header_block_t) + block_size)))
+			return NULL;
+		block->used = 0;
+		block->size = block_size;
+		block->next = list->blocks;
+		list->blocks = block;
+	}
+
+	char *memory = (char *) (block + 1) + block->used;
+	block->used += size;
+	return memory;
+}
+
+void http_header_list_release(http_header_list_t *list, size_t size) {
+	list->blocks->used -= size;
+}
@@ -7,6 +7,8 @@
 
 #include <stddef.h>
 
+#include "header_name_table.h"
+
 /* Some common used headers to increase indexing. */
 typedef enum {
 	/* ':authority' and 'host' */
@@ -37,14 +39,47 @@ typedef struct {
 	http_defined_name_type defined_name;
 	const char *key;
 	char *value;
+	/* the index of the key in header_names.txt, or -1 if it isn't there */
+	int name;
 } http_header_t;
 
+/* The length of a request body that is sent without a Content-Length. */
+#define HTTP_BODY_LENGTH_UNKNOWN ((size_t) -1)
+
+/* Reads the body of a request while it is received, so a large body is never
+ * in memory at once. The client is only allowed to send more when the handler
+ * reads (HTTP/2 flow control, HTTP/1.1 '100 Continue' and TCP). */
+typedef struct http_body_reader_t {
+	/* reads at most the given amount of bytes: returns the amount read, 0 at
+	 * the end of the body, or -1 when the body is malformed, larger than
+	 * 'request-body-max', or the connection failed */
+	int (*read)(struct http_body_reader_t *, char *, size_t);
+	/* the Content-Length, or HTTP_BODY_LENGTH_UNKNOWN */
+	size_t length;
+	/* the state of the protocol */
+	void *data;
+} http_body_reader_t;
+
+/* A block of the strings that are allocated for the list, see
+ * http_header_list_allocate. The strings follow the structure. */
+typedef struct http_header_block_t {
+	struct http_header_block_t *next;
+	size_t used;
+	size_t size;
+} http_header_block_t;
+
 typedef struct {
 	http_header_t **headers;
 	size_t count;
 	/* Important: size != count */
 	size_t size;
 	http_version_type version;
+	/* (boolean) the request was (partly) received as TLS 1.3 early data */
+	int early_data;
+	/* (nullable) the body of the request, it is only valid while the request is handled */
+	http_body_reader_t *body;
+	/* (nullable) the strings of the list, the newest block is first */
+	http_header_block_t *blocks;
 } http_header_list_t;
 
 /** debugging purposes */
@@ -93,6 +128,22 @@ const char *http_header_list_getd(http_header_list_t *, http_defined_name_type);
  */
 const char *http_header_list_gets(http_header_list_t *, const char *);
 
+/**
+ * Description:
+ *   Get the value of a header using the index of its name in
+ *   header_names.txt, e.g. HTTP_HEADER_NAME_CONTENT_LENGTH.
+ *
+ * Parameters:
+ *   http_header_list_t *
+ *     The header list.
+ *   int
+ *     The index of the header name (see header_name_table.h).
+ *
+ * Return Value:
+ *   A NULL-termimated header value, or NULL.
+ */
+const char *http_header_list_getn(http_header_list_t *, int);
+
 /**
  * Description:
  *   Adds a header to the list.
@@ -114,4 +165,34 @@ const char *http_header_list_gets(http_header_list_t *, const char *);
  */
 int http_header_list_add(http_header_list_t *, const char *, char *, http_header_type, size_t);
 
+/**
+ * Description:
+ *   Allocates memory for a string that is freed with the list, so a header
+ *   that uses it is added as HTTP_HEADER_CACHED. The strings of a request
+ *   share a few blocks instead of being allocated one by one.
+ *
+ * Parameters:
+ *   http_header_list_t *
+ *     The header list.
+ *   size_t
+ *     The amount of octets.
+ *
+ * Return Value:
+ *   The memory, or NULL if the allocation failed.
+ */
+char *http_header_list_allocate(http_header_list_t *, size_t);
+
+/**
+ * Description:
+ *   Gives back the end of the last allocation of http_header_list_allocate,
+ *   when less was used than was allocated.
+ *
+ * Parameters:
+ *   http_header_list_t *
+ *     The header list.
+ *   size_t
+ *     The amount of octets at the end that weren't used.
+ */
+void http_header_list_release(http_header_list_t *, size_t);
+
 #endif /* HTTP_HEADER_LIST_H */
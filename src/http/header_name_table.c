@@ -0,0 +1,240 @@
+/**
+ * Generated by tools/perfect-hash.c from src/http/header_names.txt, don't edit.
+ * 73 words in 256 slots, seed 58719.
+ */
+#include "header_name_table.h"
+
+#include <string.h>
+
+#include "utils/perfect_hash.h"
+
+const char *const http_header_name_words[HTTP_HEADER_NAME_COUNT] = {
+	":authority",
+	":method",
+	":path",
+	":scheme",
+	":status",
+	"accept-charset",
+	"accept-encoding",
+	"accept-language",
+	"accept-ranges",
+	"accept",
+	"access-control-allow-origin",
+	"access-control-request-headers",
+	"access-control-request-method",
+	"age",
+	"allow",
+	"authorization",
+	"cache-control",
+	"connection",
+	"content-disposition",
+	"content-encoding",
+	"content-language",
+	"content-length",
+	"content-location",
+	"content-range",
+	"content-type",
+	"cookie",
+	"date",
+	"dnt",
+	"early-data",
+	"etag",
+	"expect",
+	"expires",
+	"from",
+	"host",
+	"http2-settings",
+	"if-match",
+	"if-modified-since",
+	"if-none-match",
+	"if-range",
+	"if-unmodified-since",
+	"keep-alive",
+	"last-modified",
+	"link",
+	"location",
+	"max-forwards",
+	"origin",
+	"pragma",
+	"priority",
+	"proxy-authenticate",
+	"proxy-authorization",
+	"range",
+	"referer",
+	"refresh",
+	"retry-after",
+	"save-data",
+	"sec-fetch-dest",
+	"sec-fetch-mode",
+	"sec-fetch-site",
+	"sec-fetch-user",
+	"server",
+	"set-cookie",
+	"strict-transport-security",
+	"te",
+	"trailer",
+	"transfer-encoding",
+	"upgrade",
+	"upgrade-insecure-requests",
+	"user-agent",
+	"vary",
+	"via",
+	"www-authenticate",
+	"x-forwarded-for",
+	"x-forwarded-proto"
+};
+
+int http_header_name_lookup(const char *word, size_t length) {
+	if (length < 2 || length > 30)
+		return -1;
+	switch (perfect_hash(word, length, 58719UL, 1) & 255UL) {
+		case 1:
+			return length == 16 && perfect_hash_equal_fold(word, "content-encoding", 16) ? 19 : -1;
+		case 3:
+			return length == 7 && perfect_hash_equal_fold(word, "refresh", 7) ? 52 : -1;
+		case 6:
+			return length == 19 && perfect_hash_equal_fold(word, "proxy-authorization", 19) ? 49 : -1;
+		case 10:
+			return length == 15 && perfect_hash_equal_fold(word, "x-forwarded-for", 15) ? 71 : -1;
+		case 15:
+			return length == 10 && perfect_hash_equal_fold(word, "early-data", 10) ? 28 : -1;
+		case 16:
+			return length == 6 && perfect_hash_equal_fold(word, "pragma", 6) ? 46 : -1;
+		case 17:
+			return length == 13 && perfect_hash_equal_fold(word, "cache-control", 13) ? 16 : -1;
+		case 23:
+			return length == 14 && perfect_hash_equal_fold(word, "accept-charset", 14) ? 5 : -1;
+		case 25:
+			return length == 13 && perfect_hash_equal_fold(word, "if-none-match", 13) ? 37 : -1;
+		case 28:
+			return length == 10 && perfect_hash_equal_fold(word, "user-agent", 10) ? 67 : -1;
+		case 33:
+			return length == 14 && perfect_hash_equal_fold(word, "content-length", 14) ? 21 : -1;
+		case 34:
+			return length == 10 && perfect_hash_equal_fold(word, "set-cookie", 10) ? 60 : -1;
+		case 37:
+			return length == 18 && perfect_hash_equal_fold(word, "proxy-authenticate", 18) ? 48 : -1;
+		case 40:
+			return length == 15 && perfect_hash_equal_fold(word, "accept-encoding", 15) ? 6 : -1;
+		case 51:
+			return length == 10 && perfect_hash_equal_fold(word, "connection", 10) ? 17 : -1;
+		case 53:
+			return length == 9 && perfect_hash_equal_fold(word, "save-data", 9) ? 54 : -1;
+		case 63:
+			return length == 4 && perfect_hash_equal_fold(word, "vary", 4) ? 68 : -1;
+		case 65:
+			return length == 4 && perfect_hash_equal_fold(word, "link", 4) ? 42 : -1;
+		case 72:
+			return length == 8 && perfect_hash_equal_fold(word, "if-range", 8) ? 38 : -1;
+		case 73:
+			return length == 16 && perfect_hash_equal_fold(word, "content-location", 16) ? 22 : -1;
+		case 78:
+			return length == 6 && perfect_hash_equal_fold(word, "cookie", 6) ? 25 : -1;
+		case 79:
+			return length == 7 && perfect_hash_equal_fold(word, "trailer", 7) ? 63 : -1;
+		case 89:
+			return length == 15 && perfect_hash_equal_fold(word, "accept-language", 15) ? 7 : -1;
+		case 91:
+			return length == 8 && perfect_hash_equal_fold(word, "if-match", 8) ? 35 : -1;
+		case 92:
+			return length == 25 && perfect_hash_equal_fold(word, "strict-transport-security", 25) ? 61 : -1;
+		case 98:
+			return length == 13 && perfect_hash_equal_fold(word, "authorization", 13) ? 15 : -1;
+		case 101:
+			return length == 13 && perfect_hash_equal_fold(word, "accept-ranges", 13) ? 8 : -1;
+		case 103:
+			return length == 3 && perfect_hash_equal_fold(word, "dnt", 3) ? 27 : -1;
+		case 107:
+			return length == 6 && perfect_hash_equal_fold(word, "expect", 6) ? 30 : -1;
+		case 110:
+			return length == 14 && perfect_hash_equal_fold(word, "sec-fetch-user", 14) ? 58 : -1;
+		case 111:
+			return length == 4 && perfect_hash_equal_fold(word, "date", 4) ? 26 : -1;
+		case 112:
+			return length == 4 && perfect_hash_equal_fold(word, "from", 4) ? 32 : -1;
+		case 113:
+			return length == 2 && perfect_hash_equal_fold(word, "te", 2) ? 62 : -1;
+		case 118:
+			return length == 7 && perfect_hash_equal_fold(word, "expires", 7) ? 31 : -1;
+		case 119:
+			return length == 4 && perfect_hash_equal_fold(word, "host", 4) ? 33 : -1;
+		case 121:
+			return length == 13 && perfect_hash_equal_fold(word, "content-range", 13) ? 23 : -1;
+		case 124:
+			return length == 14 && perfect_hash_equal_fold(word, "sec-fetch-site", 14) ? 57 : -1;
+		case 125:
+			return length == 17 && perfect_hash_equal_fold(word, "x-forwarded-proto", 17) ? 72 : -1;
+		case 136:
+			return length == 7 && perfect_hash_equal_fold(word, ":method", 7) ? 1 : -1;
+		case 141:
+			return length == 17 && perfect_hash_equal_fold(word, "if-modified-since", 17) ? 36 : -1;
+		case 143:
+			return length == 17 && perfect_hash_equal_fold(word, "transfer-encoding", 17) ? 64 : -1;
+		case 144:
+			return length == 7 && perfect_hash_equal_fold(word, "referer", 7) ? 51 : -1;
+		case 147:
+			return length == 5 && perfect_hash_equal_fold(word, ":path", 5) ? 2 : -1;
+		case 150:
+			return length == 6 && perfect_hash_equal_fold(word, "origin", 6) ? 45 : -1;
+		case 151:
+			return length == 6 && perfect_hash_equal_fold(word, "accept", 6) ? 9 : -1;
+		case 155:
+			return length == 11 && perfect_hash_equal_fold(word, "retry-after", 11) ? 53 : -1;
+		case 169:
+			return length == 13 && perfect_hash_equal_fold(word, "last-modified", 13) ? 41 : -1;
+		case 171:
+			return length == 12 && perfect_hash_equal_fold(word, "content-type", 12) ? 24 : -1;
+		case 178:
+			return length == 10 && perfect_hash_equal_fold(word, "keep-alive", 10) ? 40 : -1;
+		case 185:
+			return length == 7 && perfect_hash_equal_fold(word, "upgrade", 7) ? 65 : -1;
+		case 187:
+			return length == 4 && perfect_hash_equal_fold(word, "etag", 4) ? 29 : -1;
+		case 191:
+			return length == 25 && perfect_hash_equal_fold(word, "upgrade-insecure-requests", 25) ? 66 : -1;
+		case 192:
+			return length == 5 && perfect_hash_equal_fold(word, "allow", 5) ? 14 : -1;
+		case 193:
+			return length == 29 && perfect_hash_equal_fold(word, "access-control-request-method", 29) ? 12 : -1;
+		case 196:
+			return length == 3 && perfect_hash_equal_fold(word, "via", 3) ? 69 : -1;
+		case 201:
+			return length == 19 && perfect_hash_equal_fold(word, "if-unmodified-since", 19) ? 39 : -1;
+		case 202:
+			return length == 14 && perfect_hash_equal_fold(word, "sec-fetch-mode", 14) ? 56 : -1;
+		case 206:
+			return length == 8 && perfect_hash_equal_fold(word, "location", 8) ? 43 : -1;
+		case 208:
+			return length == 3 && perfect_hash_equal_fold(word, "age", 3) ? 13 : -1;
+		case 210:
+			return length == 30 && perfect_hash_equal_fold(word, "access-control-request-headers", 30) ? 11 : -1;
+		case 216:
+			return length == 12 && perfect_hash_equal_fold(word, "max-forwards", 12) ? 44 : -1;
+		case 221:
+			return length == 7 && perfect_hash_equal_fold(word, ":scheme", 7) ? 3 : -1;
+		case 222:
+			return length == 6 && perfect_hash_equal_fold(word, "server", 6) ? 59 : -1;
+		case 226:
+			return length == 10 && perfect_hash_equal_fold(word, ":authority", 10) ? 0 : -1;
+		case 228:
+			return length == 14 && perfect_hash_equal_fold(word, "http2-settings", 14) ? 34 : -1;
+		case 230:
+			return length == 16 && perfect_hash_equal_fold(word, "content-language", 16) ? 20 : -1;
+		case 234:
+			return length == 27 && perfect_hash_equal_fold(word, "access-control-allow-origin", 27) ? 10 : -1;
+		case 235:
+			return length == 19 && perfect_hash_equal_fold(word, "content-disposition", 19) ? 18 : -1;
+		case 237:
+			return length == 7 && perfect_hash_equal_fold(word, ":status", 7) ? 4 : -1;
+		case 242:
+			return length == 5 && perfect_hash_equal_fold(word, "range", 5) ? 50 : -1;
+		case 245:
+			return length == 16 && perfect_hash_equal_fold(word, "www-authenticate", 16) ? 70 : -1;
+		case 250:
+			return length == 8 && perfect_hash_equal_fold(word, "priority", 8) ? 47 : -1;
+		case 253:
+			return length == 14 && perfect_hash_equal_fold(word, "sec-fetch-dest", 14) ? 55 : -1;
+		default:
+			return -1;
+	}
+}
@@ -0,0 +1,105 @@
+/**
+ * Generated by tools/perfect-hash.c from src/http/header_names.txt, don't edit.
+ */
+#ifndef HTTP_HEADER_NAME_TABLE_H
+#define HTTP_HEADER_NAME_TABLE_H
+
+#include <stddef.h>
+
+#define HTTP_HEADER_NAME_COUNT 73
+#define HTTP_HEADER_NAME_LENGTH_MAX 30
+
+/* the indices of the words */
+#define HTTP_HEADER_NAME_AUTHORITY 0
+#define HTTP_HEADER_NAME_METHOD 1
+#define HTTP_HEADER_NAME_PATH 2
+#define HTTP_HEADER_NAME_SCHEME 3
+#define HTTP_HEADER_NAME_STATUS 4
+#define HTTP_HEADER_NAME_ACCEPT_CHARSET 5
+#define HTTP_HEADER_NAME_ACCEPT_ENCODING 6
+#define HTTP_HEADER_NAME_ACCEPT_LANGUAGE 7
+#define HTTP_HEADER_NAME_ACCEPT_RANGES 8
+#define HTTP_HEADER_NAME_ACCEPT 9
+#define HTTP_HEADER_NAME_ACCESS_CONTROL_ALLOW_ORIGIN 10
+#define HTTP_HEADER_NAME_ACCESS_CONTROL_REQUEST_HEADERS 11
+#define HTTP_HEADER_NAME_ACCESS_CONTROL_REQUEST_METHOD 12
+#define HTTP_HEADER_NAME_AGE 13
+#define HTTP_HEADER_NAME_ALLOW 14
+#define HTTP_HEADER_NAME_AUTHORIZATION 15
+#define HTTP_HEADER_NAME_CACHE_CONTROL 16
+#define HTTP_HEADER_NAME_CONNECTION 17
+#define HTTP_HEADER_NAME_CONTENT_DISPOSITION 18
+#define HTTP_HEADER_NAME_CONTENT_ENCODING 19
+#define HTTP_HEADER_NAME_CONTENT_LANGUAGE 20
+#define HTTP_HEADER_NAME_CONTENT_LENGTH 21
+#define HTTP_HEADER_NAME_CONTENT_LOCATION 22
+#define HTTP_HEADER_NAME_CONTENT_RANGE 23
+#define HTTP_HEADER_NAME_CONTENT_TYPE 24
+#define HTTP_HEADER_NAME_COOKIE 25
+#define HTTP_HEADER_NAME_DATE 26
+#define HTTP_HEADER_NAME_DNT 27
+#define HTTP_HEADER_NAME_EARLY_DATA 28
+#define HTTP_HEADER_NAME_ETAG 29
+#define HTTP_HEADER_NAME_EXPECT 30
+#define HTTP_HEADER_NAME_EXPIRES 31
+#define HTTP_HEADER_NAME_FROM 32
+#define HTTP_HEADER_NAME_HOST 33
+#define HTTP_HEADER_NAME_HTTP2_SETTINGS 34
+#define HTTP_HEADER_NAME_IF_MATCH 35
+#define HTTP_HEADER_NAME_IF_MODIFIED_SINCE 36
+#define HTTP_HEADER_NAME_IF_NONE_MATCH 37
+#define HTTP_HEADER_NAME_IF_RANGE 38
+#define HTTP_HEADER_NAME_IF_UNMODIFIED_SINCE 39
+#define HTTP_HEADER_NAME_KEEP_ALIVE 40
+#define HTTP_HEADER_NAME_LAST_MODIFIED 41
+#define HTTP_HEADER_NAME_LINK 42
+#define HTTP_HEADER_NAME_LOCATION 43
+#define HTTP_HEADER_NAME_MAX_FORWARDS 44
+#define HTTP_HEADER_NAME_ORIGIN 45
+#define HTTP_HEADER_NAME_PRAGMA 46
+#define HTTP_HEADER_NAME_PRIORITY 47
+#define HTTP_HEADER_NAME_PROXY_AUTHENTICATE 48
+#define HTTP_HEADER_NAME_PROXY_AUTHORIZATION 49
+#define HTTP_HEADER_NAME_RANGE 50
+#define HTTP_HEADER_NAME_REFERER 51
+#define HTTP_HEADER_NAME_REFRESH 52
+#define HTTP_HEADER_NAME_RETRY_AFTER 53
+#define HTTP_HEADER_NAME_SAVE_DATA 54
+#define HTTP_HEADER_NAME_SEC_FETCH_DEST 55
+#define HTTP_HEADER_NAME_SEC_FETCH_MODE 56
+#define HTTP_HEADER_NAME_SEC_FETCH_SITE 57
+#define HTTP_HEADER_NAME_SEC_FETCH_USER 58
+#define HTTP_HEADER_NAME_SERVER 59
+#define HTTP_HEADER_NAME_SET_COOKIE 60
+#define HTTP_HEADER_NAME_STRICT_TRANSPORT_SECURITY 61
+#define HTTP_HEADER_NAME_TE 62
+#define HTTP_HEADER_NAME_TRAILER 63
+#define HTTP_HEADER_NAME_TRANSFER_ENCODING 64
+#define HTTP_HEADER_NAME_UPGRADE 65
+#define HTTP_HEADER_NAME_UPGRADE_INSECURE_REQUESTS 66
+#define HTTP_HEADER_NAME_USER_AGENT 67
+#define HTTP_HEADER_NAME_VARY 68
+#define HTTP_HEADER_NAME_VIA 69
+#define HTTP_HEADER_NAME_WWW_AUTHENTICATE 70
+#define HTTP_HEADER_NAME_X_FORWARDED_FOR 71
+#define HTTP_HEADER_NAME_X_FORWARDED_PROTO 72
+
+/* the words, in the order of src/http/header_names.txt */
+extern const char *const http_header_name_words[HTTP_HEADER_NAME_COUNT];
+
+/**
+ * Description:
+ *   Finds the word, case-insensitively.
+ *
+ * Parameters:
+ *   const char *
+ *     The word, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the word.
+ *
+ * Return Value:
+ *   The index of the word in http_header_name_words, or -1
+ */
+int http_header_name_lookup(const char *, size_t);
+
+#endif /* HTTP_HEADER_NAME_TABLE_H */
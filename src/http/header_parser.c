@@ -126,6 +126,19 @@ int http_parse_cache_control(const char *value) {
 	return 0;
 }
 
+int http_parse_content_length(const char *value, size_t *length) {
+	/* only digits, so a sign, whitespace or a list of lengths is rejected */
+	if (*value == 0)
+		return 0;
+	*length = 0;
+	for (; *value; value++) {
+		if (*value < '0' || *value > '9' || *length > ((size_t) -1 - 9) / 10)
+			return 0;
+		*length = *length * 10 + (*value - '0');
+	}
+	return 1;
+}
+
 /* TODO:
  *   Use the variables in encoders.h (ENCODER_STATUS_gzip and ENCODER_STATUS_brotli)
  *   AND the configuration to determine the availability and preference of the encoders.
@@ -181,6 +194,11 @@ compression_t http_parse_accept_encoding(const char *input) {
 				goto error;
 			}
 
+			/* "q=0" means "not acceptable" (RFC 7231 Section 5.3.1) */
+			if (quality == 0) {
+				continue;
+			}
+
 			if (token[len-1] == ' ') {
 				len -= 1;
 			}
@@ -204,7 +222,11 @@ compression_t http_parse_accept_encoding(const char *input) {
 						best_compressors[0] = hp_compressors[i];
 						best_quality = quality;
 					} else if (best_quality == quality) {
-						best_compressors[best_compressor_length++] = hp_compressors[i];
+						/* a repeated token mustn't overflow the list */
+						size_t j;
+						for (j = 0; j < best_compressor_length && best_compressors[j] != hp_compressors[i]; j++);
+						if (j == best_compressor_length)
+							best_compressors[best_compressor_length++] = hp_compressors[i];
 					}
 				}
 			}
@@ -215,23 +237,24 @@ compression_t http_parse_accept_encoding(const char *input) {
 
 	free(srctext);
 	
+	compression_t result = best_compressor_length == 0 ? COMPRESSION_TYPE_NONE : best_compressors[0];
+
 	/* if the client has more than 1 favorite, the server may decide. */
 	if (best_compressor_length > 1) {
 		size_t i, j;
 		for (i = 0; i < compressor_count; i++) {
 			for (j = 0; j < best_compressor_length; j++) {
 				if (hp_compressors[i] == best_compressors[j]) {
-					return hp_compressors[i];
+					result = hp_compressors[i];
+					goto end;
 				}
 			}
 		}
 	}
-	free(best_compressors);
 
-	if (best_compressor_length == 0)
-		return COMPRESSION_TYPE_NONE;
-
-	return best_compressors[0];
+end:
+	free(best_compressors);
+	return result;
 error:
 	/*puts("[DEBUG] Parser error on quality parser");*/
 	free(best_compressors);
@@ -7,6 +7,8 @@
 #ifndef HTTP_HEADER_PARSER_H
 #define HTTP_HEADER_PARSER_H
 
+#include <stddef.h>
+
 /** Structures **/
 typedef enum {
 	COMPRESSION_TYPE_ERROR = 0x0,
@@ -46,6 +48,21 @@ compression_t http_parse_accept_encoding(const char *);
  */
 int http_parse_cache_control(const char *);
 
+/**
+ * Description:
+ *   This function parses the header value of the 'Content-Length' header.
+ *
+ * Parameters:
+ *   const char *
+ *     The value of the Content-Length header.
+ *   size_t *
+ *     Where the length is stored.
+ *
+ * Return Value:
+ *   (boolean) Is the value a valid length that fits in a size_t?
+ */
+int http_parse_content_length(const char *, size_t *);
+
 /**
  * Description:
  *   This function sets the parser up.
@@ -5,127 +5,570 @@
  * This file contains the main functions for HTTP/1.1.
  */
 #include "http1.h"
+#include <limits.h>
+#include <stdio.h>
 #include <string.h>
-#include "parser.h"
-#include "../utils/io.h"
+#include <strings.h>
+#include "request_parser.h"
+#include "response_serializer.h"
 #include <stdlib.h>
 
 #include "base/global_settings.h"
+#include "handling/handlers.h"
+#include "header_parser.h"
 
-const char *h1_last_line = "\r\n";
-
-static char *compose_header_line(size_t *sbuffer, unsigned name, const char *value) {
-	const char *key = http_rhnames[name];
-	size_t skey = strlen(key);
-	size_t svalue = strlen(value);
-	*sbuffer = skey + svalue + 2;
-	char *buffer = malloc(*sbuffer * sizeof(char));
-	memcpy(buffer, key, skey);
-	memcpy(buffer + skey, value, svalue);
-	buffer[skey + svalue] = '\r';
-	buffer[skey + svalue+1] = '\n';
-	return buffer;
-}
-
-void http1_write_response(TLS tls, http_response_t *response) {
-	/* is it better to put it all in one packet or not?
-	   if not, using multiple tls_write_client's is
-	   easier to code */
-	size_t i;
-	for (i = 0; i < response->headers->count; i++) {
-		http_response_header_t *header = response->headers->headers[i];
-		if (header->name >= HTTP_RH_STATUSES) {
-			size_t sbuffer;
-			char *buffer = compose_header_line(&sbuffer, header->name, header->value);
-			tls_write_client(tls, buffer, sbuffer);
-			free(buffer);
-		} else {
-			if (i != 0) {
-				printf("Debug: %s", http_rhnames[header->name]);
-				size_t sbuffer;
-				char *buffer = compose_header_line(&sbuffer, header->name, header->value);
-				buffer[sbuffer-3] = 0;
-				printf("[HTTP/1.1] Warning: Status line not first header! Index=%zu, the first was: '%s'\n", i, buffer);
-				free(buffer);
-			}
-			const char *line = http_rhnames[header->name];
-			tls_write_client(tls, line, strlen(line));
+const char h1_last_chunk[] = "0\r\n\r\n";
+const char h1_continue[] = "HTTP/1.1 100 Continue\r\n\r\n";
+
+/* the space before the data of a chunk for its size line: 16 hex digits + CRLF */
+#define HTTP1_CHUNK_SIZE_LINE_MAX 18
+
+/* the part of the receive buffer after the request head where the body is
+ * received, the head can use all of HTTP1_REQUEST_HEAD_MAX */
+#define HTTP1_BODY_BUFFER_SIZE 16384
+/* the maximum length of a chunk size line, with its extensions */
+#define HTTP1_CHUNK_LINE_MAX 1024
+/* an unread body of at most this many bytes is discarded after the response,
+ * a larger one closes the connection */
+#define HTTP1_BODY_DRAIN_MAX 65536
+
+typedef enum {
+	HTTP1_BODY_END,
+	HTTP1_BODY_ERROR,
+	/* in the body of a request with a Content-Length */
+	HTTP1_BODY_CONTENT_LENGTH,
+	/* in a chunk size line */
+	HTTP1_BODY_CHUNK_SIZE,
+	/* in the data of a chunk */
+	HTTP1_BODY_CHUNK_DATA,
+	/* at the CRLF after the data of a chunk */
+	HTTP1_BODY_CHUNK_DATA_END,
+	/* in the trailer section after the last chunk, trailers are discarded */
+	HTTP1_BODY_TRAILERS
+} http1_body_state_t;
+
+/* reads the body of a request from the receive buffer and the transport */
+typedef struct {
+	transport_t *transport;
+	/* the receive buffer: the request head, followed by the part of the
+	 * body (and pipelined requests) that was already received */
+	char *buffer;
+	/* the end of the request head */
+	size_t start;
+	/* the received bytes that haven't been read are [position, length) */
+	size_t position;
+	size_t length;
+
+	http1_body_state_t state;
+	/* the bytes left of a Content-Length body or of a chunk */
+	size_t remaining;
+	/* the bytes of the body that have been read */
+	size_t total;
+	/* the length of the current chunk size line or of the trailer section */
+	size_t line;
+	/* the amount of hex digits in the chunk size */
+	size_t digits;
+	/* (boolean) the rest of the chunk size line (or trailer line) is skipped */
+	int skip;
+	/* (boolean) the client waits for a '100 Continue' before sending the body */
+	int expect_continue;
+} http1_body_t;
+
+/* coalesces the writes of a body producer into chunks of at most 'http1-chunk-size' bytes */
+typedef struct {
+	transport_t *transport;
+	/* the size line, the data, the CRLF after it, and room for the last chunk */
+	char *buffer;
+	/* the amount of data in the buffer, after the size line */
+	size_t length;
+	/* the response head, sent with the first chunk, NULL afterwards */
+	const char *head;
+	size_t head_length;
+} http1_chunk_writer_t;
+
+/* (boolean) sends the buffered data as one chunk, followed by the last chunk if 'last' is set */
+static int chunk_flush(http1_chunk_writer_t *writer, int last) {
+	char size_line[HTTP1_CHUNK_SIZE_LINE_MAX + 1];
+	size_t size_line_length = 0;
+	char *end = writer->buffer + HTTP1_CHUNK_SIZE_LINE_MAX + writer->length;
+
+	if (writer->length > 0) {
+		size_line_length = sprintf(size_line, "%zx\r\n", writer->length);
+		memcpy(end, "\r\n", 2);
+		end += 2;
+	}
+	if (last) {
+		memcpy(end, h1_last_chunk, sizeof(h1_last_chunk) - 1);
+		end += sizeof(h1_last_chunk) - 1;
+	}
+
+	/* the size line is put right before the data, so the chunk is written at once */
+	char *start = writer->buffer + HTTP1_CHUNK_SIZE_LINE_MAX - size_line_length;
+	memcpy(start, size_line, size_line_length);
+	writer->length = 0;
+	if (writer->head) {
+		struct iovec parts[2];
+		parts[0].iov_base = (char *) writer->head;
+		parts[0].iov_len = writer->head_length;
+		parts[1].iov_base = start;
+		parts[1].iov_len = end - start;
+		writer->head = NULL;
+		return transport_writev(writer->transport, parts, 2);
+	}
+	return start == end || transport_write(writer->transport, start, end - start);
+}
+
+static int chunk_write(http_body_writer_t *body_writer, const char *data, size_t size) {
+	http1_chunk_writer_t *writer = (http1_chunk_writer_t *) body_writer->data;
+	while (size > 0) {
+		size_t space = GLOBAL_SETTING_http1_chunk_size - writer->length;
+		if (space > size)
+			space = size;
+		memcpy(writer->buffer + HTTP1_CHUNK_SIZE_LINE_MAX + writer->length, data, space);
+		writer->length += space;
+		data += space;
+		size -= space;
+
+		if (writer->length == GLOBAL_SETTING_http1_chunk_size && !chunk_flush(writer, 0))
+			return 0;
+	}
+	return 1;
+}
+
+/* (boolean) runs the body producer, the body ends with the last chunk */
+static int write_chunked_body(transport_t *transport, http_response_t *response, const char *head, size_t head_length) {
+	http1_chunk_writer_t writer;
+	writer.transport = transport;
+	writer.length = 0;
+	writer.head = head;
+	writer.head_length = head_length;
+	writer.buffer = malloc(HTTP1_CHUNK_SIZE_LINE_MAX + GLOBAL_SETTING_http1_chunk_size + 2 + sizeof(h1_last_chunk));
+	if (!writer.buffer)
+		return 0;
+
+	http_body_writer_t body_writer;
+	body_writer.write = chunk_write;
+	body_writer.data = &writer;
+
+	/* without the last chunk, the client knows the body is incomplete */
+	int success = response->body_producer(&body_writer, response->body_producer_data)
+		&& chunk_flush(&writer, 1);
+	free(writer.buffer);
+	return success;
+}
+
+/* (boolean) writes the serialized head, followed by the body */
+static int write_head_and_body(transport_t *transport, http_response_t *response, int head, const char *buffer, size_t length) {
+	/* the Content-Length of a HEAD response is the length of the GET response, without a body */
+	if (head)
+		return transport_write(transport, buffer, length);
+	if (response->body_producer)
+		return write_chunked_body(transport, response, buffer, length);
+	if (response->body_file != -1)
+		return transport_write(transport, buffer, length)
+			&& transport_sendfile(transport, response->body_file, 0, response->body_size);
+	if (!response->body_size || !response->body)
+		return transport_write(transport, buffer, length);
+
+	struct iovec parts[2];
+	parts[0].iov_base = (char *) buffer;
+	parts[0].iov_len = length;
+	parts[1].iov_base = response->body;
+	parts[1].iov_len = response->body_size;
+	return transport_writev(transport, parts, 2);
+}
+
+int http1_write_response(transport_t *transport, http_response_t *response, int head, int keep_alive) {
+	if (response->prebuilt)
+		return http1_write_prebuilt(transport, response->prebuilt, head, !keep_alive);
+
+	char stack[HTTP1_RESPONSE_HEAD_SIZE];
+	char *buffer = stack;
+	int chunked = response->body_producer != NULL;
+	size_t length = http1_serialize_head(stack, sizeof(stack), response->headers, !keep_alive, chunked);
+	if (length > sizeof(stack)) {
+		buffer = malloc(length);
+		if (!buffer)
+			return 0;
+		http1_serialize_head(buffer, length, response->headers, !keep_alive, chunked);
+	}
+
+	int success = write_head_and_body(transport, response, head, buffer, length);
+	if (buffer != stack)
+		free(buffer);
+	return success;
+}
+
+/* (boolean) makes sure there are unread bytes in the buffer */
+static int body_fill(http1_body_t *body) {
+	if (body->position < body->length)
+		return 1;
+	body->position = body->length = body->start;
+	int read = transport_read(body->transport, body->buffer + body->start, HTTP1_REQUEST_HEAD_MAX + HTTP1_BODY_BUFFER_SIZE - body->start);
+	if (read <= 0)
+		return 0;
+	body->length += read;
+	return 1;
+}
+
+static int hex_digit(char character) {
+	if (character >= '0' && character <= '9')
+		return character - '0';
+	if (character >= 'a' && character <= 'f')
+		return character - 'a' + 10;
+	if (character >= 'A' && character <= 'F')
+		return character - 'A' + 10;
+	return -1;
+}
+
+/* (boolean) parses the chunk framing in the buffer, until the data of a chunk
+ * or the end of the body (RFC 7230 Section 4.1) */
+static int chunk_parse(http1_body_t *body) {
+	while (body->position < body->length) {
+		char character = body->buffer[body->position++];
+		size_t limit = body->state == HTTP1_BODY_TRAILERS ? HTTP1_REQUEST_HEAD_MAX : HTTP1_CHUNK_LINE_MAX;
+		if (++body->line > limit)
+			return 0;
+
+		switch (body->state) {
+			case HTTP1_BODY_CHUNK_SIZE:
+				if (character == '\n') {
+					if (body->digits == 0)
+						return 0;
+					body->state = body->remaining ? HTTP1_BODY_CHUNK_DATA : HTTP1_BODY_TRAILERS;
+					body->line = body->digits = 0;
+					body->skip = 0;
+					if (body->state == HTTP1_BODY_CHUNK_DATA)
+						return 1;
+				} else if (!body->skip) {
+					int digit = hex_digit(character);
+					if (digit >= 0) {
+						/* 15 digits, so the size doesn't overflow */
+						if (++body->digits > 15)
+							return 0;
+						body->remaining = (body->remaining << 4) | digit;
+					} else if (character == ';' || character == ' ' || character == '\t' || character == '\r') {
+						/* chunk extensions aren't used */
+						body->skip = 1;
+					} else {
+						return 0;
+					}
+				}
+				break;
+			case HTTP1_BODY_CHUNK_DATA_END:
+				if (character == '\n') {
+					body->state = HTTP1_BODY_CHUNK_SIZE;
+					body->line = 0;
+				} else if (character != '\r') {
+					return 0;
+				}
+				break;
+			case HTTP1_BODY_TRAILERS:
+				/* 'skip' is set when the line isn't empty */
+				if (character == '\n') {
+					if (!body->skip) {
+						body->state = HTTP1_BODY_END;
+						return 1;
+					}
+					body->skip = 0;
+				} else if (character != '\r') {
+					body->skip = 1;
+				}
+				break;
+			default:
+				return 1;
 		}
 	}
+	return 1;
+}
+
+static int body_read(http_body_reader_t *reader, char *destination, size_t size) {
+	http1_body_t *body = (http1_body_t *) reader->data;
+	if (body->expect_continue) {
+		body->expect_continue = 0;
+		if (!transport_write(body->transport, h1_continue, sizeof(h1_continue) - 1)) {
+			body->state = HTTP1_BODY_ERROR;
+			return -1;
+		}
+	}
+
+	while (body->state != HTTP1_BODY_CONTENT_LENGTH && body->state != HTTP1_BODY_CHUNK_DATA) {
+		if (body->state == HTTP1_BODY_END)
+			return 0;
+		if (body->state == HTTP1_BODY_ERROR || !body_fill(body) || !chunk_parse(body)) {
+			body->state = HTTP1_BODY_ERROR;
+			return -1;
+		}
+	}
+
+	if (size > body->remaining)
+		size = body->remaining;
+	if (size > INT_MAX)
+		size = INT_MAX;
+
+	/* the received bytes first, then directly from the transport */
+	int read;
+	if (body->position < body->length) {
+		if (size > body->length - body->position)
+			size = body->length - body->position;
+		memcpy(destination, body->buffer + body->position, size);
+		body->position += size;
+		read = size;
+	} else if ((read = transport_read(body->transport, destination, size)) <= 0) {
+		body->state = HTTP1_BODY_ERROR;
+		return -1;
+	}
 
-	tls_write_client(tls, h1_last_line, 2);
-	if (response->body_size && response->body) {
-		tls_write_client(tls, response->body, response->body_size);
+	body->remaining -= read;
+	body->total += read;
+	if (body->total > GLOBAL_SETTING_request_body_max) {
+		body->state = HTTP1_BODY_ERROR;
+		return -1;
 	}
+	if (body->remaining == 0)
+		body->state = body->state == HTTP1_BODY_CONTENT_LENGTH ? HTTP1_BODY_END : HTTP1_BODY_CHUNK_DATA_END;
+	return read;
 }
 
-http_header_list_t *http1_parse(TLS tls) {
+/* (boolean) sets the body up from the Content-Length or Transfer-Encoding of
+ * the request, or gives the error to respond with */
+static int body_setup(http1_body_t *body, http_body_reader_t *reader, http_header_list_t *request, HTTP_ERROR *error) {
+	body->state = HTTP1_BODY_END;
+	body->remaining = body->total = body->line = body->digits = 0;
+	body->skip = body->expect_continue = 0;
+	reader->read = body_read;
+	reader->length = HTTP_BODY_LENGTH_UNKNOWN;
+	reader->data = body;
+
+	const char *content_length = http_header_list_getn(request, HTTP_HEADER_NAME_CONTENT_LENGTH);
+	const char *transfer_encoding = http_header_list_getn(request, HTTP_HEADER_NAME_TRANSFER_ENCODING);
+	*error = HTTP_ERROR_MALFORMED_HEADERS;
+	if (transfer_encoding) {
+		/* a message with both is a sign of request smuggling (RFC 7230 Section 3.3.3) */
+		if (content_length)
+			return 0;
+		/* chunked is the only transfer coding that is supported */
+		if (strcasecmp(transfer_encoding, "chunked")) {
+			*error = HTTP_ERROR_UNSUPPORTED_TRANSFER_CODING;
+			return 0;
+		}
+		body->state = HTTP1_BODY_CHUNK_SIZE;
+	} else if (content_length) {
+		if (!http_parse_content_length(content_length, &body->remaining))
+			return 0;
+		reader->length = body->remaining;
+		if (body->remaining)
+			body->state = HTTP1_BODY_CONTENT_LENGTH;
+	}
+
+	const char *expect = http_header_list_getn(request, HTTP_HEADER_NAME_EXPECT);
+	if (expect) {
+		if (strcasecmp(expect, "100-continue")) {
+			*error = HTTP_ERROR_EXPECTATION_FAILED;
+			return 0;
+		}
+		body->expect_continue = body->state != HTTP1_BODY_END;
+	}
+
+	request->body = body->state == HTTP1_BODY_END ? NULL : reader;
+	return 1;
+}
+
+/* (boolean) discards the part of the body the handler didn't read, so the
+ * next request can be parsed */
+static int body_drain(http_body_reader_t *reader) {
+	char discarded[4096];
+	size_t total = 0;
+	int read;
+	while ((read = body_read(reader, discarded, sizeof(discarded))) > 0)
+		if ((total += read) > HTTP1_BODY_DRAIN_MAX)
+			return 0;
+	return read == 0;
+}
+
+/* Creates the header list of a complete request, the strings point into the buffer. */
+static http_header_list_t *request_create(http1_parser_t *parser, char *buffer) {
 	http_header_list_t *headers = http_create_header_list();
 	if (!headers)
 		return headers;
 	headers->version = HTTP_VERSION_1;
 
-	char *method = calloc(HTTP1_LONGEST_METHOD, sizeof(char));
-	char *path = calloc(HTTP_PATH_MAX - 1, sizeof(char));
-	char *version = calloc(HTTP_VERSION_MAX - 1, sizeof(char));
-
-	if (!method || !path || !version)
-		goto clean;
-	
-	/* parse method */
-	if (!method || !http_parse_method(tls, method, HTTP1_LONGEST_METHOD)) {
-		http_handle_error_gracefully(tls, HTTP_ERROR_UNSUPPORTED_METHOD, method, 0);
-		goto clean;
-	}
-	
-	/* parse path */
-	if (io_read_until(tls, path, ' ', HTTP_PATH_MAX - 1) <= 0) {
-		http_handle_error_gracefully(tls, HTTP_ERROR_INVALID_PATH, path, 0);
-		goto clean;
-	}
-	
-	/* parse version */
-	if (io_read_until(tls, version, '\r', HTTP_VERSION_MAX-1) <= 0 || strcmp(version, "HTTP/1.1")) {
-		printf("invalid version='%s'\n", version);
-		http_handle_error_gracefully(tls, HTTP_ERROR_INVALID_VERSION, version, 0);
-		goto clean;
-	}
-	
-	http_header_list_add(headers, ":method", method, HTTP_HEADER_NAME_CACHED, 0);
-	http_header_list_add(headers, ":path", path, HTTP_HEADER_NAME_CACHED, 0);
-	
-	/* remove the last '\n' character from the stream */
-	char end_character[1];
-	tls_read_client(tls, end_character, 1);
-	
-	size_t error = http_parse_headers(tls, headers);
-	
-	if (error) {
-		static const char *header_errors[] = { 
-			"HTTP_HEADER_PARSE_ERROR_NONE",
-			"HTTP_HEADER_PARSE_ERROR_MEMORY",
-			"HTTP_HEADER_PARSE_ERROR_READ",
-			"HTTP_HEADER_PARSE_ERROR_MAX",
-			"HTTP_HEADER_PARSE_ERROR_UNREGISTERED"
-		};
-		printf("[HTTP/1.1] Header Error: %s\n", header_errors[error]);
-		goto clean;
-	}
-
-	const char *hostv;
-	if (http_host_strict && (hostv = http_header_list_getd(headers, HEADER_AUTHORITY)) && strcmp(GLOBAL_SETTING_host, hostv)) {
-		http_handle_error_gracefully(tls, HTTP_ERROR_INVALID_HOST, version, 0);
-		goto clean;
-	}
-
-	free(version); /* TODO */
+	http1_parser_terminate(parser, buffer);
+	int success = http_header_list_add(headers, ":method", buffer + parser->method.start, HTTP_HEADER_CACHED, 0)
+		&& http_header_list_add(headers, ":path", buffer + parser->path.start, HTTP_HEADER_CACHED, 0);
+
+	size_t i;
+	for (i = 0; i < parser->header_count && success; i++) {
+		http1_header_slice_t *header = &parser->headers[i];
+		success = http_header_list_add(headers, buffer + header->name.start, buffer + header->value.start, HTTP_HEADER_CACHED, 0);
+	}
+
+	if (!success) {
+		puts("[HTTP/1.1] Failed to add header to list.");
+		http_destroy_header_list(headers);
+		return NULL;
+	}
 	return headers;
+}
+
+/* responds to a request that couldn't be parsed, the connection is closed afterwards */
+static void request_reject(transport_t *transport, http1_parse_status_t status) {
+	switch (status) {
+		case HTTP1_PARSE_ERROR_METHOD:
+			http_handle_error_gracefully(transport, HTTP_ERROR_UNSUPPORTED_METHOD, 0);
+			break;
+		case HTTP1_PARSE_ERROR_PATH:
+			http_handle_error_gracefully(transport, HTTP_ERROR_INVALID_PATH, 0);
+			break;
+		case HTTP1_PARSE_ERROR_VERSION:
+			http_handle_error_gracefully(transport, HTTP_ERROR_INVALID_VERSION, 0);
+			break;
+		case HTTP1_PARSE_ERROR_HEADER:
+			http_handle_error_gracefully(transport, HTTP_ERROR_MALFORMED_HEADERS, 0);
+			break;
+		case HTTP1_PARSE_ERROR_TOO_LARGE:
+			http_handle_error_gracefully(transport, HTTP_ERROR_HEADERS_TOO_LARGE, 0);
+			break;
+		default:
+			break;
+	}
+}
+
+/* (boolean) the comma-separated header value contains the token, case-insensitively */
+static int header_has_token(const char *value, const char *token) {
+	size_t length = strlen(token);
+	while (*value) {
+		while (*value == ' ' || *value == '\t' || *value == ',')
+			value++;
+		if (!strncasecmp(value, token, length)
+			&& (value[length] == 0 || value[length] == ',' || value[length] == ' ' || value[length] == '\t'))
+			return 1;
+		while (*value && *value != ',')
+			value++;
+	}
+	return 0;
+}
+
+/* (boolean) the connection can be reused after the response to this request */
+static int request_allows_keep_alive(http_header_list_t *request) {
+	const char *connection = http_header_list_getn(request, HTTP_HEADER_NAME_CONNECTION);
+	return !connection || !header_has_token(connection, "close");
+}
+
+/* (boolean) the part of the body the handler didn't read can be discarded
+ * after the response */
+static int body_allows_keep_alive(http1_body_t *body) {
+	switch (body->state) {
+		case HTTP1_BODY_END:
+			return 1;
+		case HTTP1_BODY_ERROR:
+			return 0;
+		case HTTP1_BODY_CONTENT_LENGTH:
+			/* the client doesn't know whether to send the body (RFC 7231 Section 5.1.1) */
+			return !body->expect_continue && body->remaining <= HTTP1_BODY_DRAIN_MAX;
+		default:
+			return !body->expect_continue;
+	}
+}
+
+/* sends the '103 Early Hints' of the handler before the response */
+static void h1_callback_early_hints(http_response_headers_t *headers, size_t app_data_len, void **application_data) {
+	transport_t *transport = (transport_t *) application_data[0];
+	char buffer[HTTP1_RESPONSE_HEAD_SIZE];
+	size_t length = http1_serialize_head(buffer, sizeof(buffer), headers, 0, 0);
+	/* the hints are only an optimization, they're left out when they don't fit */
+	if (length <= sizeof(buffer))
+		transport_write(transport, buffer, length);
+}
+
+void http1_handle(transport_t *transport) {
+	/* the receive buffer: the current request head, followed by its body and
+	 * pipelined requests */
+	char *buffer = malloc(HTTP1_REQUEST_HEAD_MAX + HTTP1_BODY_BUFFER_SIZE);
+	if (!buffer)
+		return;
+
+	http1_parser_t parser;
+	http1_body_t body;
+	http_body_reader_t body_reader;
+	HTTP_ERROR error;
+
+	void *application_data[1];
+	application_data[0] = transport;
+	handler_callbacks_t callbacks;
+	callbacks.application_data = application_data;
+	callbacks.application_data_length = 1;
+	callbacks.headers_ready = NULL;
+	callbacks.early_hints = h1_callback_early_hints;
+	callbacks.push = NULL;
+
+	body.transport = transport;
+	body.buffer = buffer;
+	size_t length = 0;
+	size_t count = 0;
+	int keep_alive = 1;
+	while (keep_alive) {
+		http1_parse_status_t status;
+		http1_parser_reset(&parser);
+		while ((status = http1_parser_parse(&parser, buffer, length)) == HTTP1_PARSE_INCOMPLETE) {
+			/* the first request was already (partly) received by transport_get_protocol */
+			if (count > 0 && length == 0 && !transport_wait_readable(transport, GLOBAL_SETTING_http1_keep_alive_timeout))
+				goto end;
+
+			int read = transport_read(transport, buffer + length, HTTP1_REQUEST_HEAD_MAX - length);
+			if (read <= 0)
+				goto end;
+			length += read;
+		}
+
+		if (status != HTTP1_PARSE_COMPLETE) {
+			request_reject(transport, status);
+			break;
+		}
+
+		http_header_list_t *request = request_create(&parser, buffer);
+		if (!request)
+			break;
+		count += 1;
+
+		/* the end of the request was sent before the handshake completed */
+		request->early_data = transport_in_early_data(transport);
+
+		const char *host;
+		if (http_host_strict && (host = http_header_list_getd(request, HEADER_AUTHORITY)) && strcmp(GLOBAL_SETTING_host, host)) {
+			http_handle_error_gracefully(transport, HTTP_ERROR_INVALID_HOST, 0);
+			http_destroy_header_list(request);
+			break;
+		}
+
+		body.start = body.position = parser.length;
+		body.length = length;
+		if (!body_setup(&body, &body_reader, request, &error)) {
+			http_handle_error_gracefully(transport, error, 0);
+			http_destroy_header_list(request);
+			break;
+		}
+
+		const char *method = buffer + parser.method.start;
+		http_response_t *response = http_handle_request(request, &callbacks);
+
+		keep_alive = count < GLOBAL_SETTING_http1_max_requests
+			&& !GLOBAL_SETTINGS_cancel_requested
+			&& request_allows_keep_alive(request)
+			&& body_allows_keep_alive(&body);
+
+		/* a body that couldn't be completed leaves the connection in an unknown state */
+		if (!http1_write_response(transport, response, !strcmp(method, "HEAD"), keep_alive)
+			|| (keep_alive && body.state != HTTP1_BODY_END && !body_drain(&body_reader)))
+			keep_alive = 0;
+		http_response_destroy(response);
+		http_destroy_header_list(request);
+
+		/* move the pipelined requests to the front */
+		length = body.length - body.position;
+		memmove(buffer, buffer + body.position, length);
+	}
 
-	/* the ("clean") label is only used when things go wrong */
-	clean:
-	free(version); /* TODO */
-	free(method);
-	free(path);
-	free(headers);
-	return NULL;
+	end:
+	free(buffer);
 }
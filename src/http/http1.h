@@ -6,11 +6,51 @@
 #define H1_H
 
 #include "common.h"
-#include "../secure/tlsutil.h"
+#include "../transport/transport.h"
 #include "header_list.h"
 
-http_header_list_t *http1_parse(TLS);
+/**
+ * Description:
+ *   Writes the response. The body isn't sent for HEAD requests, and a
+ *   'Connection: close' header is added when the connection won't be reused.
+ *   A body producer is sent with 'Transfer-Encoding: chunked', its writes are
+ *   coalesced into chunks of at most 'http1-chunk-size' bytes.
+ *
+ *   The head is serialized into one buffer (see response_serializer.h) and
+ *   written together with the body or the first chunk. A file body is sent
+ *   after the head with transport_sendfile.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport to write to.
+ *   http_response_t *
+ *     The response.
+ *   int
+ *     (boolean) the request method is HEAD.
+ *   int
+ *     (boolean) the connection is kept open after this response.
+ *
+ * Return Value:
+ *   (boolean) the whole response was written
+ */
+int http1_write_response(transport_t *, http_response_t *, int, int);
 
-void http1_write_response(TLS, http_response_t *);
+/**
+ * Description:
+ *   Serves the requests on a HTTP/1.1 connection until the client closes it,
+ *   asks to close it, is idle for 'http1-keep-alive-timeout' milliseconds or
+ *   has sent 'http1-max-requests' requests. Pipelined requests are handled in
+ *   order, since the parser never reads past the end of a request.
+ *
+ *   A request body (Content-Length or chunked) is read by the handler through
+ *   http_header_list_t.body; a '100 Continue' is sent when it starts reading.
+ *   What the handler doesn't read is discarded after the response, or the
+ *   connection is closed when that is more than a few KiB.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport of the connection.
+ */
+void http1_handle(transport_t *);
 
 #endif /*H1_H*/
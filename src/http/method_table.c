@@ -0,0 +1,138 @@
+/**
+ * Generated by tools/perfect-hash.c from src/http/methods.txt, don't edit.
+ * 39 words in 128 slots, seed 414.
+ */
+#include "method_table.h"
+
+#include <string.h>
+
+#include "utils/perfect_hash.h"
+
+const char *const http_method_words[HTTP_METHOD_COUNT] = {
+	"ACL",
+	"BASELINE-CONTROL",
+	"BIND",
+	"CHECKIN",
+	"CHECKOUT",
+	"CONNECT",
+	"COPY",
+	"DELETE",
+	"GET",
+	"HEAD",
+	"LABEL",
+	"LINK",
+	"LOCK",
+	"MERGE",
+	"MKACTIVITY",
+	"MKCALENDAR",
+	"MKCOL",
+	"MKREDIRECTREF",
+	"MKWORKSPACE",
+	"MOVE",
+	"OPTIONS",
+	"ORDERPATCH",
+	"PATCH",
+	"POST",
+	"PRI",
+	"PROPFIND",
+	"PROPPATCH",
+	"PUT",
+	"REBIND",
+	"REPORT",
+	"SEARCH",
+	"TRACE",
+	"UNBIND",
+	"UNCHECKOUT",
+	"UNLINK",
+	"UNLOCK",
+	"UPDATE",
+	"UPDATEREDIRECTREF",
+	"VERSION-CONTROL"
+};
+
+int http_method_lookup(const char *word, size_t length) {
+	if (length < 3 || length > 17)
+		return -1;
+	switch (perfect_hash(word, length, 414UL, 0) & 127UL) {
+		case 5:
+			return length == 7 && !memcmp(word, "CHECKIN", 7) ? 3 : -1;
+		case 9:
+			return length == 6 && !memcmp(word, "SEARCH", 6) ? 30 : -1;
+		case 12:
+			return length == 7 && !memcmp(word, "OPTIONS", 7) ? 20 : -1;
+		case 13:
+			return length == 6 && !memcmp(word, "DELETE", 6) ? 7 : -1;
+		case 17:
+			return length == 4 && !memcmp(word, "LOCK", 4) ? 12 : -1;
+		case 18:
+			return length == 6 && !memcmp(word, "REBIND", 6) ? 28 : -1;
+		case 23:
+			return length == 8 && !memcmp(word, "PROPFIND", 8) ? 25 : -1;
+		case 28:
+			return length == 4 && !memcmp(word, "BIND", 4) ? 2 : -1;
+		case 32:
+			return length == 3 && !memcmp(word, "PUT", 3) ? 27 : -1;
+		case 34:
+			return length == 6 && !memcmp(word, "UNLOCK", 6) ? 35 : -1;
+		case 40:
+			return length == 10 && !memcmp(word, "ORDERPATCH", 10) ? 21 : -1;
+		case 42:
+			return length == 3 && !memcmp(word, "GET", 3) ? 8 : -1;
+		case 49:
+			return length == 6 && !memcmp(word, "UNBIND", 6) ? 32 : -1;
+		case 50:
+			return length == 15 && !memcmp(word, "VERSION-CONTROL", 15) ? 38 : -1;
+		case 51:
+			return length == 5 && !memcmp(word, "MERGE", 5) ? 13 : -1;
+		case 52:
+			return length == 4 && !memcmp(word, "HEAD", 4) ? 9 : -1;
+		case 53:
+			return length == 8 && !memcmp(word, "CHECKOUT", 8) ? 4 : -1;
+		case 60:
+			return length == 5 && !memcmp(word, "MKCOL", 5) ? 16 : -1;
+		case 63:
+			return length == 10 && !memcmp(word, "MKACTIVITY", 10) ? 14 : -1;
+		case 69:
+			return length == 16 && !memcmp(word, "BASELINE-CONTROL", 16) ? 1 : -1;
+		case 70:
+			return length == 17 && !memcmp(word, "UPDATEREDIRECTREF", 17) ? 37 : -1;
+		case 76:
+			return length == 13 && !memcmp(word, "MKREDIRECTREF", 13) ? 17 : -1;
+		case 84:
+			return length == 5 && !memcmp(word, "TRACE", 5) ? 31 : -1;
+		case 85:
+			return length == 4 && !memcmp(word, "COPY", 4) ? 6 : -1;
+		case 86:
+			return length == 4 && !memcmp(word, "POST", 4) ? 23 : -1;
+		case 92:
+			return length == 5 && !memcmp(word, "LABEL", 5) ? 10 : -1;
+		case 93:
+			return length == 6 && !memcmp(word, "REPORT", 6) ? 29 : -1;
+		case 94:
+			return length == 10 && !memcmp(word, "MKCALENDAR", 10) ? 15 : -1;
+		case 95:
+			return length == 6 && !memcmp(word, "UNLINK", 6) ? 34 : -1;
+		case 96:
+			return length == 7 && !memcmp(word, "CONNECT", 7) ? 5 : -1;
+		case 99:
+			return length == 4 && !memcmp(word, "LINK", 4) ? 11 : -1;
+		case 106:
+			return length == 11 && !memcmp(word, "MKWORKSPACE", 11) ? 18 : -1;
+		case 109:
+			return length == 9 && !memcmp(word, "PROPPATCH", 9) ? 26 : -1;
+		case 111:
+			return length == 3 && !memcmp(word, "PRI", 3) ? 24 : -1;
+		case 112:
+			return length == 5 && !memcmp(word, "PATCH", 5) ? 22 : -1;
+		case 120:
+			return length == 10 && !memcmp(word, "UNCHECKOUT", 10) ? 33 : -1;
+		case 122:
+			return length == 6 && !memcmp(word, "UPDATE", 6) ? 36 : -1;
+		case 125:
+			return length == 3 && !memcmp(word, "ACL", 3) ? 0 : -1;
+		case 127:
+			return length == 4 && !memcmp(word, "MOVE", 4) ? 19 : -1;
+		default:
+			return -1;
+	}
+}
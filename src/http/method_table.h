@@ -0,0 +1,71 @@
+/**
+ * Generated by tools/perfect-hash.c from src/http/methods.txt, don't edit.
+ */
+#ifndef HTTP_METHOD_TABLE_H
+#define HTTP_METHOD_TABLE_H
+
+#include <stddef.h>
+
+#define HTTP_METHOD_COUNT 39
+#define HTTP_METHOD_LENGTH_MAX 17
+
+/* the indices of the words */
+#define HTTP_METHOD_ACL 0
+#define HTTP_METHOD_BASELINE_CONTROL 1
+#define HTTP_METHOD_BIND 2
+#define HTTP_METHOD_CHECKIN 3
+#define HTTP_METHOD_CHECKOUT 4
+#define HTTP_METHOD_CONNECT 5
+#define HTTP_METHOD_COPY 6
+#define HTTP_METHOD_DELETE 7
+#define HTTP_METHOD_GET 8
+#define HTTP_METHOD_HEAD 9
+#define HTTP_METHOD_LABEL 10
+#define HTTP_METHOD_LINK 11
+#define HTTP_METHOD_LOCK 12
+#define HTTP_METHOD_MERGE 13
+#define HTTP_METHOD_MKACTIVITY 14
+#define HTTP_METHOD_MKCALENDAR 15
+#define HTTP_METHOD_MKCOL 16
+#define HTTP_METHOD_MKREDIRECTREF 17
+#define HTTP_METHOD_MKWORKSPACE 18
+#define HTTP_METHOD_MOVE 19
+#define HTTP_METHOD_OPTIONS 20
+#define HTTP_METHOD_ORDERPATCH 21
+#define HTTP_METHOD_PATCH 22
+#define HTTP_METHOD_POST 23
+#define HTTP_METHOD_PRI 24
+#define HTTP_METHOD_PROPFIND 25
+#define HTTP_METHOD_PROPPATCH 26
+#define HTTP_METHOD_PUT 27
+#define HTTP_METHOD_REBIND 28
+#define HTTP_METHOD_REPORT 29
+#define HTTP_METHOD_SEARCH 30
+#define HTTP_METHOD_TRACE 31
+#define HTTP_METHOD_UNBIND 32
+#define HTTP_METHOD_UNCHECKOUT 33
+#define HTTP_METHOD_UNLINK 34
+#define HTTP_METHOD_UNLOCK 35
+#define HTTP_METHOD_UPDATE 36
+#define HTTP_METHOD_UPDATEREDIRECTREF 37
+#define HTTP_METHOD_VERSION_CONTROL 38
+
+/* the words, in the order of src/http/methods.txt */
+extern const char *const http_method_words[HTTP_METHOD_COUNT];
+
+/**
+ * Description:
+ *   Finds the word.
+ *
+ * Parameters:
+ *   const char *
+ *     The word, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the word.
+ *
+ * Return Value:
+ *   The index of the word in http_method_words, or -1
+ */
+int http_method_lookup(const char *, size_t);
+
+#endif /* HTTP_METHOD_TABLE_H */
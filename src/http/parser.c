@@ -7,43 +7,20 @@
 #include "parser.h"
 
 #include "../utils/io.h"
+#include "method_table.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
-/**
- * The list of valid HTTP/1x methods.
- *
- * Source:
- *   https://www.iana.org/assignments/http-methods/http-methods.xhtml
- *
- * Last Updated:
- *   In code:
- *     1/12/19
- *   By IANA:
- *     2017-04-14
- */
-static const char *iana_methods[] = { "ACL", "BASELINE-CONTROL", "BIND", "CHECKIN", "CHECKOUT", "CONNECT", "COPY", "DELETE", "GET", "HEAD", "LABEL", "LINK", "LOCK", "MERGE", "MKACTIVITY", "MKCALENDAR", "MKCOL", "MKREDIRECTREF", "MKWORKSPACE", "MOVE", "OPTIONS", "ORDERPATCH", "PATCH", "POST", "PRI", "PROPFIND", "PROPPATCH", "PUT", "REBIND", "REPORT", "SEARCH", "TRACE", "UNBIND", "UNCHECKOUT", "UNLINK", "UNLOCK", "UPDATE", "UPDATEREDIRECTREF", "VERSION-CONTROL" };
-
 int http_parser_setup() {
-	/* determine the max method length */
-	size_t method_max = 0, method_len, i;
-
-	for (i = 0; i < sizeof(iana_methods) / sizeof(iana_methods[0]); i++) {
-		method_len = strlen(iana_methods[i]);
-
-		if (method_len > method_max)
-			method_max = method_len;
-	}
-	HTTP1_LONGEST_METHOD = method_max + 1;
-
+	HTTP1_LONGEST_METHOD = HTTP_METHOD_LENGTH_MAX + 1;
 	return 1;
 }
 
-int http_parse_method(TLS source, char *dest, size_t size) {
-	/* read from TLS */
+int http_parse_method(transport_t *source, char *dest, size_t size) {
+	/* read from the transport */
 	if (io_read_until(source, dest, ' ', size) < 0) {
 		return 0;
 	}
@@ -56,18 +33,23 @@ int http_parse_method(TLS source, char *dest, size_t size) {
 		return 0;
 	}
 
-	size_t i;
-	for (i = 0; i < sizeof(iana_methods) / sizeof(iana_methods[0]); i++) {
-		if (!strcmp((const char *) dest, iana_methods[i])) {
-			return 1;
-		}
-	}
+	if (http_method_is_registered(dest, strlen(dest)))
+		return 1;
 
 	printf("[HTTP/1x] [Parser] Invalid HTTP/1.1 method: '%s'\n", dest);
 	return 0;
 }
 
-size_t http_parse_headers(TLS tls, http_header_list_t *headers) {
+int http_method_is_registered(const char *method, size_t length) {
+	/* the registered methods are in methods.txt */
+	return http_method_lookup(method, length) >= 0;
+}
+
+int http_method_is_safe(const char *method) {
+	return method && (!strcmp(method, "GET") || !strcmp(method, "HEAD") || !strcmp(method, "OPTIONS"));
+}
+
+size_t http_parse_headers(transport_t *transport, http_header_list_t *headers) {
 	char *key_buffer = calloc(HTTP_HEADERS_KEY_MAX_LENGTH, sizeof(char));
 	char *value_buffer = calloc(HTTP_HEADERS_VALUE_MAX_LENGTH, sizeof(char));
 
@@ -80,7 +62,7 @@ size_t http_parse_headers(TLS tls, http_header_list_t *headers) {
 
 	int read;
 	while (1) {
-		if (!tls_read_client_complete(tls, key_buffer, 2))
+		if (!transport_read_complete(transport, key_buffer, 2))
 			break;
 
 		if (key_buffer[0] == '\r' && key_buffer[1] == '\n') {
@@ -88,7 +70,7 @@ size_t http_parse_headers(TLS tls, http_header_list_t *headers) {
 			goto end;
 		}
 
-		if ((read = io_read_until(tls, key_buffer+2, ':', HTTP_HEADERS_KEY_MAX_LENGTH-2)) < 0) {
+		if ((read = io_read_until(transport, key_buffer+2, ':', HTTP_HEADERS_KEY_MAX_LENGTH-2)) < 0) {
 			error = HTTP_PARSER_ERROR_READ;
 			goto end;
 		}
@@ -106,7 +88,7 @@ size_t http_parse_headers(TLS tls, http_header_list_t *headers) {
 		}
 
 		/* read header value */
-		if ((read = io_read_until(tls, value_buffer, '\n', HTTP_HEADERS_VALUE_MAX_LENGTH)) < 0) {
+		if ((read = io_read_until(transport, value_buffer, '\n', HTTP_HEADERS_VALUE_MAX_LENGTH)) < 0) {
 			free(key);
 			printf("value_buffer read: %i\n", read);
 			error = HTTP_PARSER_ERROR_READ;
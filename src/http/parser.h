@@ -7,7 +7,7 @@
 #ifndef HTTP_PARSER_H
 #define HTTP_PARSER_H
 
-#include "../secure/tlsutil.h"
+#include "../transport/transport.h"
 #include "common.h"
 #include "header_list.h"
 
@@ -40,8 +40,8 @@ int http_parser_setup();
  *   This function will parse the HTTP/1.1 method and will check the validity of the method.
  * 
  * Parameters:
- *   TLS
- *     The TLS source to be read from.
+ *   transport_t *
+ *     The transport to be read from.
  *   char *
  *     The destination buffer.
  *   size_t
@@ -52,15 +52,30 @@ int http_parser_setup();
  *    0 I/O failure
  *    1 success
  */
-int http_parse_method(TLS, char *, size_t);
+int http_parse_method(transport_t *, char *, size_t);
+
+/**
+ * Description:
+ *   Checks if the method is registered by IANA.
+ * 
+ * Parameters:
+ *   const char *
+ *     The method, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the method.
+ * 
+ * Return value:
+ *   (boolean) is registered
+ */
+int http_method_is_registered(const char *, size_t);
 
 /**
  * Description:
  *   This function will parse the headers from the source.
  * 
  * Parameters:
- *   TLS
- *     The TLS source to be read from.
+ *   transport_t *
+ *     The transport to be read from.
  *   http_header_list_t
  *     The headers map.
  * 
@@ -76,6 +91,20 @@ int http_parse_method(TLS, char *, size_t);
  *   |   4   | Unregistered header |
  *   |-------|---------------------|
  */
-size_t http_parse_headers(TLS, http_header_list_t *);
+size_t http_parse_headers(transport_t *, http_header_list_t *);
+
+/**
+ * Description:
+ *   Checks if the method is safe (RFC 7231 section 4.2.1), so a request with
+ *   this method can be repeated without side effects.
+ *
+ * Parameters:
+ *   const char *
+ *     (Nullable) The method.
+ *
+ * Return Value:
+ *   (boolean) is safe
+ */
+int http_method_is_safe(const char *);
 
 #endif /* HTTP_PARSER_H */
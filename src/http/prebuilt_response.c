@@ -0,0 +1,136 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see prebuilt_response.h
+ */
+#include "prebuilt_response.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "http2/hpack.h"
+#include "response_serializer.h"
+
+static const char day_names[] = "SunMonTueWedThuFriSat";
+static const char month_names[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+static void write_two_digits(char *destination, unsigned value) {
+	destination[0] = '0' + value / 10;
+	destination[1] = '0' + value % 10;
+}
+
+void http_date_write(char *destination, time_t time) {
+	/* gmtime isn't used: this is called for every prebuilt response, and the
+	 * conversion of the days to a date is cheap (see Howard Hinnant's
+	 * civil_from_days) */
+	unsigned long days = (unsigned long) time / 86400;
+	unsigned long seconds = (unsigned long) time % 86400;
+	unsigned long z = days + 719468;
+	unsigned long era = z / 146097;
+	unsigned long day_of_era = z - era * 146097;
+	unsigned long year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+	unsigned long day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+	unsigned long month_index = (5 * day_of_year + 2) / 153;
+	unsigned long day = day_of_year - (153 * month_index + 2) / 5 + 1;
+	unsigned long month = month_index < 10 ? month_index + 3 : month_index - 9;
+	unsigned long year = year_of_era + era * 400 + (month <= 2);
+
+	memcpy(destination, day_names + (days + 4) % 7 * 3, 3);
+	memcpy(destination + 3, ", ", 2);
+	write_two_digits(destination + 5, day);
+	destination[7] = ' ';
+	memcpy(destination + 8, month_names + (month - 1) * 3, 3);
+	destination[11] = ' ';
+	write_two_digits(destination + 12, year / 100 % 100);
+	write_two_digits(destination + 14, year % 100);
+	destination[16] = ' ';
+	write_two_digits(destination + 17, seconds / 3600);
+	destination[19] = ':';
+	write_two_digits(destination + 20, seconds / 60 % 60);
+	destination[22] = ':';
+	write_two_digits(destination + 23, seconds % 60);
+	memcpy(destination + 25, " GMT", 4);
+}
+
+/* the offset of the last occurrence of the placeholder date, or 0 */
+static size_t find_date(const char *data, size_t length, const char *date) {
+	size_t i;
+	for (i = length; i >= HTTP_DATE_LENGTH; i--)
+		if (!memcmp(data + i - HTTP_DATE_LENGTH, date, HTTP_DATE_LENGTH))
+			return i - HTTP_DATE_LENGTH;
+	return 0;
+}
+
+/* (boolean) renders the HTTP/1.1 image */
+static int render_http1(http_prebuilt_response_t *response, int close, http_response_headers_t *headers,
+		const char *body, size_t body_length, const char *date) {
+	size_t head_length = http1_serialize_head(NULL, 0, headers, close, 0);
+	char *image = malloc(head_length + body_length);
+	if (!image)
+		return 0;
+	http1_serialize_head(image, head_length, headers, close, 0);
+	memcpy(image + head_length, body, body_length);
+
+	response->http1[close] = image;
+	response->http1_length[close] = head_length + body_length;
+	response->http1_head_length[close] = head_length;
+	response->http1_date[close] = find_date(image, head_length, date);
+	return response->http1_date[close] != 0;
+}
+
+http_prebuilt_response_t *http_prebuilt_response_create(http_response_headers_t *headers, const char *body, size_t body_length) {
+	/* the date of the epoch is the placeholder, it is found in the images */
+	char date[HTTP_DATE_LENGTH + 1];
+	http_date_write(date, 0);
+	date[HTTP_DATE_LENGTH] = 0;
+	if (!http_response_headers_add(headers, HTTP_RH_DATE, date))
+		return NULL;
+
+	http_prebuilt_response_t *response = calloc(1, sizeof(http_prebuilt_response_t));
+	if (!response)
+		return NULL;
+
+	if (!render_http1(response, 0, headers, body, body_length, date)
+		|| !render_http1(response, 1, headers, body, body_length, date)
+		|| !(response->hpack = write_headers(headers, &response->hpack_length))
+		|| !(response->hpack_date = find_date(response->hpack, response->hpack_length, date))) {
+		puts("[Prebuilt] Failed to render a response.");
+		http_prebuilt_response_destroy(response);
+		return NULL;
+	}
+	return response;
+}
+
+void http_prebuilt_response_destroy(http_prebuilt_response_t *response) {
+	if (!response)
+		return;
+	free(response->http1[0]);
+	free(response->http1[1]);
+	free(response->hpack);
+	free(response);
+}
+
+int http1_write_prebuilt(transport_t *transport, const http_prebuilt_response_t *response, int head, int close) {
+	char date[HTTP_DATE_LENGTH];
+	http_date_write(date, time(NULL));
+
+	/* the image is shared by the threads, so the date is written around it */
+	close = close ? 1 : 0;
+	size_t offset = response->http1_date[close];
+	size_t length = head ? response->http1_head_length[close] : response->http1_length[close];
+	struct iovec parts[3];
+	parts[0].iov_base = response->http1[close];
+	parts[0].iov_len = offset;
+	parts[1].iov_base = date;
+	parts[1].iov_len = HTTP_DATE_LENGTH;
+	parts[2].iov_base = response->http1[close] + offset + HTTP_DATE_LENGTH;
+	parts[2].iov_len = length - offset - HTTP_DATE_LENGTH;
+	return transport_writev(transport, parts, 3);
+}
+
+void http2_copy_prebuilt(char *destination, const http_prebuilt_response_t *response) {
+	memcpy(destination, response->hpack, response->hpack_length);
+	http_date_write(destination + response->hpack_date, time(NULL));
+}
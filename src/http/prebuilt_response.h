@@ -0,0 +1,110 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the prebuilt responses: responses that never change
+ * (error pages and other fallback responses) are rendered once into the bytes
+ * HTTP/1.1 sends and into the HPACK header block HTTP/2 sends. Only the Date
+ * is written into them when they are sent, so sending one costs about as much
+ * as a single write.
+ */
+#ifndef HTTP_PREBUILT_RESPONSE_H
+#define HTTP_PREBUILT_RESPONSE_H
+
+#include <stddef.h>
+#include <time.h>
+
+#include "response_headers.h"
+#include "../transport/transport.h"
+
+/* The length of a date in the IMF-fixdate format, e.g.
+ * 'Sun, 06 Nov 1994 08:49:37 GMT' (RFC 7231 Section 7.1.1.1). */
+#define HTTP_DATE_LENGTH 29
+
+typedef struct http_prebuilt_response_t {
+	/* the HTTP/1.1 heads followed by the body, [0] with keep-alive and [1]
+	 * with 'Connection: close' */
+	char *http1[2];
+	size_t http1_length[2];
+	size_t http1_head_length[2];
+	/* the offset of the date in the images */
+	size_t http1_date[2];
+
+	/* the HPACK header block, the body isn't part of it */
+	char *hpack;
+	size_t hpack_length;
+	size_t hpack_date;
+} http_prebuilt_response_t;
+
+/**
+ * Description:
+ *   Writes the date in the IMF-fixdate format, without a null-terminator.
+ *
+ * Parameters:
+ *   char *
+ *     The destination, of at least HTTP_DATE_LENGTH bytes.
+ *   time_t
+ *     The time.
+ */
+void http_date_write(char *, time_t);
+
+/**
+ * Description:
+ *   Renders a response, a Date header is added to the headers. This should be
+ *   called after http1_serializer_setup.
+ *
+ * Parameters:
+ *   http_response_headers_t *
+ *     The headers, starting with the status, without a Date.
+ *   const char *
+ *     The body, it isn't copied for HTTP/2, so it must outlive the response.
+ *   size_t
+ *     The length of the body.
+ *
+ * Return Value:
+ *   The prebuilt response, or NULL on failure.
+ */
+http_prebuilt_response_t *http_prebuilt_response_create(http_response_headers_t *, const char *, size_t);
+
+/**
+ * Description:
+ *   Destroys the prebuilt response.
+ *
+ * Parameters:
+ *   http_prebuilt_response_t *
+ *     (Nullable) The response.
+ */
+void http_prebuilt_response_destroy(http_prebuilt_response_t *);
+
+/**
+ * Description:
+ *   Writes the HTTP/1.1 image of the response with the current date.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport.
+ *   const http_prebuilt_response_t *
+ *     The response.
+ *   int
+ *     (boolean) only the head is written, for a HEAD request.
+ *   int
+ *     (boolean) the 'Connection: close' image is written.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int http1_write_prebuilt(transport_t *, const http_prebuilt_response_t *, int, int);
+
+/**
+ * Description:
+ *   Copies the HPACK header block of the response with the current date.
+ *
+ * Parameters:
+ *   char *
+ *     The destination, of at least 'hpack_length' bytes.
+ *   const http_prebuilt_response_t *
+ *     The response.
+ */
+void http2_copy_prebuilt(char *, const http_prebuilt_response_t *);
+
+#endif /* HTTP_PREBUILT_RESPONSE_H */
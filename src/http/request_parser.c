@@ -0,0 +1,182 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see request_parser.h
+ */
+#include "request_parser.h"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__AVX2__))
+	#include <immintrin.h>
+#endif
+
+#include "parser.h"
+
+static const char http1_version[] = "HTTP/1.1";
+
+size_t http1_find_byte(const char *data, size_t length, char byte) {
+	size_t i = 0;
+#if defined(__GNUC__) && defined(__AVX2__)
+	__m256i needle32 = _mm256_set1_epi8(byte);
+	for (; i + 32 <= length; i += 32) {
+		__m256i chunk = _mm256_loadu_si256((const __m256i *) (data + i));
+		unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle32));
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#endif
+#if defined(__GNUC__) && defined(__SSE2__)
+	__m128i needle16 = _mm_set1_epi8(byte);
+	for (; i + 16 <= length; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (data + i));
+		unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle16));
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#endif
+	for (; i < length; i++)
+		if (data[i] == byte)
+			return i;
+	return length;
+}
+
+void http1_parser_reset(http1_parser_t *parser) {
+	parser->position = 0;
+	parser->line = 0;
+	parser->in_headers = 0;
+	parser->header_count = 0;
+	parser->length = 0;
+}
+
+static int is_whitespace(char character) {
+	return character == ' ' || character == '\t';
+}
+
+/* tchar (RFC 7230 Section 3.2.6), indexed by byte */
+static const unsigned char token_table[256] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	/*   ! " # $ % & ' ( ) * + , - . / */
+	0,1,0,1,1,1,1,1,0,0,1,1,0,1,1,0,
+	/* 0-9 : ; < = > ? */
+	1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+	/* @ A-O */
+	0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	/* P-Z [ \ ] ^ _ */
+	1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,
+	/* ` a-o */
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	/* p-z { | } ~ DEL */
+	1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,0
+};
+
+/* method SP path SP version */
+static http1_parse_status_t parse_request_line(http1_parser_t *parser, const char *buffer, size_t start, size_t end) {
+	const char *line = buffer + start;
+	size_t length = end - start;
+
+	size_t method_end = http1_find_byte(line, length, ' ');
+	if (method_end == 0 || method_end == length || !http_method_is_registered(line, method_end))
+		return HTTP1_PARSE_ERROR_METHOD;
+
+	size_t path_start = method_end + 1;
+	size_t path_end = path_start + http1_find_byte(line + path_start, length - path_start, ' ');
+	if (path_end == path_start || path_end == length || path_end - path_start >= HTTP_PATH_MAX)
+		return HTTP1_PARSE_ERROR_PATH;
+
+	size_t version_start = path_end + 1;
+	if (length - version_start != sizeof(http1_version) - 1 || memcmp(line + version_start, http1_version, sizeof(http1_version) - 1))
+		return HTTP1_PARSE_ERROR_VERSION;
+
+	parser->method.start = start;
+	parser->method.length = method_end;
+	parser->path.start = start + path_start;
+	parser->path.length = path_end - path_start;
+	parser->version.start = start + version_start;
+	parser->version.length = length - version_start;
+	parser->in_headers = 1;
+	return HTTP1_PARSE_INCOMPLETE;
+}
+
+/* name ":" OWS value OWS */
+static http1_parse_status_t parse_header_line(http1_parser_t *parser, const char *buffer, size_t start, size_t end) {
+	const char *line = buffer + start;
+	size_t length = end - start;
+
+	/* obsolete line folding (RFC 7230 Section 3.2.4) isn't supported */
+	if (is_whitespace(line[0]) || parser->header_count == HTTP_HEADERS_MAX)
+		return HTTP1_PARSE_ERROR_HEADER;
+
+	size_t colon = http1_find_byte(line, length, ':');
+	if (colon == 0 || colon == length)
+		return HTTP1_PARSE_ERROR_HEADER;
+
+	size_t i;
+	for (i = 0; i < colon; i++)
+		if (!token_table[(unsigned char) line[i]])
+			return HTTP1_PARSE_ERROR_HEADER;
+
+	size_t value_start = colon + 1;
+	while (value_start < length && is_whitespace(line[value_start]))
+		value_start++;
+	size_t value_end = length;
+	while (value_end > value_start && is_whitespace(line[value_end - 1]))
+		value_end--;
+
+	http1_header_slice_t *header = &parser->headers[parser->header_count++];
+	header->name.start = start;
+	header->name.length = colon;
+	header->value.start = start + value_start;
+	header->value.length = value_end - value_start;
+	return HTTP1_PARSE_INCOMPLETE;
+}
+
+http1_parse_status_t http1_parser_parse(http1_parser_t *parser, const char *buffer, size_t length) {
+	while (parser->position < length) {
+		size_t line_feed = parser->position + http1_find_byte(buffer + parser->position, length - parser->position, '\n');
+		if (line_feed == length)
+			break;
+
+		size_t start = parser->line;
+		size_t end = line_feed > start && buffer[line_feed - 1] == '\r' ? line_feed - 1 : line_feed;
+		parser->position = parser->line = line_feed + 1;
+
+		http1_parse_status_t status;
+		if (!parser->in_headers) {
+			/* empty lines before the request line should be ignored (RFC 7230 Section 3.5) */
+			if (end == start)
+				continue;
+			status = parse_request_line(parser, buffer, start, end);
+		} else if (end == start) {
+			parser->length = line_feed + 1;
+			return HTTP1_PARSE_COMPLETE;
+		} else {
+			status = parse_header_line(parser, buffer, start, end);
+		}
+
+		if (status != HTTP1_PARSE_INCOMPLETE)
+			return status;
+	}
+
+	parser->position = length;
+	return length >= HTTP1_REQUEST_HEAD_MAX ? HTTP1_PARSE_ERROR_TOO_LARGE : HTTP1_PARSE_INCOMPLETE;
+}
+
+void http1_parser_terminate(http1_parser_t *parser, char *buffer) {
+	/* every slice is followed by a delimiter (' ', ':', '\r' or '\n') that isn't needed anymore */
+	buffer[parser->method.start + parser->method.length] = 0;
+	buffer[parser->path.start + parser->path.length] = 0;
+	buffer[parser->version.start + parser->version.length] = 0;
+
+	size_t i, j;
+	for (i = 0; i < parser->header_count; i++) {
+		http1_header_slice_t *header = &parser->headers[i];
+		char *name = buffer + header->name.start;
+		for (j = 0; j < header->name.length; j++)
+			if (name[j] >= 'A' && name[j] <= 'Z')
+				name[j] |= 0x20;
+		name[header->name.length] = 0;
+		buffer[header->value.start + header->value.length] = 0;
+	}
+}
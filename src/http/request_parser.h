@@ -0,0 +1,116 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the incremental HTTP/1.1 request parser. The parser
+ * works on the receive buffer of the connection: it doesn't copy anything,
+ * but records where the method, path, version and header names and values
+ * are in the buffer. When a request is split across reads, the parser is
+ * called again with the longer buffer and continues where it stopped, so
+ * every byte is scanned only once.
+ */
+#ifndef HTTP_REQUEST_PARSER_H
+#define HTTP_REQUEST_PARSER_H
+
+#include <stddef.h>
+
+#include "common.h"
+
+/* The maximum size of a request line + headers, this is also the size of the
+ * receive buffer of a HTTP/1.1 connection. */
+#define HTTP1_REQUEST_HEAD_MAX 16384
+
+typedef enum {
+	/* more data is needed */
+	HTTP1_PARSE_INCOMPLETE,
+	/* the request head ends at 'http1_parser_t.length' */
+	HTTP1_PARSE_COMPLETE,
+	HTTP1_PARSE_ERROR_METHOD,
+	HTTP1_PARSE_ERROR_PATH,
+	HTTP1_PARSE_ERROR_VERSION,
+	/* a malformed header line, or too many headers */
+	HTTP1_PARSE_ERROR_HEADER,
+	/* the request head doesn't fit in HTTP1_REQUEST_HEAD_MAX bytes */
+	HTTP1_PARSE_ERROR_TOO_LARGE
+} http1_parse_status_t;
+
+/* A part of the buffer. Offsets are used instead of pointers, so the buffer
+ * can be moved. */
+typedef struct {
+	size_t start;
+	size_t length;
+} http1_slice_t;
+
+typedef struct {
+	http1_slice_t name;
+	http1_slice_t value;
+} http1_header_slice_t;
+
+typedef struct {
+	/* where scanning for the end of the line continues */
+	size_t position;
+	/* the start of the line that is being parsed */
+	size_t line;
+	/* (boolean) the request line has been parsed */
+	int in_headers;
+
+	http1_slice_t method;
+	http1_slice_t path;
+	http1_slice_t version;
+	http1_header_slice_t headers[HTTP_HEADERS_MAX];
+	size_t header_count;
+
+	/* the length of the request head, including the empty line, when complete */
+	size_t length;
+} http1_parser_t;
+
+/**
+ * Description:
+ *   Prepares the parser for a new request, at the start of the buffer.
+ */
+void http1_parser_reset(http1_parser_t *);
+
+/**
+ * Description:
+ *   Parses the request head in the buffer. The buffer should contain
+ *   everything that was passed before, followed by new data; the parser
+ *   continues at the line it stopped at.
+ *
+ * Parameters:
+ *   http1_parser_t *
+ *     The parser.
+ *   const char *
+ *     The buffer.
+ *   size_t
+ *     The amount of bytes in the buffer.
+ *
+ * Return Value:
+ *   The status, see http1_parse_status_t
+ */
+http1_parse_status_t http1_parser_parse(http1_parser_t *, const char *, size_t);
+
+/**
+ * Description:
+ *   Null-terminates the slices of a complete request in the buffer, and
+ *   lowercases the header names. The delimiters after the slices are
+ *   overwritten, so the strings can be used without copying them.
+ *
+ * Parameters:
+ *   http1_parser_t *
+ *     The parser, after HTTP1_PARSE_COMPLETE.
+ *   char *
+ *     The buffer.
+ */
+void http1_parser_terminate(http1_parser_t *, char *);
+
+/**
+ * Description:
+ *   Finds the first occurrence of a byte, using SSE2 or AVX2 when the build
+ *   targets it.
+ *
+ * Return Value:
+ *   The index of the byte, or the length if it isn't found.
+ */
+size_t http1_find_byte(const char *, size_t, char);
+
+#endif /* HTTP_REQUEST_PARSER_H */
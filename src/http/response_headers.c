@@ -4,19 +4,29 @@
  */
 #include "response_headers.h"
 #include "../utils/util.h"
+#include "base/global_settings.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 #define SIZE_INCREASE_STEP_SIZE 2
 
 const char *http_rhnames[] = {
+	"HTTP/1.1 103 Early Hints\r\n",
 	"HTTP/1.1 200 OK\r\n",
 	"HTTP/1.1 204 No Content\r\n",
 	"HTTP/1.1 304 Not Modified\r\n",
 	"HTTP/1.1 400 Bad Request\r\n",
 	"HTTP/1.1 404 Not Found\r\n",
+	"HTTP/1.1 405 Method Not Allowed\r\n",
+	"HTTP/1.1 413 Payload Too Large\r\n",
+	"HTTP/1.1 414 URI Too Long\r\n",
+	"HTTP/1.1 417 Expectation Failed\r\n",
+	"HTTP/1.1 425 Too Early\r\n",
+	"HTTP/1.1 431 Request Header Fields Too Large\r\n",
 	"HTTP/1.1 500 Internal Server Error\r\n",
+	"HTTP/1.1 501 Not Implemented\r\n",
 	"HTTP/1.1 503 Service Unavailable\r\n",
+	"HTTP/1.1 505 HTTP Version Not Supported\r\n",
 	"Content-Length: ",
 	"Content-Type: ",
 	"Date: ",
@@ -25,7 +35,10 @@ const char *http_rhnames[] = {
 	"Vary: ",
 	"Content-Encoding: ",
 	"Strict-Transport-Security: ",
-	"Last-Modified: "
+	"Last-Modified: ",
+	"Allow: ",
+	"Link: ",
+	"Set-Cookie: "
 };
 
 http_response_headers_t *http_create_response_headers(size_t initial_size) {
@@ -84,3 +97,18 @@ int http_response_headers_add(http_response_headers_t *list, http_response_heade
 	list->headers[list->count++] = header;
 	return 1;
 }
+
+const char *http_response_header_value(const http_response_header_t *header) {
+	if (header->value)
+		return header->value;
+	switch (header->name) {
+		case HTTP_RH_SERVER:
+			return GLOBAL_SETTING_server_name;
+		case HTTP_RH_STRICT_TRANSPORT_SECURITY:
+			return GLOBAL_SETTING_HEADER_sts;
+		case HTTP_RH_TK:
+			return GLOBAL_SETTING_HEADER_tk;
+		default:
+			return NULL;
+	}
+}
@@ -18,16 +18,25 @@
  * first "normal" header, since statuses should be at 
  * the end as they are special; they are not headers in
  * HTTP < 2 */
-#define HTTP_RH_STATUSES 7
+#define HTTP_RH_STATUSES 16
 
 typedef enum {
+	HTTP_RH_STATUS_103,
 	HTTP_RH_STATUS_200,
 	HTTP_RH_STATUS_204,
 	HTTP_RH_STATUS_304,
 	HTTP_RH_STATUS_400,
 	HTTP_RH_STATUS_404,
+	HTTP_RH_STATUS_405,
+	HTTP_RH_STATUS_413,
+	HTTP_RH_STATUS_414,
+	HTTP_RH_STATUS_417,
+	HTTP_RH_STATUS_425,
+	HTTP_RH_STATUS_431,
 	HTTP_RH_STATUS_500,
+	HTTP_RH_STATUS_501,
 	HTTP_RH_STATUS_503,
+	HTTP_RH_STATUS_505,
 	HTTP_RH_CONTENT_LENGTH,
 	HTTP_RH_CONTENT_TYPE,
 	HTTP_RH_DATE,
@@ -36,7 +45,12 @@ typedef enum {
 	HTTP_RH_VARY,
 	HTTP_RH_CONTENT_ENCODING,
 	HTTP_RH_STRICT_TRANSPORT_SECURITY,
-	HTTP_RH_LAST_MODIFIED
+	HTTP_RH_LAST_MODIFIED,
+	HTTP_RH_ALLOW,
+	HTTP_RH_LINK,
+	HTTP_RH_SET_COOKIE,
+	/* the amount of names, not a header */
+	HTTP_RH_COUNT
 } http_response_header_name;
 
 /* These are the text representation for HTTP/1.1 of the enums above,
@@ -45,6 +59,8 @@ extern const char *http_rhnames[];
 
 typedef struct {
 	http_response_header_name name;
+	/* NULL for statuses, and for the Server, Strict-Transport-Security and Tk
+	 * headers with the configured value, see http_response_header_value */
 	char *value;
 } http_response_header_t;
 
@@ -97,4 +113,15 @@ void http_response_headers_destroy(http_response_headers_t *);
  */
 int http_response_headers_add(http_response_headers_t *, http_response_header_name, const char *);
 
+/**
+ * Description:
+ *   Gets the value of a header. Server, Strict-Transport-Security and Tk
+ *   headers that were added without a value have the value of the
+ *   configuration, so HTTP/1.1 can use the lines rendered at startup.
+ *
+ * Return Value:
+ *   The value, or NULL for statuses.
+ */
+const char *http_response_header_value(const http_response_header_t *);
+
 #endif /* HTTP_RESPONSE_HEADERS_H */
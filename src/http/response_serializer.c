@@ -0,0 +1,94 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see response_serializer.h
+ */
+#include "response_serializer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char connection_close[] = "Connection: close\r\n";
+static const char transfer_encoding_chunked[] = "Transfer-Encoding: chunked\r\n";
+
+/* the lengths of http_rhnames */
+static size_t name_lengths[HTTP_RH_COUNT];
+/* the complete lines of the headers with a configured value, or NULL */
+static char *rendered[HTTP_RH_COUNT];
+static size_t rendered_lengths[HTTP_RH_COUNT];
+
+/* (boolean) renders "name: value\r\n", a header that isn't configured isn't rendered */
+static int render(http_response_header_name name) {
+	http_response_header_t header;
+	header.name = name;
+	header.value = NULL;
+	const char *value = http_response_header_value(&header);
+	if (!value)
+		return 1;
+
+	size_t value_length = strlen(value);
+	rendered_lengths[name] = name_lengths[name] + value_length + 2;
+	rendered[name] = malloc(rendered_lengths[name]);
+	if (!rendered[name])
+		return 0;
+	memcpy(rendered[name], http_rhnames[name], name_lengths[name]);
+	memcpy(rendered[name] + name_lengths[name], value, value_length);
+	memcpy(rendered[name] + name_lengths[name] + value_length, "\r\n", 2);
+	return 1;
+}
+
+int http1_serializer_setup(void) {
+	size_t i;
+	for (i = 0; i < HTTP_RH_COUNT; i++)
+		name_lengths[i] = strlen(http_rhnames[i]);
+
+	if (render(HTTP_RH_SERVER) && render(HTTP_RH_STRICT_TRANSPORT_SECURITY) && render(HTTP_RH_TK))
+		return 1;
+	http1_serializer_destroy();
+	return 0;
+}
+
+void http1_serializer_destroy(void) {
+	size_t i;
+	for (i = 0; i < HTTP_RH_COUNT; i++) {
+		free(rendered[i]);
+		rendered[i] = NULL;
+	}
+}
+
+/* copies the data if it fits, the new length is returned either way */
+static size_t append(char *buffer, size_t size, size_t length, const char *data, size_t data_length) {
+	if (length + data_length <= size)
+		memcpy(buffer + length, data, data_length);
+	return length + data_length;
+}
+
+size_t http1_serialize_head(char *buffer, size_t size, const http_response_headers_t *headers, int close, int chunked) {
+	size_t length = 0;
+	size_t i;
+	for (i = 0; i < headers->count; i++) {
+		const http_response_header_t *header = headers->headers[i];
+		if (header->name < HTTP_RH_STATUSES) {
+			if (i != 0)
+				printf("[HTTP/1.1] Warning: Status line not first header! Index=%zu\n", i);
+			length = append(buffer, size, length, http_rhnames[header->name], name_lengths[header->name]);
+		} else if (!header->value && rendered[header->name]) {
+			length = append(buffer, size, length, rendered[header->name], rendered_lengths[header->name]);
+		} else {
+			const char *value = http_response_header_value(header);
+			if (!value)
+				continue;
+			length = append(buffer, size, length, http_rhnames[header->name], name_lengths[header->name]);
+			length = append(buffer, size, length, value, strlen(value));
+			length = append(buffer, size, length, "\r\n", 2);
+		}
+	}
+
+	if (close)
+		length = append(buffer, size, length, connection_close, sizeof(connection_close) - 1);
+	if (chunked)
+		length = append(buffer, size, length, transfer_encoding_chunked, sizeof(transfer_encoding_chunked) - 1);
+	return append(buffer, size, length, "\r\n", 2);
+}
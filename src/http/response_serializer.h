@@ -0,0 +1,62 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the serializer of HTTP/1.1 response heads. The status
+ * line and the headers are copied into one buffer in one pass, so the head
+ * can be written together with the body. The lines of the headers with a
+ * value from the configuration (Server, Strict-Transport-Security and Tk)
+ * are rendered once by http1_serializer_setup.
+ */
+#ifndef HTTP_RESPONSE_SERIALIZER_H
+#define HTTP_RESPONSE_SERIALIZER_H
+
+#include <stddef.h>
+
+#include "response_headers.h"
+
+/* The size of the buffer on the stack a response head is serialized into,
+ * a larger head is serialized again into an allocated buffer. */
+#define HTTP1_RESPONSE_HEAD_SIZE 1024
+
+/**
+ * Description:
+ *   Renders the lines of the configured headers, this should be called after
+ *   GLOBAL_SETTINGS_load.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int http1_serializer_setup(void);
+
+/**
+ * Description:
+ *   Destroys the lines rendered by http1_serializer_setup.
+ */
+void http1_serializer_destroy(void);
+
+/**
+ * Description:
+ *   Serializes the status line and the headers, followed by the empty line.
+ *   Nothing is written past 'size' bytes; when the return value is larger
+ *   than 'size', the head should be serialized again into a buffer of that
+ *   size.
+ *
+ * Parameters:
+ *   char *
+ *     The buffer.
+ *   size_t
+ *     The size of the buffer.
+ *   const http_response_headers_t *
+ *     The headers, starting with the status.
+ *   int
+ *     (boolean) a 'Connection: close' header is added.
+ *   int
+ *     (boolean) a 'Transfer-Encoding: chunked' header is added.
+ *
+ * Return Value:
+ *   The length of the head.
+ */
+size_t http1_serialize_head(char *, size_t, const http_response_headers_t *, int, int);
+
+#endif /* HTTP_RESPONSE_SERIALIZER_H */
@@ -17,6 +17,14 @@
 /*SETTINGS_HEADER_TABLE_SIZE", "SETTINGS_ENABLE_PUSH", "SETTINGS_MAX_CONCURRENT_STREAMS", "SETTINGS_INITIAL_WINDOW_SIZE", "SETTINGS_MAX_FRAME_SIZE", "SETTINGS_MAX_HEADER_LIST_SIZE*/
 #define HTTP2_SETTINGS_INITIAL_WINDOW_SIZE 0x4
 #define HTTP2_SETTINGS_TABLE_SIZE 0x1
+#define HTTP2_SETTINGS_ENABLE_PUSH 0x2
+#define HTTP2_SETTINGS_MAX_FRAME_SIZE 0x5
+
+/* The largest flow control window (RFC 7540 Section 6.9.1). */
+#define HTTP2_WINDOW_MAX 2147483647
+/* The bounds of SETTINGS_MAX_FRAME_SIZE (RFC 7540 Section 6.5.2). */
+#define HTTP2_FRAME_SIZE_MIN 16384
+#define HTTP2_FRAME_SIZE_MAX 16777215
 
 typedef enum {
 	H2_NO_ERROR = 0x0,
@@ -42,7 +50,7 @@ typedef enum {
 #define FLAG_PRIORITY 0x20 
 
 #define PRTERR(text) fprintf(stderr, "\x1b[31m%s\x1b[0m", text)
-#define BITS31 0xEFFFFFFF
+#define BITS31 0x7FFFFFFF
 
 
 /* RFC 7540: Section 6.5.2 */
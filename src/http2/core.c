@@ -4,16 +4,25 @@
  * 
  * This file contains the main functions for HTTP/2.
  */
+/* for pread */
+#define _POSIX_C_SOURCE 200809L
+
 #include "core.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #ifdef BENCHMARK
 #include <time.h>
 #endif
 
 #include "base/global_settings.h"
+#include "base/thread_manager.h"
+#include "http/header_parser.h"
 #include "http/parser.h"
 #include "utils/io.h"
 #include "utils/util.h"
@@ -24,7 +33,8 @@
 #include "dynamic_table.h"
 #include "frame.h"
 #include "hpack.h"
-#include "huffman.h"
+#include "hpack_encoder.h"
+#include "scheduler.h"
 #include "stream.h"
 
 #include "handling/handlers.h"
@@ -47,21 +57,25 @@ static H2_ERROR handle_settings(frame_t *frame, setentry_t *settings) {
 		size_t i;
 		for (i = 0; i < frame->length / 6; i++) {
 			char *start = frame->data + i*6;
-			ent.id = (start[0] << 8) | start[1];
+			ent.id = ((start[0] & 0xFF) << 8) | (start[1] & 0xFF);
 			ent.value = u32(start+2);
 			
-			if (ent.id > HTTP2_SETTINGS_COUNT) {
-				fprintf(stderr, "[H2] Invalid setting identifier: %hu with value %u\n", ent.id, ent.value);
+			/* unknown settings are ignored (RFC 7540 Section 6.5.2) */
+			if (ent.id == 0 || ent.id > HTTP2_SETTINGS_COUNT)
+				continue;
+			
+			if (ent.id == HTTP2_SETTINGS_ENABLE_PUSH && ent.value > 1) {
+				fprintf(stderr, "[H2] Invalid value for enable push: %u\n", ent.value);
 				return H2_PROTOCOL_ERROR;
 			}
-			
-			#ifdef _NOT_DEFINED
-			uint32_t max = 2147483647;
-			if (ent.id == HTTP2_SETTINGS_INITIAL_WINDOW_SIZE && ent.value > max) {
-				fprintf(stderr, "[H2] Invalid value for initial window size: %u, max: %u\n", ent.value, max);
+			if (ent.id == HTTP2_SETTINGS_INITIAL_WINDOW_SIZE && ent.value > HTTP2_WINDOW_MAX) {
+				fprintf(stderr, "[H2] Invalid value for initial window size: %u, max: %u\n", ent.value, HTTP2_WINDOW_MAX);
 				return H2_FLOW_CONTROL_ERROR;
 			}
-			#endif
+			if (ent.id == HTTP2_SETTINGS_MAX_FRAME_SIZE && (ent.value < HTTP2_FRAME_SIZE_MIN || ent.value > HTTP2_FRAME_SIZE_MAX)) {
+				fprintf(stderr, "[H2] Invalid value for max frame size: %u\n", ent.value);
+				return H2_PROTOCOL_ERROR;
+			}
 			
 			/*
 			printf("[\x1b[33mSettings\x1b[0m] \x1b[32mName: %s Value: %u\n", settings_names[ent.id], ent.value);
@@ -81,32 +95,50 @@ static H2_ERROR handle_settings(frame_t *frame, setentry_t *settings) {
  * Return Value:
  *   (boolean) success status
  */
-static int send_settings(TLS tls) {
-	char *buf = malloc(6);
+static int send_settings(frame_writer_t *writer) {
+	char buf[12];
 	buf[0] = 0x00;
-	buf[1] = 0x04; /* SETTINGS_INITIAL_WINDOW_SIZE */
-	buf[2] = 0x00;
-	buf[3] = 0xBF;
-	buf[4] = 0x00;
-	buf[5] = 0x01;
+	buf[1] = 0x03; /* SETTINGS_MAX_CONCURRENT_STREAMS */
+	buf[2] = (GLOBAL_SETTING_h2_max_concurrent_streams >> 24) & 0xFF;
+	buf[3] = (GLOBAL_SETTING_h2_max_concurrent_streams >> 16) & 0xFF;
+	buf[4] = (GLOBAL_SETTING_h2_max_concurrent_streams >> 8) & 0xFF;
+	buf[5] = GLOBAL_SETTING_h2_max_concurrent_streams & 0xFF;
+	buf[6] = 0x00;
+	buf[7] = 0x04; /* SETTINGS_INITIAL_WINDOW_SIZE */
+	buf[8] = (GLOBAL_SETTING_h2_window_size >> 24) & 0xFF;
+	buf[9] = (GLOBAL_SETTING_h2_window_size >> 16) & 0xFF;
+	buf[10] = (GLOBAL_SETTING_h2_window_size >> 8) & 0xFF;
+	buf[11] = GLOBAL_SETTING_h2_window_size & 0xFF;
 	
-	int ret = send_frame(tls, 6, FRAME_SETTINGS, 0x0, 0x0, buf);
-	free(buf);
-	return ret;
+	return frame_writer_queue(writer, 12, FRAME_SETTINGS, 0x0, 0x0, buf);
+}
+
+static int send_window_update(frame_writer_t *writer, uint32_t stream, uint32_t increment) {
+	char buf[4];
+	buf[0] = (increment >> 24) & 0x7F;
+	buf[1] = (increment >> 16) & 0xFF;
+	buf[2] = (increment >> 8) & 0xFF;
+	buf[3] = increment & 0xFF;
+	return frame_writer_queue(writer, 4, FRAME_WINDOW_UPDATE, 0x0, stream, buf);
 }
 
-static int send_settings_ack(TLS tls) {
-	return send_frame(tls, 0, FRAME_SETTINGS, FLAG_ACK, 0x0, NULL);
+static int send_settings_ack(frame_writer_t *writer) {
+	return frame_writer_queue(writer, 0, FRAME_SETTINGS, FLAG_ACK, 0x0, NULL);
 }
 
-static void send_rst(TLS tls, uint32_t error) {
+static void send_rst(frame_writer_t *writer, uint32_t error, uint32_t stream) {
 	printf("\x1b[33m[!] Sending RST_STREAM frame! Error: %s\x1b[0m\n", h2_error_codes[error]);
-	send_frame(tls, 4, FRAME_RST_STREAM, 0, 0, (char *)&error);
+	char buf[4];
+	buf[0] = (error >> 24) & 0xFF;
+	buf[1] = (error >> 16) & 0xFF;
+	buf[2] = (error >> 8) & 0xFF;
+	buf[3] = error & 0xFF;
+	frame_writer_queue(writer, 4, FRAME_RST_STREAM, 0, stream, buf);
 }
 
-static void send_goaway(TLS tls, uint32_t error, uint32_t stream) {
+static void send_goaway(frame_writer_t *writer, uint32_t error, uint32_t stream) {
 	printf("\x1b[33m[!] Sending GOWAY frame! Error: %s\x1b[0m\n", h2_error_codes[error]);
-	char *buf = malloc(8);
+	char buf[8];
 	buf[0] = (stream >> 24) & 0xFF;
 	buf[1] = (stream >> 16) & 0xFF;
 	buf[2] = (stream >> 8) & 0xFF;
@@ -115,59 +147,1056 @@ static void send_goaway(TLS tls, uint32_t error, uint32_t stream) {
 	buf[5] = (error >> 16) & 0xFF;
 	buf[6] = (error >> 8) & 0xFF;
 	buf[7] = error & 0xFF;
-	send_frame(tls, 8, FRAME_GOAWAY, 0x0, 0x0, buf);
-	free(buf);
+	/* the connection is closed after it, the batch is sent with it */
+	frame_writer_send(writer, 8, FRAME_GOAWAY, 0x0, 0x0, buf);
+}
+
+/* The requests of a connection are handled concurrently: every request gets a
+ * worker thread that runs the handler, while the thread of the connection is
+ * the only one that reads from and writes to the transport. The workers queue
+ * the frames of their responses, and the connection sends them in turns, one
+ * frame of every stream at a time, so a slow or large response doesn't hold up
+ * the others. The DATA frames of a request body are passed the other way. */
+
+/* the amount of bytes a worker can queue ahead of the connection */
+#define H2_TASK_OUTPUT_MAX 65536
+
+/* a frame that was queued by a worker, the payload follows the structure */
+typedef struct h2_output_t {
+	struct h2_output_t *next;
+	char type;
+	char flags;
+	uint32_t length;
+	/* the bytes of a DATA frame that were sent already, see connection_send */
+	uint32_t offset;
+	/* the headers of a HEADERS frame, they are encoded when the frame is
+	 * sent (see send_headers), or NULL when the payload is a header block */
+	http_response_headers_t *headers;
+	/* the request of a PUSH_PROMISE, it is handled by a task of its own
+	 * once the frame is sent (see send_push_promise) */
+	http_header_list_t *request;
+} h2_output_t;
+
+#define OUTPUT_DATA(output) ((char *) ((output) + 1))
+
+/* a DATA frame of a request body, its data is [position, end) */
+typedef struct h2_input_t {
+	struct h2_input_t *next;
+	frame_t *frame;
+	size_t position;
+	size_t end;
+} h2_input_t;
+
+typedef enum {
+	H2_BODY_READING,
+	H2_BODY_END,
+	/* the body is malformed or too large, the stream is reset with 'error'
+	 * after the response */
+	H2_BODY_ERROR
+} h2_body_state_t;
+
+struct h2_connection_t;
+
+typedef struct h2_task_t {
+	struct h2_task_t *next;
+	struct h2_connection_t *connection;
+	uint32_t stream;
+	uint32_t max_frame_size;
+	/* the window of the client for the stream, it is only used by the
+	 * connection and is negative when the initial window was decreased */
+	int64_t send_window;
+	/* the place of the stream in the scheduler of the connection */
+	h2_scheduler_node_t node;
+	/* (boolean) the client has sent an extensible priority (RFC 9218) for
+	 * the stream, RFC 7540 PRIORITY frames are ignored then */
+	int extensible_priority;
+	/* (boolean) the client allowed server push when the request arrived,
+	 * it is checked again when the PUSH_PROMISE is sent */
+	int push;
+	/* (boolean) the stream was promised by the server */
+	int pushed;
+	/* (boolean) the HEADERS of the response couldn't be queued, the stream
+	 * is reset instead of sending the body */
+	int headers_failed;
+	pthread_t thread;
+	/* the request, the body is read with 'body_reader' */
+	http_header_list_t *headers;
+	http_body_reader_t body_reader;
+
+	/* the members below are guarded by the mutex of the connection */
+	h2_output_t *output;
+	h2_output_t *output_last;
+	size_t output_length;
+	/* (boolean) the handler is done, the task is destroyed once the output is sent */
+	int done;
+	/* (boolean) the stream was reset or the connection is closing, the output
+	 * is discarded and the handler should stop */
+	int reset;
+
+	/* The body of the request. The window of the stream is only updated for
+	 * what the handler has read, so the client can't send more than
+	 * 'h2-window-size' bytes ahead. */
+	h2_body_state_t body_state;
+	H2_ERROR body_error;
+	h2_input_t *input;
+	h2_input_t *input_last;
+	/* the bytes that were received since the last WINDOW_UPDATE, and how
+	 * many of them have been read (or were padding) */
+	uint32_t received;
+	uint32_t consumed;
+	/* the bytes of the body that were received */
+	size_t total;
+	/* the Content-Length, or HTTP_BODY_LENGTH_UNKNOWN */
+	size_t length;
+} h2_task_t;
+
+typedef struct h2_connection_t {
+	transport_t *transport;
+	/* the DATA frames of request bodies are released by the workers */
+	frame_reader_t reader;
+	/* the control frames are sent with the next frame, see connection_wait */
+	frame_writer_t writer;
+	/* the settings of the client */
+	setentry_t *settings;
+	/* the window of the client for the connection */
+	int64_t send_window;
+	/* chooses the stream that sends the next DATA frame */
+	h2_scheduler_t scheduler;
+	/* the HPACK state of the responses, it is only used by the connection */
+	hpack_encoder_t encoder;
+	pthread_mutex_t mutex;
+	/* broadcast when a worker may continue: output was sent, body data was
+	 * received or a task was reset */
+	pthread_cond_t condition;
+	/* the workers wake the connection through this pipe when it waits, see
+	 * connection_wait */
+	int wake[2];
+	/* (boolean) the connection waits for the transport or the pipe */
+	int waiting;
+	/* (boolean) a worker has queued output, is done or has consumed body data */
+	int ready;
+
+	/* the list is only changed by the thread of the connection */
+	h2_task_t *tasks;
+	size_t task_count;
+	/* the tasks of promised streams, at most the SETTINGS_MAX_CONCURRENT_STREAMS
+	 * of the client */
+	size_t push_count;
+} h2_connection_t;
+
+/* tells the connection there's work for it, the mutex must be locked */
+static void connection_notify(h2_connection_t *connection) {
+	connection->ready = 1;
+	if (connection->waiting) {
+		connection->waiting = 0;
+		if (write(connection->wake[1], "", 1) < 0)
+			perror("[H2] Failed to wake the connection");
+	}
+}
+
+static h2_output_t *output_create(char type, char flags, uint32_t length) {
+	h2_output_t *output = malloc(sizeof(h2_output_t) + length);
+	if (!output)
+		return NULL;
+	output->next = NULL;
+	output->type = type;
+	output->flags = flags;
+	output->length = length;
+	output->offset = 0;
+	output->headers = NULL;
+	output->request = NULL;
+	return output;
+}
+
+static void output_destroy(h2_output_t *output) {
+	if (output->headers)
+		http_response_headers_destroy(output->headers);
+	if (output->request)
+		http_destroy_header_list(output->request);
+	free(output);
+}
+
+static void output_destroy_all(h2_output_t *output) {
+	while (output) {
+		h2_output_t *next = output->next;
+		output_destroy(output);
+		output = next;
+	}
+}
+
+/* (boolean) queues the frame, waiting while too much output is queued
+ * already, the frame is freed on failure */
+static int task_queue(h2_task_t *task, h2_output_t *output) {
+	h2_connection_t *connection = task->connection;
+	pthread_mutex_lock(&connection->mutex);
+	while (!task->reset && task->output_length >= H2_TASK_OUTPUT_MAX)
+		pthread_cond_wait(&connection->condition, &connection->mutex);
+
+	int success = !task->reset;
+	if (success) {
+		if (task->output_last)
+			task->output_last->next = output;
+		else
+			task->output = output;
+		task->output_last = output;
+		task->output_length += output->length;
+		connection_notify(connection);
+	}
+	pthread_mutex_unlock(&connection->mutex);
+
+	if (!success)
+		output_destroy(output);
+	return success;
+}
+
+/* (boolean) queues a copy of the frame */
+static int task_queue_copy(h2_task_t *task, char type, char flags, const char *data, uint32_t length) {
+	h2_output_t *output = output_create(type, flags, length);
+	if (!output)
+		return 0;
+	memcpy(OUTPUT_DATA(output), data, length);
+	return task_queue(task, output);
+}
+
+static int task_queue_rst(h2_task_t *task, uint32_t error) {
+	char buf[4];
+	buf[0] = (error >> 24) & 0xFF;
+	buf[1] = (error >> 16) & 0xFF;
+	buf[2] = (error >> 8) & 0xFF;
+	buf[3] = error & 0xFF;
+	return task_queue_copy(task, FRAME_RST_STREAM, 0, buf, 4);
+}
+
+/* (boolean) queues a HEADERS frame of the headers */
+static int task_queue_headers(h2_task_t *task, const http_response_headers_t *response_headers) {
+	/* the headers are copied, the connection encodes them when the frame is
+	 * sent, since the dynamic table depends on the order of the blocks */
+	h2_output_t *output = output_create(FRAME_HEADERS, FLAG_END_HEADERS, 0);
+	if (!output)
+		return 0;
+	if (!(output->headers = http_create_response_headers(response_headers->count + 1))) {
+		output_destroy(output);
+		return 0;
+	}
+	size_t i;
+	for (i = 0; i < response_headers->count; i++) {
+		http_response_header_t *header = response_headers->headers[i];
+		if (!http_response_headers_add(output->headers, header->name, header->value)) {
+			output_destroy(output);
+			return 0;
+		}
+	}
+	return task_queue(task, output);
 }
 
 static void h2_callback_headers_ready(http_response_headers_t *response_headers, size_t app_data_len, void **application_data) {
-	TLS tls = (TLS) application_data[0];
-	frame_t *frame = (frame_t *)application_data[1];
-
-	size_t size = 0;
-	char *headers = write_headers(response_headers, &size);
-
-	/* reparse to see if/where the (an) error is. */ /*{
-		frame_t *temp_frame = malloc(sizeof(frame_t));
-		temp_frame->flags = FLAG_END_HEADERS;
-		temp_frame->length = pos;
-		temp_frame->data = headers;
-		http_header_list_t *temp_headers = http_create_header_list();
-		dynamic_table_t *dynamic_table = dynamic_table_create(4096);
-		handle_headers(temp_frame, dynamic_table, temp_headers);
-		dynamic_table_destroy(dynamic_table);
-		http_destroy_header_list(temp_headers);
-		free(temp_frame);
-	}*/
+	h2_task_t *task = (h2_task_t *) application_data[0];
+	if (!task_queue_headers(task, response_headers))
+		task->headers_failed = 1;
+}
 
-	/*printf(" > sending HEADERS frame, len=%zu\n", pos);*/
-	send_frame(tls, size, FRAME_HEADERS, FLAG_END_HEADERS, frame->r_s_id, headers);
-	free(headers);
+/* the '103 Early Hints' is a HEADERS frame without END_STREAM before the response */
+static void h2_callback_early_hints(http_response_headers_t *response_headers, size_t app_data_len, void **application_data) {
+	task_queue_headers((h2_task_t *) application_data[0], response_headers);
 }
 
-static void h2_handle(TLS tls, frame_t *frame, http_header_list_t *request_header_list, setentry_t *settings) {
-	handler_callbacks_t *callback_info = malloc(sizeof(handler_callbacks_t));
-	if (!callback_info) {
-		fprintf(stderr, "h2_handle: memory allocation error!");
-		return;
+/* (boolean) adds a copy of the value to the request */
+static int request_add(http_header_list_t *request, const char *key, const char *value) {
+	size_t length = strlen(value) + 1;
+	char *copy = http_header_list_allocate(request, length);
+	if (!copy)
+		return 0;
+	memcpy(copy, value, length);
+	return http_header_list_add(request, key, copy, HTTP_HEADER_CACHED, 0);
+}
+
+/* promises the response to a GET request of the path, with the authority,
+ * scheme and Accept-Encoding of the request of the task */
+static int h2_callback_push(const char *path, size_t app_data_len, void **application_data) {
+	h2_task_t *task = (h2_task_t *) application_data[0];
+	const char *authority = http_header_list_getn(task->headers, HTTP_HEADER_NAME_AUTHORITY);
+	const char *scheme = http_header_list_getn(task->headers, HTTP_HEADER_NAME_SCHEME);
+	const char *accept_encoding = http_header_list_getn(task->headers, HTTP_HEADER_NAME_ACCEPT_ENCODING);
+	if (!authority)
+		authority = http_header_list_getn(task->headers, HTTP_HEADER_NAME_HOST);
+	if (!authority || !scheme)
+		return 0;
+
+	size_t length = strlen(path) + strlen(authority) + strlen(scheme) + (accept_encoding ? strlen(accept_encoding) : 0);
+	h2_output_t *output = output_create(FRAME_PUSH_PROMISE, FLAG_END_HEADERS, 4 + 1 + 4 * HPACK_LITERAL_OVERHEAD + length);
+	http_header_list_t *request = http_create_header_list();
+	if (!output || !request) {
+		free(output);
+		if (request)
+			http_destroy_header_list(request);
+		return 0;
 	}
-	callback_info->headers_ready = h2_callback_headers_ready;
-	callback_info->application_data_length = 2;
-	callback_info->application_data = calloc(callback_info->application_data_length, sizeof(void *));
-	callback_info->application_data[0] = tls;
-	callback_info->application_data[1] = frame;
+	request->version = HTTP_VERSION_2;
+	request->early_data = task->headers->early_data;
+	output->request = request;
 
-	http_response_t *response = http_handle_request(request_header_list, callback_info);
-	free(callback_info->application_data);
-	free(callback_info);
+	/* the promised stream is filled in by send_push_promise, the block doesn't
+	 * use the dynamic table, so it doesn't depend on the order of the blocks */
+	char *block = OUTPUT_DATA(output) + 4;
+	char *end = block;
+	/* ":method: GET" (RFC 7541 Appendix A) */
+	*end++ = (char) 0x82;
+	end += hpack_encode_literal(end, 6, scheme, strlen(scheme));
+	end += hpack_encode_literal(end, 1, authority, strlen(authority));
+	end += hpack_encode_literal(end, 4, path, strlen(path));
+	if (accept_encoding)
+		end += hpack_encode_literal(end, 16, accept_encoding, strlen(accept_encoding));
+	output->length = end - OUTPUT_DATA(output);
 
-	/*printf(" > sending DATA frame, len=%zu\n", response->body_size);*/
-	send_frame(tls, response->body_size, FRAME_DATA, FLAG_END_STREAM, frame->r_s_id, response->body);
-	
-	if (response->is_dynamic) {
-		free(response->body);
-		http_response_headers_destroy(response->headers);
-		free(response);
+	if (!request_add(request, ":method", "GET") || !request_add(request, ":scheme", scheme)
+		|| !request_add(request, ":authority", authority) || !request_add(request, ":path", path)
+		|| (accept_encoding && !request_add(request, "accept-encoding", accept_encoding))) {
+		output_destroy(output);
+		return 0;
+	}
+	return task_queue(task, output);
+}
+
+/* (boolean) queues the header block of a prebuilt response with the current date */
+static int queue_prebuilt_headers(h2_task_t *task, const http_prebuilt_response_t *prebuilt) {
+	h2_output_t *output = output_create(FRAME_HEADERS, FLAG_END_HEADERS, prebuilt->hpack_length);
+	if (!output)
+		return 0;
+	http2_copy_prebuilt(OUTPUT_DATA(output), prebuilt);
+	return task_queue(task, output);
+}
+
+/* coalesces the writes of a body producer into DATA frames of 'max_frame_size' bytes */
+typedef struct {
+	h2_task_t *task;
+	/* the next DATA frame */
+	h2_output_t *output;
+} h2_data_writer_t;
+
+static int data_write(http_body_writer_t *body_writer, const char *data, size_t size) {
+	h2_data_writer_t *writer = (h2_data_writer_t *) body_writer->data;
+	uint32_t max_frame_size = writer->task->max_frame_size;
+	while (size > 0) {
+		if (!writer->output) {
+			if (!(writer->output = output_create(FRAME_DATA, 0, max_frame_size)))
+				return 0;
+			writer->output->length = 0;
+		}
+
+		size_t space = max_frame_size - writer->output->length;
+		if (space > size)
+			space = size;
+		memcpy(OUTPUT_DATA(writer->output) + writer->output->length, data, space);
+		writer->output->length += space;
+		data += space;
+		size -= space;
+
+		/* the last frame is queued after the producer, with END_STREAM */
+		if (writer->output->length == max_frame_size && size > 0) {
+			h2_output_t *output = writer->output;
+			writer->output = NULL;
+			if (!task_queue(writer->task, output))
+				return 0;
+		}
 	}
+	return 1;
+}
+
+/* (boolean) runs the body producer of the response */
+static int queue_produced_data(h2_task_t *task, http_response_t *response) {
+	h2_data_writer_t writer;
+	writer.task = task;
+	writer.output = NULL;
+
+	http_body_writer_t body_writer;
+	body_writer.write = data_write;
+	body_writer.data = &writer;
+
+	if (!response->body_producer(&body_writer, response->body_producer_data)) {
+		free(writer.output);
+		task_queue_rst(task, H2_INTERNAL_ERROR);
+		return 0;
+	}
+	if (!writer.output && !(writer.output = output_create(FRAME_DATA, 0, 0)))
+		return 0;
+	writer.output->flags = FLAG_END_STREAM;
+	return task_queue(task, writer.output);
+}
+
+/* (boolean) queues the body of the response in DATA frames of at most
+ * 'max_frame_size' (the client's SETTINGS_MAX_FRAME_SIZE) bytes */
+static int queue_data(h2_task_t *task, http_response_t *response) {
+	if (response->body_producer)
+		return queue_produced_data(task, response);
+
+	size_t position = 0;
+	do {
+		size_t size = response->body_size - position;
+		if (size > task->max_frame_size)
+			size = task->max_frame_size;
+
+		h2_output_t *output = output_create(FRAME_DATA, 0, size);
+		if (!output)
+			return 0;
+		if (response->body_file == -1) {
+			memcpy(OUTPUT_DATA(output), response->body + position, size);
+		} else if (size > 0) {
+			ssize_t read = pread(response->body_file, OUTPUT_DATA(output), size, position);
+			if (read <= 0) {
+				perror("[H2] Failed to read the body");
+				free(output);
+				return 0;
+			}
+			output->length = size = read;
+		}
+
+		position += size;
+		if (position == response->body_size)
+			output->flags = FLAG_END_STREAM;
+		if (!task_queue(task, output))
+			return 0;
+	} while (position < response->body_size);
+	return 1;
+}
+
+static int body_read(http_body_reader_t *reader, char *destination, size_t size) {
+	h2_task_t *task = (h2_task_t *) reader->data;
+	h2_connection_t *connection = task->connection;
+	pthread_mutex_lock(&connection->mutex);
+	while (!task->reset && !task->input && task->body_state == H2_BODY_READING)
+		pthread_cond_wait(&connection->condition, &connection->mutex);
+
+	int result;
+	if (task->reset || task->body_state == H2_BODY_ERROR) {
+		result = -1;
+	} else if (!task->input) {
+		result = 0;
+	} else {
+		h2_input_t *input = task->input;
+		if (size > input->end - input->position)
+			size = input->end - input->position;
+		if (size > INT_MAX)
+			size = INT_MAX;
+		memcpy(destination, input->frame->data + input->position, size);
+		input->position += size;
+		task->consumed += size;
+		result = size;
+
+		if (input->position == input->end) {
+			if (!(task->input = input->next))
+				task->input_last = NULL;
+			frame_reader_release(&connection->reader, input->frame);
+			free(input);
+		}
+		/* the window is updated by the connection, once half of it is consumed */
+		if (task->consumed >= GLOBAL_SETTING_h2_window_size / 2)
+			connection_notify(connection);
+	}
+	pthread_mutex_unlock(&connection->mutex);
+	return result;
+}
+
+/* the worker thread of a request */
+static void *task_run(void *data) {
+	h2_task_t *task = (h2_task_t *) data;
+	void *application_data[1];
+	application_data[0] = task;
+
+	handler_callbacks_t callbacks;
+	callbacks.headers_ready = h2_callback_headers_ready;
+	/* a promised response doesn't hint or push the subresources again */
+	callbacks.early_hints = task->pushed ? NULL : h2_callback_early_hints;
+	callbacks.push = task->push ? h2_callback_push : NULL;
+	callbacks.application_data_length = 1;
+	callbacks.application_data = application_data;
+
+	http_response_t *response = http_handle_request(task->headers, &callbacks);
+	/* the headers of other responses were queued by h2_callback_headers_ready,
+	 * DATA without them would be a connection error */
+	if (task->headers_failed)
+		task_queue_rst(task, H2_INTERNAL_ERROR);
+	else if (!response->prebuilt || queue_prebuilt_headers(task, response->prebuilt))
+		queue_data(task, response);
+	http_response_destroy(response);
+
+	if (task->headers->body && !task->headers_failed) {
+		h2_connection_t *connection = task->connection;
+		pthread_mutex_lock(&connection->mutex);
+		h2_body_state_t state = task->body_state;
+		H2_ERROR error = task->body_error;
+		pthread_mutex_unlock(&connection->mutex);
+
+		/* the rest of the body isn't needed after the response (RFC 7540 Section 8.1) */
+		if (state != H2_BODY_END)
+			task_queue_rst(task, error);
+	}
+
+	pthread_mutex_lock(&task->connection->mutex);
+	task->done = 1;
+	connection_notify(task->connection);
+	pthread_mutex_unlock(&task->connection->mutex);
+	return NULL;
+}
+
+static h2_task_t *connection_find_task(h2_connection_t *connection, uint32_t stream) {
+	h2_task_t *task;
+	for (task = connection->tasks; task; task = task->next)
+		if (task->stream == stream)
+			return task;
+	return NULL;
+}
+
+/* creates the task of a request without a body */
+static h2_task_t *task_create(h2_connection_t *connection, uint32_t stream, http_header_list_t *headers) {
+	h2_task_t *task = calloc(1, sizeof(h2_task_t));
+	if (!task)
+		return NULL;
+	task->connection = connection;
+	task->stream = stream;
+	task->max_frame_size = connection->settings[4].value;
+	task->send_window = connection->settings[3].value;
+	task->push = connection->settings[1].value != 0 && connection->settings[2].value > 0;
+	task->node.stream = task->stream;
+	task->node.data = task;
+	task->node.priority = h2_priority_default();
+	task->headers = headers;
+	task->body_state = H2_BODY_READING;
+	task->body_error = H2_NO_ERROR;
+	task->length = HTTP_BODY_LENGTH_UNKNOWN;
+	return task;
+}
+
+/* (boolean) starts the worker of the task, the task is freed on failure.
+ * The workers count against max-child-threads, the stream is refused when
+ * the thread manager is full. */
+static int connection_run_task(h2_connection_t *connection, h2_task_t *task) {
+	if (!thread_manager_reserve()) {
+		task->headers->body = NULL;
+		free(task);
+		return 0;
+	}
+	if (pthread_create(&task->thread, NULL, task_run, task) != 0) {
+		perror("[H2] Failed to create a thread for the request");
+		thread_manager_release();
+		task->headers->body = NULL;
+		free(task);
+		return 0;
+	}
+
+	task->next = connection->tasks;
+	connection->tasks = task;
+	connection->task_count += 1;
+	h2_scheduler_add(&connection->scheduler, &task->node);
+	return 1;
+}
+
+/* (boolean) starts a worker for the request, the headers are taken over by the task */
+static int connection_start_task(h2_connection_t *connection, frame_t *frame, http_header_list_t *headers) {
+	h2_task_t *task = task_create(connection, frame->r_s_id & BITS31, headers);
+	if (!task)
+		return 0;
+
+	const char *priority = http_header_list_getn(headers, HTTP_HEADER_NAME_PRIORITY);
+	if (priority) {
+		h2_priority_parse(&task->node.priority, priority, strlen(priority));
+		task->extensible_priority = 1;
+	} else if (frame->flags & FLAG_PRIORITY) {
+		/* the weight follows the pad length and the stream dependency */
+		size_t weight = (frame->flags & FLAG_PADDED ? 1 : 0) + 4;
+		if (frame->length > weight)
+			task->node.priority = h2_priority_from_weight((frame->data[weight] & 0xFF) + 1);
+	}
+
+	/* without END_STREAM, the request has a body */
+	if (!(frame->flags & FLAG_END_STREAM)) {
+		const char *content_length = http_header_list_getn(headers, HTTP_HEADER_NAME_CONTENT_LENGTH);
+		if (content_length && !http_parse_content_length(content_length, &task->length)) {
+			task->body_state = H2_BODY_ERROR;
+			task->body_error = H2_PROTOCOL_ERROR;
+		}
+
+		task->body_reader.read = body_read;
+		task->body_reader.length = task->length;
+		task->body_reader.data = task;
+		headers->body = &task->body_reader;
+	}
+	return connection_run_task(connection, task);
+}
+
+/* (boolean) starts a worker for a promised request, the headers are taken over by the task */
+static int connection_start_push(h2_connection_t *connection, uint32_t stream, http_header_list_t *headers) {
+	h2_task_t *task = task_create(connection, stream, headers);
+	if (!task)
+		return 0;
+	/* a PUSH_PROMISE can only be sent on a stream of the client */
+	task->push = 0;
+	task->pushed = 1;
+	if (!connection_run_task(connection, task))
+		return 0;
+	connection->push_count += 1;
+	return 1;
+}
+
+/* (boolean) waits for the worker and destroys the task, the data that was
+ * received but not read is returned to the window of the connection */
+static int connection_destroy_task(h2_connection_t *connection, h2_task_t *task) {
+	pthread_join(task->thread, NULL);
+	thread_manager_release();
+	h2_scheduler_remove(&connection->scheduler, &task->node);
+
+	h2_input_t *input = task->input;
+	while (input) {
+		h2_input_t *next = input->next;
+		frame_reader_release(&connection->reader, input->frame);
+		free(input);
+		input = next;
+	}
+	output_destroy_all(task->output);
+
+	uint32_t received = task->received;
+	task->headers->body = NULL;
+	http_destroy_header_list(task->headers);
+	free(task);
+	return received == 0 || send_window_update(&connection->writer, 0x0, received);
+}
+
+/* resets the task, its worker stops as soon as it can, the mutex must be locked */
+static void task_reset(h2_connection_t *connection, h2_task_t *task) {
+	task->reset = 1;
+	output_destroy_all(task->output);
+	task->output = NULL;
+	task->output_last = NULL;
+	task->output_length = 0;
+	pthread_cond_broadcast(&connection->condition);
+}
+
+/**
+ * Description:
+ *   Handles a DATA frame of a request body, the frame is freed unless it
+ *   contains data of the body.
+ *
+ * Return Value:
+ *   H2_NO_ERROR, or the error of the connection
+ */
+static H2_ERROR connection_receive_data(h2_connection_t *connection, h2_task_t *task, frame_t *frame, h2stream_list_t *streams) {
+	size_t pad_length = 0;
+	size_t position = 0;
+	if (frame->flags & FLAG_PADDED) {
+		if (frame->length == 0 || (size_t) (frame->data[0] & 0xFF) >= frame->length)
+			return H2_PROTOCOL_ERROR;
+		pad_length = frame->data[0] & 0xFF;
+		position = 1;
+	}
+	size_t end = frame->length - pad_length;
+
+	uint32_t length = frame->length;
+	pthread_mutex_lock(&connection->mutex);
+	if (task->reset || task->body_state != H2_BODY_READING) {
+		/* the body isn't read anymore, the data is only returned to the connection's window */
+		pthread_mutex_unlock(&connection->mutex);
+		frame_reader_release(&connection->reader, frame);
+		return length == 0 || send_window_update(&connection->writer, 0x0, length) ? H2_NO_ERROR : H2_INTERNAL_ERROR;
+	}
+
+	/* the padding counts for flow control too (RFC 7540 Section 6.1) */
+	if (length > GLOBAL_SETTING_h2_window_size - task->received) {
+		task->received += length;
+		task->body_state = H2_BODY_ERROR;
+		task->body_error = H2_FLOW_CONTROL_ERROR;
+	} else {
+		task->received += length;
+		task->consumed += position + pad_length;
+		task->total += end - position;
+		if (task->total > GLOBAL_SETTING_request_body_max) {
+			task->body_state = H2_BODY_ERROR;
+			task->body_error = H2_CANCEL;
+		} else if (task->length != HTTP_BODY_LENGTH_UNKNOWN
+			&& (task->total > task->length || ((frame->flags & FLAG_END_STREAM) && task->total != task->length))) {
+			/* the Content-Length has to be the length of the DATA (RFC 7540 Section 8.1.2.6) */
+			task->body_state = H2_BODY_ERROR;
+			task->body_error = H2_PROTOCOL_ERROR;
+		} else if (frame->flags & FLAG_END_STREAM) {
+			h2stream_set_state(streams, task->stream, H2_STREAM_HALF_CLOSED_REMOTE);
+			task->body_state = H2_BODY_END;
+		}
+	}
+
+	h2_input_t *input = NULL;
+	if (task->body_state != H2_BODY_ERROR && position < end && (input = malloc(sizeof(h2_input_t)))) {
+		input->next = NULL;
+		input->frame = frame;
+		input->position = position;
+		input->end = end;
+		if (task->input_last)
+			task->input_last->next = input;
+		else
+			task->input = input;
+		task->input_last = input;
+	} else if (task->body_state != H2_BODY_ERROR && position < end) {
+		task->body_state = H2_BODY_ERROR;
+		task->body_error = H2_INTERNAL_ERROR;
+	}
+	pthread_cond_broadcast(&connection->condition);
+	pthread_mutex_unlock(&connection->mutex);
+
+	if (!input)
+		frame_reader_release(&connection->reader, frame);
+	return H2_NO_ERROR;
+}
+
+/* handles the trailers of a request body, they aren't used */
+static void connection_receive_trailers(h2_connection_t *connection, h2_task_t *task, frame_t *frame, h2stream_list_t *streams) {
+	pthread_mutex_lock(&connection->mutex);
+	if (task->body_state == H2_BODY_READING) {
+		if (!(frame->flags & FLAG_END_STREAM)
+			|| (task->length != HTTP_BODY_LENGTH_UNKNOWN && task->total != task->length)) {
+			task->body_state = H2_BODY_ERROR;
+			task->body_error = H2_PROTOCOL_ERROR;
+		} else {
+			h2stream_set_state(streams, task->stream, H2_STREAM_HALF_CLOSED_REMOTE);
+			task->body_state = H2_BODY_END;
+		}
+		pthread_cond_broadcast(&connection->condition);
+	}
+	pthread_mutex_unlock(&connection->mutex);
+}
+
+/* (boolean) the frame at the head of the queue can be sent, the mutex must be locked */
+static int task_can_send(h2_scheduler_node_t *node, void *data) {
+	h2_connection_t *connection = (h2_connection_t *) data;
+	h2_output_t *output = ((h2_task_t *) node->data)->output;
+	if (!output)
+		return 0;
+	if (output->type != FRAME_DATA || output->offset == output->length)
+		return 1;
+	return connection->send_window > 0 && ((h2_task_t *) node->data)->send_window > 0;
+}
+
+/**
+ * Description:
+ *   Sends a HEADERS frame, its headers are encoded with the encoder of the
+ *   connection. A block that is larger than the SETTINGS_MAX_FRAME_SIZE of the
+ *   client is continued in CONTINUATION frames.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+static int send_headers(h2_connection_t *connection, h2_task_t *task, h2_output_t *output) {
+	const char *block = OUTPUT_DATA(output);
+	size_t length = output->length;
+	if (output->headers || connection->encoder.size_update) {
+		if (!(output->headers ? hpack_encode(&connection->encoder, output->headers)
+							  : hpack_encode_block(&connection->encoder, block, length))) {
+			puts("[H2] Failed to encode the headers.");
+			return 0;
+		}
+		block = connection->encoder.block;
+		length = connection->encoder.block_length;
+	}
+
+	char type = FRAME_HEADERS;
+	char flags = output->flags & ~FLAG_END_HEADERS;
+	for (;;) {
+		size_t size = length;
+		if (size > connection->settings[4].value)
+			size = connection->settings[4].value;
+		if (size == length)
+			flags |= FLAG_END_HEADERS;
+		if (!frame_writer_send(&connection->writer, size, type, flags, task->stream, block))
+			return 0;
+		if (size == length)
+			return 1;
+		block += size;
+		length -= size;
+		type = FRAME_CONTINUATION;
+		flags = 0;
+	}
+}
+
+/**
+ * Description:
+ *   Sends a PUSH_PROMISE on the stream of the task and starts a task for the
+ *   promised request. The push is left out when the client has disabled push
+ *   since the request, already has as many pushed streams as it allows, or
+ *   the response of the task has started.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+static int send_push_promise(h2_connection_t *connection, h2_task_t *task, h2stream_list_t *streams, h2_output_t *output) {
+	uint32_t promised = streams->highest[0] + 2;
+	h2stream_state_t state = h2stream_get_state(streams, task->stream);
+	if (!connection->settings[1].value || connection->push_count >= connection->settings[2].value
+		|| connection->task_count >= GLOBAL_SETTING_h2_max_concurrent_streams
+		|| (state != H2_STREAM_OPEN && state != H2_STREAM_HALF_CLOSED_REMOTE)
+		|| output->length > connection->settings[4].value || promised > BITS31
+		|| !h2stream_set_state(streams, promised, H2_STREAM_RESERVED_LOCAL))
+		return 1;
+
+	char *payload = OUTPUT_DATA(output);
+	payload[0] = (promised >> 24) & 0xFF;
+	payload[1] = (promised >> 16) & 0xFF;
+	payload[2] = (promised >> 8) & 0xFF;
+	payload[3] = promised & 0xFF;
+	if (!frame_writer_queue(&connection->writer, output->length, FRAME_PUSH_PROMISE, FLAG_END_HEADERS, task->stream, payload))
+		return 0;
+
+	/* the request is taken over by the task */
+	http_header_list_t *request = output->request;
+	output->request = NULL;
+	if (!connection_start_push(connection, promised, request)) {
+		http_destroy_header_list(request);
+		send_rst(&connection->writer, H2_REFUSED_STREAM, promised);
+		h2stream_set_state(streams, promised, H2_STREAM_CLOSED_STATE);
+	}
+	return 1;
+}
+
+/**
+ * Description:
+ *   Sends the frame at the head of the queue of the task. DATA is sent as far
+ *   as the windows of the client allow, in frames of at most its
+ *   SETTINGS_MAX_FRAME_SIZE, the rest stays queued.
+ *
+ * Parameters:
+ *   h2_connection_t *
+ *     The connection.
+ *   h2_task_t *
+ *     The task.
+ *   h2stream_list_t *
+ *     The streams, the state of the stream is updated.
+ *   int
+ *     (boolean) DATA frames aren't sent.
+ *
+ * Return Value:
+ *   1 if something was sent, 0 if not, or -1 on failure
+ */
+static int task_send(h2_connection_t *connection, h2_task_t *task, h2stream_list_t *streams, int control_only) {
+	pthread_mutex_lock(&connection->mutex);
+	h2_output_t *output = task->output;
+	uint32_t size = 0;
+	int last = 1;
+	if (output && ((control_only && output->type == FRAME_DATA) || !task_can_send(&task->node, connection)))
+		output = NULL;
+	if (output) {
+		size = output->length - output->offset;
+		if (output->type == FRAME_DATA && size > 0) {
+			int64_t window = connection->send_window < task->send_window ? connection->send_window : task->send_window;
+			if (size > window)
+				size = window;
+			if (size > connection->settings[4].value)
+				size = connection->settings[4].value;
+			last = size == output->length - output->offset;
+		}
+
+		task->output_length -= size;
+		if (last && !(task->output = output->next))
+			task->output_last = NULL;
+		pthread_cond_broadcast(&connection->condition);
+	}
+	pthread_mutex_unlock(&connection->mutex);
+	if (!output)
+		return 0;
+
+	int success;
+	if (output->type == FRAME_HEADERS)
+		success = send_headers(connection, task, output);
+	else if (output->type == FRAME_PUSH_PROMISE)
+		success = send_push_promise(connection, task, streams, output);
+	else if (output->type == FRAME_RST_STREAM)
+		success = frame_writer_queue(&connection->writer, size, output->type, output->flags, task->stream, OUTPUT_DATA(output));
+	else
+		success = frame_writer_send(&connection->writer, size, output->type, last ? output->flags : 0, task->stream, OUTPUT_DATA(output) + output->offset);
+	if (output->type == FRAME_DATA) {
+		connection->send_window -= size;
+		task->send_window -= size;
+	}
+	if (!last) {
+		output->offset += size;
+	} else {
+		/* a promised stream is half-closed once its response has started */
+		if (output->type == FRAME_HEADERS && h2stream_get_state(streams, task->stream) == H2_STREAM_RESERVED_LOCAL)
+			h2stream_set_state(streams, task->stream, H2_STREAM_HALF_CLOSED_REMOTE);
+		if (output->type == FRAME_RST_STREAM
+			|| ((output->flags & FLAG_END_STREAM) && h2stream_get_state(streams, task->stream) == H2_STREAM_HALF_CLOSED_REMOTE))
+			h2stream_set_state(streams, task->stream, H2_STREAM_CLOSED_STATE);
+		output_destroy(output);
+	}
+	return success ? 1 : -1;
+}
+
+/**
+ * Description:
+ *   Sends the queued HEADERS and RST_STREAM frames, one of every task, and
+ *   then one DATA frame of the stream the scheduler chooses. It also updates
+ *   the windows of the request bodies and destroys the tasks that are done.
+ *   A stream without window isn't chosen until a WINDOW_UPDATE arrives.
+ *
+ * Return Value:
+ *   1 if something was sent, 0 if not, or -1 on failure
+ */
+static int connection_send(h2_connection_t *connection, h2stream_list_t *streams) {
+	pthread_mutex_lock(&connection->mutex);
+	connection->ready = 0;
+	pthread_mutex_unlock(&connection->mutex);
+
+	int sent = 0;
+	int result;
+	h2_task_t **link = &connection->tasks;
+	while (*link) {
+		h2_task_t *task = *link;
+
+		/* the consumed bytes are returned to the windows of the stream and the
+		 * connection once they are half of the window, so WINDOW_UPDATEs aren't
+		 * sent for every read */
+		pthread_mutex_lock(&connection->mutex);
+		uint32_t update = 0;
+		int update_stream = task->body_state == H2_BODY_READING && !task->reset;
+		if (task->consumed > 0 && task->consumed >= GLOBAL_SETTING_h2_window_size / 2) {
+			update = task->consumed;
+			task->received -= update;
+			task->consumed = 0;
+		}
+		pthread_mutex_unlock(&connection->mutex);
+
+		if (update && !((!update_stream || send_window_update(&connection->writer, task->stream, update))
+						&& send_window_update(&connection->writer, 0x0, update)))
+			return -1;
+
+		if ((result = task_send(connection, task, streams, 1)) < 0)
+			return -1;
+		sent |= result;
+		/* the task of a PUSH_PROMISE is added at the head of the list */
+		while (*link != task)
+			link = &(*link)->next;
+
+		pthread_mutex_lock(&connection->mutex);
+		int done = task->done && !task->output;
+		pthread_mutex_unlock(&connection->mutex);
+		if (done) {
+			*link = task->next;
+			connection->task_count -= 1;
+			if (task->pushed)
+				connection->push_count -= 1;
+			if (!connection_destroy_task(connection, task))
+				return -1;
+		} else {
+			link = &task->next;
+		}
+	}
+
+	pthread_mutex_lock(&connection->mutex);
+	h2_scheduler_node_t *node = h2_scheduler_next(&connection->scheduler, task_can_send, connection);
+	pthread_mutex_unlock(&connection->mutex);
+	if (node) {
+		if ((result = task_send(connection, (h2_task_t *) node->data, streams, 0)) < 0)
+			return -1;
+		h2_scheduler_sent(&connection->scheduler, node);
+		sent |= result;
+	}
+	return sent;
+}
+
+/**
+ * Description:
+ *   Adds to the window of a stream, or of the connection when the task is
+ *   NULL, the change of SETTINGS_INITIAL_WINDOW_SIZE can be negative.
+ *
+ * Return Value:
+ *   (boolean) the window doesn't exceed the maximum (RFC 7540 Section 6.9.1)
+ */
+static int connection_grow_window(h2_connection_t *connection, h2_task_t *task, int64_t increment) {
+	int64_t *window = task ? &task->send_window : &connection->send_window;
+	if (*window + increment > HTTP2_WINDOW_MAX)
+		return 0;
+	*window += increment;
+	return 1;
+}
+
+/**
+ * Description:
+ *   Waits for the client to send (a part of) a frame, or for the workers
+ *   when 'block' is true and they haven't got anything for the connection
+ *   yet.
+ *
+ * Return Value:
+ *   1 if the transport is readable, 0 if not, or -1 on failure or
+ *   cancellation
+ */
+static int connection_wait(h2_connection_t *connection, int block) {
+	/* the batched control frames would wait for the next response */
+	if (block && !frame_writer_flush(&connection->writer))
+		return -1;
+	if (block) {
+		pthread_mutex_lock(&connection->mutex);
+		block = !connection->ready;
+		connection->waiting = block;
+		pthread_mutex_unlock(&connection->mutex);
+	}
+
+	int result;
+	do {
+		result = transport_wait_readable_or(connection->transport, connection->wake[0], block ? GLOBAL_SETTING_read_timeout : 0);
+	} while (block && result == 0 && !GLOBAL_SETTINGS_cancel_requested);
+
+	if (block) {
+		pthread_mutex_lock(&connection->mutex);
+		connection->waiting = 0;
+		pthread_mutex_unlock(&connection->mutex);
+	}
+	if (result > 0 && (result & TRANSPORT_WAIT_OTHER)) {
+		char buffer[64];
+		while (read(connection->wake[0], buffer, sizeof(buffer)) > 0)
+			continue;
+	}
+
+	if (result < 0 || (block && result == 0))
+		return -1;
+	return (result & TRANSPORT_WAIT_READABLE) != 0;
+}
+
+/* (boolean) sets up the connection */
+static int connection_create(h2_connection_t *connection, transport_t *transport, setentry_t *settings) {
+	memset(connection, 0, sizeof(h2_connection_t));
+	connection->transport = transport;
+	connection->settings = settings;
+	connection->send_window = 65535;
+	frame_reader_init(&connection->reader, transport);
+	frame_writer_init(&connection->writer, transport);
+	h2_scheduler_init(&connection->scheduler);
+	hpack_encoder_init(&connection->encoder, HPACK_ENCODER_TABLE_SIZE);
+	if (pipe(connection->wake) != 0) {
+		perror("[H2] Failed to create a pipe");
+		return 0;
+	}
+	fcntl(connection->wake[0], F_SETFL, O_NONBLOCK);
+	fcntl(connection->wake[1], F_SETFL, O_NONBLOCK);
+	pthread_mutex_init(&connection->mutex, NULL);
+	pthread_cond_init(&connection->condition, NULL);
+	return 1;
+}
+
+/* resets the tasks, waits for the workers and destroys the connection */
+static void connection_destroy(h2_connection_t *connection) {
+	h2_task_t *task;
+	pthread_mutex_lock(&connection->mutex);
+	for (task = connection->tasks; task; task = task->next)
+		task_reset(connection, task);
+	pthread_mutex_unlock(&connection->mutex);
+
+	while ((task = connection->tasks)) {
+		connection->tasks = task->next;
+		/* the received data isn't returned, the connection is closed anyway */
+		task->received = 0;
+		connection_destroy_task(connection, task);
+	}
+
+	frame_reader_destroy(&connection->reader);
+	hpack_encoder_destroy(&connection->encoder);
+	pthread_cond_destroy(&connection->condition);
+	pthread_mutex_destroy(&connection->mutex);
+	close(connection->wake[0]);
+	close(connection->wake[1]);
 }
 
 const char *get_frame_name(uint32_t type) {
@@ -177,8 +1206,7 @@ const char *get_frame_name(uint32_t type) {
 		return frame_types[type];
 }
 
-void http2_handle(TLS tls) {
-	uint32_t window_size = UINT16_MAX;
+void http2_handle(transport_t *transport) {
 	size_t settings_count = HTTP2_SETTINGS_COUNT;
 	setentry_t *settings = calloc(settings_count, sizeof(setentry_t));
 	/* default values as per 6.5.2 */
@@ -198,24 +1226,28 @@ void http2_handle(TLS tls) {
 	puts("\x1b[32mbegin\x1b[0m");
 	*/
 	char prefacebuf[24] = { 0 };
-	if (!tls_read_client_complete(tls, prefacebuf, 24) || !scomp(prefacebuf, preface, 24)) {
+	if (!transport_read_complete(transport, prefacebuf, 24) || !scomp(prefacebuf, preface, 24)) {
 		PRTERR("[H2] Preface io/comparison failure.\n");
+		free(settings);
+		return;
+	}
+
+	h2_connection_t connection;
+	if (!connection_create(&connection, transport, settings)) {
+		free(settings);
 		return;
 	}
 	H2_ERROR error = H2_NO_ERROR;
 	
-	frame_t *frame = readfr(tls, settings[4].value, &error);
+	frame_t *frame = frame_reader_read(&connection.reader, settings[4].value, &error);
 	
 	/** Dynamic Table */
 	dynamic_table_t *dynamic_table = NULL;
 	http_header_list_t *headers = NULL;
-	size_t i;
 	
-	send_settings(tls);
-	/* send WINDOW_UPDATE frame */{
-		uint32_t size = 0x7FFF0000;
-		send_frame(tls, 4, FRAME_WINDOW_UPDATE, 0x0, 0x0, (char *)&size);
-	}
+	send_settings(&connection.writer);
+	/* the connection's window is as large as possible, the windows of the streams limit the bodies */
+	send_window_update(&connection.writer, 0x0, 0x7FFF0000);
 
 	h2stream_list_t *streams = h2stream_list_create(65535);
 
@@ -226,84 +1258,112 @@ void http2_handle(TLS tls) {
 		origin_frame[0] = (len >> 8) & 0xFF;
 		origin_frame[1] = len & 0xFF;
 		memcpy(origin_frame, GLOBAL_SETTING_origin, len);
-		send_frame(tls, 2 + len, FRAME_ORIGIN, 0x0, 0x0, origin_frame);
+		frame_writer_queue(&connection.writer, 2 + len, FRAME_ORIGIN, 0x0, 0x0, origin_frame);
 		free(origin_frame);
 	}
 	
 	if (frame) {
 		if (frame->type != 0x4) {
 			PRTERR("[H2] Protocol error: first frame wasn't a settings frame!");
-			send_goaway(tls, H2_PROTOCOL_ERROR, 0x0);
-			goto end;
+			send_goaway(&connection.writer, H2_PROTOCOL_ERROR, 0x0);
+			goto frame_end;
 		}
 
 		/* SETTINGS frames should have a length of a multiple of 6 octets. */
 		if (frame->length % 6 != 0) {
 			puts("\x1b[33m > Invalid settings frame (length error).\x1b[0m");
-			send_goaway(tls, H2_FRAME_SIZE_ERROR, 0x0);
+			send_goaway(&connection.writer, H2_FRAME_SIZE_ERROR, 0x0);
 			goto frame_end;
 		}
 	
 		H2_ERROR result = handle_settings(frame, settings);
-		free(frame->data);
-		free(frame);
+		frame_reader_release(&connection.reader, frame);
     
 		if (result != H2_NO_ERROR) {
 			puts("\x1b[33m > Invalid settings frame.\x1b[0m");
-			send_goaway(tls, H2_FRAME_SIZE_ERROR, 0x0);
+			send_goaway(&connection.writer, result, 0x0);
 			goto end;
 		}
+		hpack_encoder_set_max_size(&connection.encoder, settings[0].value);
 		
-		send_settings_ack(tls);
+		send_settings_ack(&connection.writer);
 		headers = http_create_header_list();
 		headers->version = HTTP_VERSION_2;
 		
 		size_t previous_type = 0x4;
 
-		while ((frame = readfr(tls, settings[4].value, &error))) {
+		for (;;) {
+			/* the responses are sent in turns, the connection only waits when there's nothing to send */
+			int sent = connection_send(&connection, streams);
+			if (sent < 0)
+				goto end;
+			/* a frame that was read ahead doesn't need the transport, the rest
+			 * of a frame is read as it arrives, so the responses are sent meanwhile */
+			int ready = frame_reader_ready(&connection.reader);
+			int readable = connection_wait(&connection, !sent && !ready);
+			if (readable < 0)
+				goto end;
+			if (!ready) {
+				if (!readable)
+					continue;
+				if (!frame_reader_receive(&connection.reader))
+					break;
+			}
+			if (!(frame = frame_reader_next(&connection.reader, settings[4].value, &error))) {
+				if (error != H2_NO_ERROR)
+					break;
+				continue;
+			}
+
 			#ifdef BENCHMARK			
 				clock_t start_time = clock();
 			#endif
 
+			h2_task_t *task;
 			switch (h2stream_get_state(streams, frame->r_s_id)) {
 				case H2_STREAM_IDLE:
 					if (frame->type == FRAME_HEADERS) {
 						h2stream_set_state(streams, frame->r_s_id, H2_STREAM_OPEN);
 					} else if (frame->type != FRAME_PRIORITY) {
 						printf("PROTOCOL_ERROR: Client has sent a %s on a stream which is idle.\n", get_frame_name(frame->type));
-						send_goaway(tls, H2_PROTOCOL_ERROR, frame->r_s_id);
+						send_goaway(&connection.writer, H2_PROTOCOL_ERROR, frame->r_s_id);
 						goto frame_end;
 					}
 					break;
 				case H2_STREAM_HALF_CLOSED_LOCAL:
 					if (frame->type != FRAME_WINDOW_UPDATE && frame->type != FRAME_PRIORITY && frame->type != FRAME_RST_STREAM) {
 						printf("PROTOCOL_ERROR: Client has sent a %s on a stream which is half_closed (local).\n", get_frame_name(frame->type));
-						send_goaway(tls, H2_STREAM_CLOSED, frame->r_s_id);
+						send_goaway(&connection.writer, H2_STREAM_CLOSED, frame->r_s_id);
 						goto frame_end;
 					}
 					break;
 				case H2_STREAM_HALF_CLOSED_REMOTE:
 					if (frame->type != FRAME_WINDOW_UPDATE && frame->type != FRAME_PRIORITY && frame->type != FRAME_RST_STREAM) {
 						printf("PROTOCOL_ERROR: Client has sent a %s on a stream which is half_closed (remote).\n", get_frame_name(frame->type));
-						send_goaway(tls, H2_STREAM_CLOSED, frame->r_s_id);;
+						send_goaway(&connection.writer, H2_STREAM_CLOSED, frame->r_s_id);;
 						goto frame_end;
 					}
 					break;
 				case H2_STREAM_CLOSED_STATE:
 					if (frame->type != FRAME_PRIORITY) {
+						/* the rest of a body after the stream was reset, see task_run */
+						if (frame->type == FRAME_DATA)
+							break;
 						if (frame->type == FRAME_WINDOW_UPDATE || frame->type == FRAME_RST_STREAM) {
-							printf("TODO: Client has sent a %s on a stream which is closed (may be a short time after closing).\n", get_frame_name(frame->type));
+							/* these may have been sent before the client saw the stream close */
+							if (!h2stream_recently_closed(streams, frame->r_s_id))
+								printf("TODO: Client has sent a %s on a stream which is closed (may be a short time after closing).\n", get_frame_name(frame->type));
 							break;
 						}
 						printf("PROTOCOL_ERROR: Client has sent a %s on a stream which is closed.\n", get_frame_name(frame->type));
-						send_goaway(tls, H2_STREAM_CLOSED, frame->r_s_id);
+						send_goaway(&connection.writer, H2_STREAM_CLOSED, frame->r_s_id);
 						goto frame_end;
 					}
 					break;
 				case H2_STREAM_RESERVED_LOCAL:
 					if (frame->type != FRAME_WINDOW_UPDATE && frame->type != FRAME_PRIORITY && frame->type != FRAME_RST_STREAM) {
 						printf("PROTOCOL_ERROR: Client has sent a %s on a stream which is reserved (local).\n", get_frame_name(frame->type));
-						send_goaway(tls, H2_PROTOCOL_ERROR, frame->r_s_id);
+						send_goaway(&connection.writer, H2_PROTOCOL_ERROR, frame->r_s_id);
 					}
 					break;
 				default:
@@ -312,20 +1372,53 @@ void http2_handle(TLS tls) {
 
 			switch (frame->type) {
 				case FRAME_DATA:
-					
+					if (frame->r_s_id == 0x0) {
+						send_goaway(&connection.writer, H2_PROTOCOL_ERROR, 0x0);
+						goto frame_end;
+					}
+					if ((task = connection_find_task(&connection, frame->r_s_id & BITS31))) {
+						uint8_t flags = frame->flags;
+						/* the frame is taken over by the task */
+						H2_ERROR data_error = connection_receive_data(&connection, task, frame, streams);
+						if (data_error != H2_NO_ERROR) {
+							send_goaway(&connection.writer, data_error, 0x0);
+							goto end;
+						}
+						if ((flags & FLAG_END_STREAM) && h2stream_get_state(streams, task->stream) != H2_STREAM_CLOSED_STATE)
+							h2stream_set_state(streams, task->stream, H2_STREAM_HALF_CLOSED_REMOTE);
+						previous_type = FRAME_DATA;
+						continue;
+					}
+					/* the body of a stream that was reset after its response, see task_run */
+					if (frame->length > 0 && !send_window_update(&connection.writer, 0x0, frame->length))
+						goto frame_end;
 					break;
 				case FRAME_HEADERS:
-					if (!dynamic_table) {
-						size_t client_max_size = 0;
-						for (i = 0; i < settings_count; i++) {
-							if (settings[i].id == HTTP2_SETTINGS_TABLE_SIZE) {
-								client_max_size = settings[i].value;
-							}
+					/* the size of the table of the client's encoder is limited by
+					 * the SETTINGS_HEADER_TABLE_SIZE of the server, which isn't sent */
+					if (!dynamic_table && !(dynamic_table = dynamic_table_create(DYNAMIC_TABLE_SIZE)))
+						goto frame_end;
+
+					/* trailers end the body of a request that is being handled, they aren't used */
+					if ((task = connection_find_task(&connection, frame->r_s_id & BITS31))) {
+						http_header_list_t *trailers = http_create_header_list();
+						int decoded = trailers && handle_headers(frame, dynamic_table, trailers);
+						if (trailers)
+							http_destroy_header_list(trailers);
+						if (!decoded) {
+							send_goaway(&connection.writer, H2_COMPRESSION_ERROR, 0x0);
+							goto frame_end;
 						}
-						dynamic_table = dynamic_table_create(client_max_size);
+						connection_receive_trailers(&connection, task, frame, streams);
+						break;
 					}
 					
-					handle_headers(frame, dynamic_table, headers);
+					if (!handle_headers(frame, dynamic_table, headers)) {
+						send_goaway(&connection.writer, H2_COMPRESSION_ERROR, 0x0);
+						goto frame_end;
+					}
+					if (transport_in_early_data(transport))
+						headers->early_data = 1;
 					
 					if (frame->flags & FLAG_END_HEADERS) {
 						/*puts("+======== HeaderList ========+");
@@ -337,26 +1430,47 @@ void http2_handle(TLS tls) {
 							printf("Type='%s'\n", http_header_type_names[headers->headers[i]->type]);
 						}
 						*/
-						
-						h2_handle(tls, frame, headers, settings);
-						http_destroy_header_list(headers);
+
+						/* the client may retry a refused request (RFC 7540 Section 8.1.4) */
+						if (connection.task_count >= GLOBAL_SETTING_h2_max_concurrent_streams
+							|| !connection_start_task(&connection, frame, headers)) {
+							send_rst(&connection.writer, H2_REFUSED_STREAM, frame->r_s_id);
+							h2stream_set_state(streams, frame->r_s_id, H2_STREAM_CLOSED_STATE);
+							http_destroy_header_list(headers);
+						}
 						headers = http_create_header_list();
 						headers->version = HTTP_VERSION_2;
 					}
 					break;
-				case FRAME_PRIORITY: {
+				case FRAME_PRIORITY:
 					if (frame->length != 5) {
-						/* connection error */
-						send_rst(tls, H2_FRAME_SIZE_ERROR);
-						goto frame_end;
+						/* a stream error (RFC 7540 Section 6.3) */
+						send_rst(&connection.writer, H2_FRAME_SIZE_ERROR, frame->r_s_id);
+						h2stream_set_state(streams, frame->r_s_id, H2_STREAM_CLOSED_STATE);
+						break;
 					}
 					
-					char e = frame->data[0] & 0x10;
-					uint32_t stream_dependency = u32(frame->data) & BITS31;
-					uint8_t weight = frame->data[4];
-					
-					printf("\x1b[35mPriority> \x1b[0mstream=%u e=%s s-depend=%u weight=%hhi\n", frame->r_s_id & BITS31, e ? "true" : "false", stream_dependency, weight);
-				} break;
+					/* the dependencies aren't used, only the weight (RFC 9218 Section 2.1) */
+					if ((task = connection_find_task(&connection, frame->r_s_id & BITS31)) && !task->extensible_priority)
+						h2_scheduler_set_priority(&connection.scheduler, &task->node, h2_priority_from_weight((frame->data[4] & 0xFF) + 1));
+					break;
+				case FRAME_PRIORITY_UPDATE:
+					if ((frame->r_s_id & BITS31) != 0x0) {
+						send_goaway(&connection.writer, H2_PROTOCOL_ERROR, 0x0);
+						goto frame_end;
+					}
+					if (frame->length < 4) {
+						send_goaway(&connection.writer, H2_FRAME_SIZE_ERROR, 0x0);
+						goto frame_end;
+					}
+					/* the priority of a stream that hasn't been opened yet isn't remembered */
+					if ((task = connection_find_task(&connection, u32(frame->data) & BITS31))) {
+						h2_priority_t priority = h2_priority_default();
+						h2_priority_parse(&priority, frame->data + 4, frame->length - 4);
+						h2_scheduler_set_priority(&connection.scheduler, &task->node, priority);
+						task->extensible_priority = 1;
+					}
+					break;
 				case FRAME_RST_STREAM:
 					/*
 					fputs("\x1b[33mEnd (semi-gracefully) requested, ", stdout);
@@ -371,48 +1485,76 @@ void http2_handle(TLS tls) {
 					 * the recipient MUST treat this as a connection error (Section 5.4.1)
 					 * of type PROTOCOL_ERROR */
 					if (frame->r_s_id == 0x0) {
-						send_goaway(tls, H2_PROTOCOL_ERROR, 0x0);
+						send_goaway(&connection.writer, H2_PROTOCOL_ERROR, 0x0);
 						goto frame_end;
 					}
 					h2stream_set_state(streams, frame->r_s_id, H2_STREAM_CLOSED_STATE);
+					if ((task = connection_find_task(&connection, frame->r_s_id & BITS31))) {
+						pthread_mutex_lock(&connection.mutex);
+						task_reset(&connection, task);
+						pthread_mutex_unlock(&connection.mutex);
+					}
 					break;
 				case FRAME_SETTINGS:
 					if (!(frame->flags & FLAG_ACK)) {
-						send_settings_ack(tls);
+						if (frame->length % 6 != 0) {
+							puts("\x1b[33m > Invalid settings frame (length error).\x1b[0m");
+							send_goaway(&connection.writer, H2_FRAME_SIZE_ERROR, 0x0);
+							goto frame_end;
+						}
+
+						int64_t initial_window = settings[3].value;
+						H2_ERROR result = handle_settings(frame, settings);
+						/* a new initial window changes the windows of the open streams (RFC 7540 Section 6.9.2) */
+						for (task = connection.tasks; result == H2_NO_ERROR && task; task = task->next)
+							if (!connection_grow_window(&connection, task, settings[3].value - initial_window))
+								result = H2_FLOW_CONTROL_ERROR;
+						if (result != H2_NO_ERROR) {
+							puts("\x1b[33m > Invalid settings frame.\x1b[0m");
+							send_goaway(&connection.writer, result, 0x0);
+							goto frame_end;
+						}
+						hpack_encoder_set_max_size(&connection.encoder, settings[0].value);
+						send_settings_ack(&connection.writer);
 					}
 					break;
 				case FRAME_PING:
 					/* PING frames should have a length of 8 octets. */
 					if (frame->length != 8) {
 						puts("\x1b[33m > Invalid ping frame (length error).\x1b[0m");
-						send_goaway(tls, H2_FRAME_SIZE_ERROR, 0x0);
+						send_goaway(&connection.writer, H2_FRAME_SIZE_ERROR, 0x0);
 						goto frame_end;
 					}
 					if (!(frame->flags & FLAG_ACK)) {
-						send_frame(tls, 8, FRAME_PING, FLAG_ACK, 0x0, frame->data);
+						frame_writer_queue(&connection.writer, 8, FRAME_PING, FLAG_ACK, 0x0, frame->data);
 					}
 					break;
 				case FRAME_GOAWAY:
 					printf("\x1b[31m > GOAWAY ErrorCode=%s\x1b[0m\n", h2_error_codes[u32(frame->data+4)]);
 					break;
-				case FRAME_WINDOW_UPDATE:
+				case FRAME_WINDOW_UPDATE: {
 					if (frame->length != 4) {
-						/* connection error */
-						send_rst(tls, H2_FRAME_SIZE_ERROR);
+						send_goaway(&connection.writer, H2_FRAME_SIZE_ERROR, 0x0);
 						goto frame_end;
 					}
-					uint32_t wsi = u32(frame->data) & 0xEFFFFFFF;
-					if (window_size == wsi) {
-						/* connection error */
-						puts("Illegal Window Size! (i.e. a PROTOCOL_ERROR)");
-						send_rst(tls, H2_PROTOCOL_ERROR);
-						goto frame_end;
+					uint32_t increment = u32(frame->data) & BITS31;
+					uint32_t stream = frame->r_s_id & BITS31;
+					if (stream == 0x0) {
+						if (increment == 0 || !connection_grow_window(&connection, NULL, increment)) {
+							puts("Illegal Window Size! (i.e. a PROTOCOL_ERROR)");
+							send_goaway(&connection.writer, increment == 0 ? H2_PROTOCOL_ERROR : H2_FLOW_CONTROL_ERROR, 0x0);
+							goto frame_end;
+						}
+					} else if ((task = connection_find_task(&connection, stream))
+							   && (increment == 0 || !connection_grow_window(&connection, task, increment))) {
+						/* a stream error (RFC 7540 Section 6.9) */
+						send_rst(&connection.writer, increment == 0 ? H2_PROTOCOL_ERROR : H2_FLOW_CONTROL_ERROR, stream);
+						h2stream_set_state(streams, stream, H2_STREAM_CLOSED_STATE);
+						pthread_mutex_lock(&connection.mutex);
+						task_reset(&connection, task);
+						pthread_mutex_unlock(&connection.mutex);
 					}
-					/*
-					printf(" > Size Increment: 0x%X or 0x%X = %u %u\n", u32(frame->data), wsi, u32(frame->data), wsi);
-					printf(" > Additional data: a=0x%hhx b=0x%hhx c=0x%hhx d=0x%hhx\n", frame->data[0], frame->data[1], frame->data[2], frame->data[3]);
-					*/
-					break;
+				} break;
 				case FRAME_CONTINUATION:
 					switch (previous_type) {
 						case 0x4: /* HEADERS */
@@ -431,7 +1573,7 @@ void http2_handle(TLS tls) {
 			if (frame->flags & FLAG_END_STREAM) {
 				if (frame->r_s_id == 0) {
 					puts("TODO: END_STREAM flag set on stream 0!");
-				} else {
+				} else if (h2stream_get_state(streams, frame->r_s_id) != H2_STREAM_CLOSED_STATE) {
 					h2stream_set_state(streams, frame->r_s_id, H2_STREAM_HALF_CLOSED_REMOTE);
 				}
 			}
@@ -440,20 +1582,18 @@ void http2_handle(TLS tls) {
 			printf("\033[0;33mFrame> \033[0;32m%s \033[0mtook \033[0;35m%.3f ms\033[0m to process...\n", frame_types[frame->type], (clock()-start_time)/1000.0);
 #endif
 
-			free(frame->data);
 			previous_type = frame->type;
-			free(frame);
+			frame_reader_release(&connection.reader, frame);
 			continue;
 			
 			frame_end:
-			free(frame->data);
 			previous_type = frame->type;
-			free(frame);
+			frame_reader_release(&connection.reader, frame);
 			goto end;
 		}
 		
 		if (error != H2_NO_ERROR) {
-			send_goaway(tls, error, 0x0);
+			send_goaway(&connection.writer, error, 0x0);
 			fputs("\x1b[31m[H2] Error: ", stdout);
 			if (error < H2_ERROR_CODE_COUNT)
 				puts(h2_error_codes[error]);
@@ -467,11 +1607,13 @@ void http2_handle(TLS tls) {
 		if (error == H2_NO_ERROR) {
 			PRTERR("I/O failure for settings frame.");
 		} else {
-			send_goaway(tls, error, 0x0);
+			send_goaway(&connection.writer, error, 0x0);
 		}
 	}
 	
 	end:
+	frame_writer_flush(&connection.writer);
+	connection_destroy(&connection);
 	free(settings);
 	if (streams)
 		h2stream_list_destroy(streams);
@@ -483,9 +1625,9 @@ void http2_handle(TLS tls) {
 }
 
 int http2_setup() {
-	return huff_setup();
+	/* the Huffman decoder uses a table that is generated at build time */
+	return 1;
 }
 
 void http2_destroy() {
-	huff_destroy();
 }
@@ -9,9 +9,9 @@
 #include <stddef.h>
 
 #include "../http/common.h"
-#include "../secure/tlsutil.h"
+#include "../transport/transport.h"
 
-void http2_handle(TLS);
+void http2_handle(transport_t *);
 
 int http2_setup(void);
 void http2_destroy(void);
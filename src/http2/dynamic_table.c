@@ -1,93 +1,104 @@
 /**
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
- * 
- * This file contains symbols describing functions about the dynamic & static tables.
+ *
+ * For information about these functions/symbols, see dynamic_table.h
+ *
+ * The names and values are stored as "name\0value\0" in the arena, after the
+ * newest entry, or at the start of the arena when they don't fit before its
+ * end. The octets of an entry are at most its size - 30, so with an arena of
+ * twice the maximum size there is always room: the entries take at most the
+ * maximum size minus the size of the new entry, and the end that is skipped
+ * is smaller than the maximum size.
  */
-#include <stddef.h>
-#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "dynamic_table.h"
-#include "static_table.h"
 
-
-/**
- * To be tactical, I did a quick header-count test:
- * 
- * |----------------------------------------------|--------------|----------------|
- * |                  User Agent                  | Header Count | Browser Engine |
- * |----------------------------------------------|--------------|----------------|
- * |               Safari (iOS 13.3)              |       8      |     WebKit     |
- * |   Microsoft Internet Explorer (Trident/7.0)  |       8      |    Trident 7.0 |
- * |            Microsoft Edge/18.1776            |       9      |     EdgeHTML   |
- * |           Firefox Nightly (74.0a1)           |      10      |   Gecko/Necko  |
- * |         Tor 9.0.5 (Firefox 68.4.1esr)        |      10      |   Gecko/Necko  |
- * |         Microsoft Edg(e) 79.0.309.71         |      12      |    Chromium    |
- * |        Chrome & Chromium 79.0.3945.117       |      12      |    Chromium    |
- * | Brave Version 1.2.43 Chromium: 79.0.3945.130 |      13      |    Chromium    |
- * |----------------------------------------------|--------------|----------------|
- */
-
-#define STATIC_TABLE_STEP_SIZE    2
-#define STATIC_TABLE_INITIAL_SIZE 8
-
-dynamic_table_t *dynamic_table_create(size_t client_max_size) {
+dynamic_table_t *dynamic_table_create(size_t max_size) {
 	dynamic_table_t *table = malloc(sizeof(dynamic_table_t));
-	table->size = STATIC_TABLE_INITIAL_SIZE;
-	table->entries = malloc(table->size * sizeof(dyn_entry_t *));
-	table->index_last = client_max_size;
-	table->client_max_size = client_max_size;
+	if (!table)
+		return NULL;
+	table->first = 0;
+	table->count = 0;
+	table->size = 0;
+	table->max_size = max_size > DYNAMIC_TABLE_SIZE ? DYNAMIC_TABLE_SIZE : max_size;
 	return table;
 }
 
 void dynamic_table_destroy(dynamic_table_t *table) {
-	/*
-	printf("Destroying the dynamic table. Size: %zu, index_last: %zu\n", table->size, table->index_last);
-	*/
-	if (table->entries && table->size > 0 && table->index_last != table->client_max_size) {
-		size_t i;
-		for (i = 0; i < table->index_last + 1; i++) {
-			free(table->entries[i]->key);
-			free(table->entries[i]->value);
-			free(table->entries[i]);
-		}
-		free(table->entries);
-	}
 	free(table);
 }
 
 lookup_t dynamic_table_get(dynamic_table_t *table, size_t index) {
 	lookup_t res = { 0 };
-	
-	if (index < HTTP2_STATIC_TABLE_SIZE) {
-		res.static_e = static_table[index];
-	} else if (index - HTTP2_STATIC_TABLE_SIZE <= table->index_last) {
-		res.dynamic = table->entries[table->index_last - index + HTTP2_STATIC_TABLE_SIZE];
+
+	if (index > 0 && index < HTTP2_STATIC_TABLE_SIZE) {
+		res.static_e = &static_table[index];
+	} else if (index - HTTP2_STATIC_TABLE_SIZE < table->count) {
+		/* the newest entry has the lowest index */
+		size_t position = table->first + table->count - 1 - (index - HTTP2_STATIC_TABLE_SIZE);
+		res.dynamic = &table->entries[position % DYNAMIC_TABLE_ENTRIES];
 	}
 
 	return res;
 }
 
-int dynamic_table_add(dynamic_table_t *table, char *key, char *value) {
-	if (table->index_last == table->client_max_size)
-		table->index_last = 0;
-	else
-		table->index_last++;
-	if (table->size <= table->index_last) {
-		table->size += STATIC_TABLE_STEP_SIZE;
-		dyn_entry_t **new_entries = realloc(table->entries, table->size * sizeof(dyn_entry_t *));
-		
-		if (!new_entries)
-			return 0;
-		table->entries = new_entries;
+/* the size of an entry (RFC 7541 Section 4.1) */
+static size_t entry_size(const dyn_entry_t *entry) {
+	return entry->key_length + entry->value_length + 32;
+}
+
+/* removes the oldest entries until 'size' more fits */
+static void evict(dynamic_table_t *table, size_t size) {
+	while (table->count > 0 && table->size + size > table->max_size) {
+		table->size -= entry_size(&table->entries[table->first]);
+		table->first = (table->first + 1) % DYNAMIC_TABLE_ENTRIES;
+		table->count -= 1;
 	}
-	
-	dyn_entry_t *entry = malloc(sizeof(dyn_entry_t));
-	entry->key = key;
-	entry->value = value;
-	table->entries[table->index_last] = entry;
-	
-	return 1;
 }
 
+void dynamic_table_add(dynamic_table_t *table, const char *key, size_t key_length, const char *value, size_t value_length) {
+	size_t size = key_length + value_length + 32;
+	evict(table, size);
+	if (size > table->max_size)
+		return;
+
+	/* the octets of the entry, with the null-terminators */
+	size_t length = key_length + value_length + 2;
+	size_t offset = 0;
+	if (table->count > 0) {
+		const dyn_entry_t *oldest = &table->entries[table->first];
+		const dyn_entry_t *newest = &table->entries[(table->first + table->count - 1) % DYNAMIC_TABLE_ENTRIES];
+		size_t head = oldest->key - table->arena;
+		size_t tail = newest->value + newest->value_length + 1 - table->arena;
+		/* after the newest entry, unless the entries wrap around already, or
+		 * the entry doesn't fit before the end of the arena */
+		if (tail > head && tail + length <= DYNAMIC_TABLE_ARENA_SIZE)
+			offset = tail;
+		else if (tail < head)
+			offset = tail;
+	}
+
+	dyn_entry_t *entry = &table->entries[(table->first + table->count) % DYNAMIC_TABLE_ENTRIES];
+	entry->key = table->arena + offset;
+	entry->key_length = key_length;
+	memcpy(entry->key, key, key_length);
+	entry->key[key_length] = 0;
+	entry->value = entry->key + key_length + 1;
+	entry->value_length = value_length;
+	memcpy(entry->value, value, value_length);
+	entry->value[value_length] = 0;
+
+	table->size += size;
+	table->count += 1;
+}
+
+int dynamic_table_set_max_size(dynamic_table_t *table, size_t max_size) {
+	if (max_size > DYNAMIC_TABLE_SIZE)
+		return 0;
+	table->max_size = max_size;
+	evict(table, 0);
+	return 1;
+}
@@ -1,106 +1,105 @@
 /**
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
- * 
- * This file contains symbols describing functions about the dynamic & static tables.
+ *
+ * This file contains the dynamic table of the HPACK decoder (RFC 7541 Section
+ * 2.3.2), the headers the client has indexed. The size of the table is
+ * counted as RFC 7541 Section 4.1 does: the lengths of the name and the value
+ * plus 32 for each entry, and the oldest entries are evicted when a new one
+ * doesn't fit. The names and values are stored in one arena that is used as
+ * a ring, so adding an entry doesn't allocate.
  */
 #ifndef HTTP2_DYNAMIC_TABLE_H
 #define HTTP2_DYNAMIC_TABLE_H
 #include <stddef.h>
 
-extern const char *static_table[];
+#include "static_table.h"
+
+/* The most the client may use: the initial SETTINGS_HEADER_TABLE_SIZE, the
+ * server doesn't send another value. */
+#define DYNAMIC_TABLE_SIZE 4096
+/* the most entries that fit, an entry is at least 32 */
+#define DYNAMIC_TABLE_ENTRIES (DYNAMIC_TABLE_SIZE / 32)
+/* an entry is stored in one piece, with the evicted entries before it the
+ * arena has to be twice the table to always have room */
+#define DYNAMIC_TABLE_ARENA_SIZE (2 * DYNAMIC_TABLE_SIZE)
 
 /**
- * The dynamic table entry structure. Very straightforward.
+ * The dynamic table entry structure. The key and the value are null-
+ * terminated and point into the arena of the table, they are only valid until
+ * the next entry is added or the size of the table is changed.
  */
 typedef struct dyn_entry_t {
 	char *key;
 	char *value;
+	size_t key_length;
+	size_t value_length;
 } dyn_entry_t;
 
 /**
  * This is the structure sent by dynamic_table_get.
  *
- * If dynamic is NULL, check for static_e, if that is NULL, 
+ * If dynamic is NULL, check for static_e, if that is NULL,
  * the index was outside the tables' bounds.
  */
 typedef struct lookup_t {
 	/** The dynamic table entry, if gotten from there. */
 	dyn_entry_t *dynamic;
 	/** The static table entry, if gotten from there. */
-	const char *static_e;
+	const static_table_entry_t *static_e;
 } lookup_t;
 
 typedef struct dynamic_table_t {
 	/**
-	 * The array of pointers pointing to dynamic table entries.
+	 * A ring of the entries, the oldest is at 'first'.
 	 */
-	dyn_entry_t **entries;
+	dyn_entry_t entries[DYNAMIC_TABLE_ENTRIES];
+	size_t first;
+	size_t count;
 	/**
-	 * The size of 'entries' in 'dyn_entry_t *'s.
-	 * This isn't the size supplied to malloc()!,
-	 * but the as in:
-	 * entries = malloc(sizeof(dyn_entry_t *) * size);
+	 * The sum of the sizes of the entries (RFC 7541 Section 4.1).
 	 */
 	size_t size;
 	/**
-	 * The index of the last entry, as 'entries' can 
-	 *  be bigger than the entries inside of it.
+	 * The maximum size, which the client changes with Dynamic Table
+	 * Size Updates. It is at most DYNAMIC_TABLE_SIZE.
 	 */
-	size_t index_last;
+	size_t max_size;
 	/**
-	 * The value of SETTINGS_HEADER_TABLE_SIZE. This value MAY 
-	 * be used by the server, but 'size' exceeding this value 
-	 * is incorrect.
+	 * The names and values of the entries, in the order of the entries.
 	 */
-	size_t client_max_size;
+	char arena[DYNAMIC_TABLE_ARENA_SIZE];
 } dynamic_table_t;
 
 /**
  * Description:
- *   This function will create a dynamic table.
- * 
+ *   This function will create an empty dynamic table.
+ *
  * Parameters:
  *   size_t
- *     The initial size of the dynamic table, supplied 
- *     by the client.
- *
- * Notes:
- *   The size that the clients supplies may or may not be the 
- *   actual initial size of the dynamic table. This is up to 
- *   the implementation, as some restrictions have to be set.
- *   This is because the underlying system can't allocate large
- *   blobs of data for just one client. Also the client may 
- *   even crash the server if we don't check the size.
+ *     The maximum size of the dynamic table, at most DYNAMIC_TABLE_SIZE.
  *
  * Return Value:
- *   The dynamic table.
+ *   The dynamic table, or NULL if the allocation failed.
  */
 dynamic_table_t *dynamic_table_create(size_t);
 
 /**
  * Description:
- *   This function will destroy a dynamic table.
- * 
+ *   This function will destroy a dynamic table, including the names and
+ *   values of its entries.
+ *
  * Parameters:
  *   dynamic_table_t *
  *     The dynamic table.
- *
- * Notes:
- *   This function will destroy:
- *   - The dynamic table entries' contents.
- *   - The dynamic table entries.
- *   - The pointer to the pointers of entries.
- *   - The dynamic table object.
- *   Essentially all the data inside the dynamic table.
  */
 void dynamic_table_destroy(dynamic_table_t *);
 
 /**
  * Description:
- *   This function will get a value either from the static - 
+ *   This function will get a value either from the static -
  *   or dynamic table.
- * 
+ *
  * Parameters:
  *   dynamic_table_t *
  *     The dynamic table.
@@ -108,7 +107,7 @@ void dynamic_table_destroy(dynamic_table_t *);
  *     The index of the entry.
  *
  * Notes:
- *   If the index is outside the bounds of the tables, no valid 
+ *   If the index is outside the bounds of the tables, no valid
  *   pointer will be inside the structure. This will inform the
  *   callee that the client has sent a malformed request.
  *
@@ -120,24 +119,43 @@ lookup_t dynamic_table_get(dynamic_table_t *, size_t);
 
 /**
  * Description:
- *   This function will add a header to the dynamic table.
- * 
+ *   This function will add a header to the dynamic table, after evicting
+ *   the oldest entries until it fits. An entry that is larger than the
+ *   maximum size empties the table and isn't added (RFC 7541 Section 4.4).
+ *
  * Parameters:
  *   dynamic_table_t *
  *     The dynamic table.
- *   char *
+ *   const char *
  *     The key of the header.
- *   char *
+ *   size_t
+ *     The length of the key.
+ *   const char *
  *     The value of the header.
+ *   size_t
+ *     The length of the value.
  *
  * Notes:
- *   The key & value supplied to the function will NOT be duplicated,
- *   so the callee MUST ensure these values will NOT be destroyed 
- *   before the EOL of this newly added entry.
+ *   The key & value are copied, they may not point into the table, since
+ *   the entries that are evicted can be overwritten.
+ */
+void dynamic_table_add(dynamic_table_t *, const char *, size_t, const char *, size_t);
+
+/**
+ * Description:
+ *   Handles a Dynamic Table Size Update (RFC 7541 Section 6.3), the oldest
+ *   entries are evicted until the table fits.
+ *
+ * Parameters:
+ *   dynamic_table_t *
+ *     The dynamic table.
+ *   size_t
+ *     The new maximum size.
  *
  * Return Value:
- *   (boolean) Success status.
+ *   (boolean) Success status, the size may not be larger than
+ *   DYNAMIC_TABLE_SIZE.
  */
-int dynamic_table_add(dynamic_table_t *, char *, char *);
+int dynamic_table_set_max_size(dynamic_table_t *, size_t);
 
 #endif /* HTTP2_DYNAMIC_TABLE_H */
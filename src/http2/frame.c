@@ -6,77 +6,229 @@
  */
 #include "frame.h"
 
+#include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "constants.h"
 
-frame_t *readfr(TLS tls, uint32_t max_size, H2_ERROR *error) {
-	frame_t *f = calloc(1, sizeof(frame_t));
-	if (!f)
-		return NULL;
-	char *parts = calloc(4, sizeof(char));
+void frame_reader_init(frame_reader_t *reader, transport_t *transport) {
+	reader->transport = transport;
+	reader->position = 0;
+	reader->end = 0;
+	reader->partial = NULL;
+	reader->partial_length = 0;
+	pthread_mutex_init(&reader->mutex, NULL);
+	reader->pool = NULL;
+	reader->pool_count = 0;
+}
 
-	if (!tls_read_client_complete(tls, parts, 3)) {
-		free(f);
-		free(parts);
-		return NULL;
+void frame_reader_destroy(frame_reader_t *reader) {
+	if (reader->partial)
+		frame_reader_release(reader, &reader->partial->frame);
+	while (reader->pool) {
+		frame_buffer_t *next = reader->pool->next;
+		free(reader->pool);
+		reader->pool = next;
 	}
-	
-	f->length = ((parts[0] & 0xFF) << 16) | ((parts[1] & 0xFF)  << 8) | (parts[2] & 0xFF);
-	
-	if (f->length > max_size) {
-		printf("\x1b[36mFrame> \x1b[33mMaxSizeExceedError: max=%u length=%u\n", max_size, f->length);
-		*error = H2_FRAME_SIZE_ERROR;
-		/*free(f);
-		return NULL;*/
+	pthread_mutex_destroy(&reader->mutex);
+}
+
+int frame_reader_ready(const frame_reader_t *reader) {
+	if (reader->partial)
+		return reader->partial_length == reader->partial->frame.length;
+	if (reader->end - reader->position < FRAME_HEADER_SIZE)
+		return 0;
+	const char *header = reader->input + reader->position;
+	size_t length = ((header[0] & 0xFF) << 16) | ((header[1] & 0xFF) << 8) | (header[2] & 0xFF);
+	return reader->end - reader->position >= FRAME_HEADER_SIZE + length;
+}
+
+/* moves the octets that haven't been parsed yet to the start of the input */
+static void compact(frame_reader_t *reader) {
+	memmove(reader->input, reader->input + reader->position, reader->end - reader->position);
+	reader->end -= reader->position;
+	reader->position = 0;
+}
+
+int frame_reader_receive(frame_reader_t *reader) {
+	int read;
+	if (reader->partial) {
+		/* the rest of the payload is read without going through the input */
+		frame_t *frame = &reader->partial->frame;
+		read = transport_read(reader->transport, frame->data + reader->partial_length, frame->length - reader->partial_length);
+		if (read <= 0)
+			return 0;
+		reader->partial_length += read;
+		return 1;
 	}
-	
-	if (!tls_read_client_complete(tls, (char *)&f->type, sizeof(f->type))) {
-		free(f);
-		free(parts);
-		return NULL;
+
+	if (reader->position == reader->end) {
+		reader->position = 0;
+		reader->end = 0;
+	} else if (reader->end == FRAME_READER_SIZE) {
+		compact(reader);
 	}
-	
-	if (f->length > max_size) {
-		printf("\x1b[36mFrame> type=%s (0x%x) (Error)\x1b[0m\n", frame_types[f->type], f->type);
-		free(f);
-		free(parts);
-		return NULL;
+	read = transport_read(reader->transport, reader->input + reader->end, FRAME_READER_SIZE - reader->end);
+	if (read <= 0)
+		return 0;
+	reader->end += read;
+	return 1;
+}
+
+/* a payload of the pool, or of 'length' octets when it is larger */
+static frame_buffer_t *buffer_get(frame_reader_t *reader, size_t length) {
+	frame_buffer_t *buffer = NULL;
+	if (length <= FRAME_POOL_BUFFER_SIZE) {
+		pthread_mutex_lock(&reader->mutex);
+		if ((buffer = reader->pool)) {
+			reader->pool = buffer->next;
+			reader->pool_count -= 1;
+		}
+		pthread_mutex_unlock(&reader->mutex);
+		if (buffer)
+			return buffer;
+		length = FRAME_POOL_BUFFER_SIZE;
 	}
-	
-	if (!tls_read_client_complete(tls, (char *)&f->flags, sizeof(f->flags))) {
-		free(f);
-		free(parts);
-		return NULL;
+	if ((buffer = malloc(sizeof(frame_buffer_t) + length)))
+		buffer->size = length;
+	return buffer;
+}
+
+frame_t *frame_reader_next(frame_reader_t *reader, uint32_t max_size, H2_ERROR *error) {
+	*error = H2_NO_ERROR;
+	frame_t *frame;
+	if (reader->partial) {
+		frame = &reader->partial->frame;
+		if (reader->partial_length < frame->length)
+			return NULL;
+		reader->partial = NULL;
+		reader->partial_length = 0;
+		return frame;
 	}
-	
-	if (!tls_read_client_complete(tls, parts, 4)) {
-		free(f);
-		free(parts);
+	if (reader->end - reader->position < FRAME_HEADER_SIZE)
 		return NULL;
-	}
-	f->r_s_id = u32(parts);
-	
-	if (!(f->data = malloc(sizeof(char) * f->length))) {
-		free(f);
-		free(parts);
+
+	const char *header = reader->input + reader->position;
+	frame_t parsed;
+	parsed.length = ((header[0] & 0xFF) << 16) | ((header[1] & 0xFF) << 8) | (header[2] & 0xFF);
+	parsed.type = header[3];
+	parsed.flags = header[4];
+	parsed.r_s_id = u32(header + 5);
+	if (parsed.length > max_size) {
+		printf("\x1b[36mFrame> \x1b[33mMaxSizeExceedError: max=%u length=%u\n", max_size, parsed.length);
+		printf("\x1b[36mFrame> type=%s (0x%x) (Error)\x1b[0m\n", parsed.type > FRAME_ORIGIN ? "Unassigned" : frame_types[parsed.type], parsed.type);
+		*error = H2_FRAME_SIZE_ERROR;
 		return NULL;
 	}
-	
-	if (f->length && !tls_read_client_complete(tls, f->data, f->length)) {
-		free(f->data);
-		free(f);
-		free(parts);
-		return NULL;
+
+	if (parsed.type != FRAME_DATA && parsed.length <= FRAME_READER_SIZE - FRAME_HEADER_SIZE) {
+		/* the payload is parsed where it was read, once all of it is there */
+		if (reader->end - reader->position < FRAME_HEADER_SIZE + parsed.length) {
+			if (reader->position + FRAME_HEADER_SIZE + parsed.length > FRAME_READER_SIZE)
+				compact(reader);
+			return NULL;
+		}
+		frame = &reader->frame;
+		*frame = parsed;
+		frame->data = reader->input + reader->position + FRAME_HEADER_SIZE;
+		reader->position += FRAME_HEADER_SIZE + parsed.length;
+	} else {
+		/* the octets that were read ahead are copied, the rest is read into
+		 * the payload by frame_reader_receive */
+		frame_buffer_t *buffer = buffer_get(reader, parsed.length);
+		if (!buffer) {
+			*error = H2_INTERNAL_ERROR;
+			return NULL;
+		}
+		frame = &buffer->frame;
+		*frame = parsed;
+		frame->data = (char *) (buffer + 1);
+		reader->position += FRAME_HEADER_SIZE;
+
+		size_t buffered = reader->end - reader->position;
+		if (buffered > parsed.length)
+			buffered = parsed.length;
+		memcpy(frame->data, reader->input + reader->position, buffered);
+		reader->position += buffered;
+		if (buffered < parsed.length) {
+			reader->partial = buffer;
+			reader->partial_length = buffered;
+			return NULL;
+		}
 	}
-	
+
 	#ifdef FRAME_READ_ANNOUNCE
-	printf("\x1b[36mFrame> type=%s (0x%x) stream=%x length=%u\x1b[0m\n", frame_types[f->type], f->type, f->r_s_id, f->length);
+	printf("\x1b[36mFrame> type=%s (0x%x) stream=%x length=%u\x1b[0m\n", frame_types[frame->type], frame->type, frame->r_s_id, frame->length);
+	#endif
+	return frame;
+}
+
+frame_t *frame_reader_read(frame_reader_t *reader, uint32_t max_size, H2_ERROR *error) {
+	frame_t *frame;
+	while (!(frame = frame_reader_next(reader, max_size, error)) && *error == H2_NO_ERROR)
+		if (!frame_reader_receive(reader))
+			return NULL;
+	return frame;
+}
+
+void frame_reader_release(frame_reader_t *reader, frame_t *frame) {
+	if (frame == &reader->frame)
+		return;
+
+	frame_buffer_t *buffer = (frame_buffer_t *) ((char *) frame - offsetof(frame_buffer_t, frame));
+	if (buffer->size == FRAME_POOL_BUFFER_SIZE) {
+		pthread_mutex_lock(&reader->mutex);
+		if (reader->pool_count < FRAME_POOL_MAX) {
+			buffer->next = reader->pool;
+			reader->pool = buffer;
+			reader->pool_count += 1;
+			buffer = NULL;
+		}
+		pthread_mutex_unlock(&reader->mutex);
+	}
+	free(buffer);
+}
+
+/*#define FRAME_SEND_DEBUG*/
+static void write_header(char *header, uint32_t length, char type, char flags, uint32_t stream) {
+	header[0] = length >> 16;
+	header[1] = length >> 8;
+	header[2] = length & 0x000000FF;
+	header[3] = type;
+	header[4] = flags;
+	header[5] = stream >> 24;
+	header[6] = stream >> 16;
+	header[7] = stream >> 8;
+	header[8] = stream & 0x000000FF;
+}
+
+/* (boolean) writes 'batch_length' octets of 'batch' and the frame */
+static int write_frame(transport_t *transport, const char *batch, size_t batch_length,
+					   uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	#ifdef FRAME_SEND_DEBUG_VERBOSE
+	printf("[\x1b[33mSendFrame\x1b[0m] \x1b[33mType: %s Stream: 0x%x\x1b[0m\n", frame_types[(size_t)type], stream);
+	printf("\x1b[33m`-> length=%u type=%hi flags=0x%hx stream=%u pdata=%p batched=%zu\n\x1b[0m", length, type, flags, stream, data, batch_length);
 	#endif
-	
-	free(parts);
-	return f;
+
+	char header[FRAME_HEADER_SIZE];
+	write_header(header, length, type, flags, stream);
+
+	struct iovec parts[3];
+	int count = 0;
+	if (batch_length > 0) {
+		parts[count].iov_base = (char *) batch;
+		parts[count++].iov_len = batch_length;
+	}
+	parts[count].iov_base = header;
+	parts[count++].iov_len = FRAME_HEADER_SIZE;
+	if (data && length) {
+		parts[count].iov_base = (char *) data;
+		parts[count++].iov_len = length;
+	}
+	return transport_writev(transport, parts, count);
 }
 
 /**
@@ -84,50 +236,45 @@ frame_t *readfr(TLS tls, uint32_t max_size, H2_ERROR *error) {
  *   Sends a frame.
  * 
  * Parameters:
- *   Except for 'TLS' as the source, are all the parameters types of HTTP frames.
+ *   Except for the transport as the source, are all the parameters types of HTTP frames.
  *   See RFC 7540 Section 4.1
  * 
  * Return Value:
  *   (boolean) I/O success status 
  */
-/*#define FRAME_SEND_DEBUG*/
-int send_frame(TLS tls, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
-	#ifdef FRAME_SEND_DEBUG_VERBOSE
-	printf("[\x1b[33mSendFrame\x1b[0m] \x1b[33mType: %s Stream: 0x%x\x1b[0m\n", frame_types[(size_t)type], stream);
-	#endif
-  
-	#ifdef FRAME_SEND_DEBUG_VERBOSE
-	printf("\x1b[33m`-> length=%u type=%hi flags=0x%hx stream=%u pdata=%p\n\x1b[0m", length, type, flags, stream, data);
-	#endif
-  
-	char *buf = malloc(9 + length);
-	if (!buf) return 0;
-	buf[0] = length >> 16;
-	buf[1] = length >> 8;
-	buf[2] = length & 0x000000FF;
-	buf[3] = type;
-	buf[4] = flags;
-	buf[5] = stream >> 24;
-	buf[6] = stream >> 16;
-	buf[7] = stream >> 8;
-	buf[8] = stream & 0x000000FF;
-	
-	#ifdef FRAME_SEND_DEBUG_VERBOSE
-	printf("%i %i\n", !!(data), !!(length));
-	#endif
-  
-	if (data && length) {
-		memcpy(buf+9, data, length);
-  }
-  
-	#ifdef FRAME_SEND_DEBUG_VERBOSE
-	size_t j;
-	for (j = 0; j < 9 + length; j++)
-		printf("\x1b[33m> (%zu) 0x%hhx\n\x1b[0m", j, buf[j]);
-	#endif
-  
-	int res = tls_write_client(tls, buf, 9 + length);
-	free(buf);
-	return res;
+int send_frame(transport_t *transport, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	return write_frame(transport, NULL, 0, length, type, flags, stream, data);
+}
+
+void frame_writer_init(frame_writer_t *writer, transport_t *transport) {
+	writer->transport = transport;
+	writer->batch_length = 0;
+}
+
+int frame_writer_queue(frame_writer_t *writer, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	if (FRAME_HEADER_SIZE + length > FRAME_BATCH_SIZE)
+		return frame_writer_send(writer, length, type, flags, stream, data);
+	if (writer->batch_length + FRAME_HEADER_SIZE + length > FRAME_BATCH_SIZE && !frame_writer_flush(writer))
+		return 0;
+
+	char *header = writer->batch + writer->batch_length;
+	write_header(header, length, type, flags, stream);
+	if (length)
+		memcpy(header + FRAME_HEADER_SIZE, data, length);
+	writer->batch_length += FRAME_HEADER_SIZE + length;
+	return 1;
+}
+
+int frame_writer_send(frame_writer_t *writer, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	size_t batch_length = writer->batch_length;
+	writer->batch_length = 0;
+	return write_frame(writer->transport, writer->batch, batch_length, length, type, flags, stream, data);
+}
+
+int frame_writer_flush(frame_writer_t *writer) {
+	if (writer->batch_length == 0)
+		return 1;
+	size_t batch_length = writer->batch_length;
+	writer->batch_length = 0;
+	return transport_write(writer->transport, writer->batch, batch_length);
 }
- 
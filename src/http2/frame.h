@@ -6,6 +6,8 @@
  */
 #ifndef HTTP2_FRAME_H
 #define HTTP2_FRAME_H
+#include <pthread.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define FRAME_DATA          0x0
@@ -20,9 +22,11 @@
 #define FRAME_CONTINUATION  0x9
 #define FRAME_ALTSVC        0xa
 #define FRAME_ORIGIN        0xc
+/* RFC 9218 Section 7.1 */
+#define FRAME_PRIORITY_UPDATE 0x10
 
-/** For the 'TLS' typedef. */
-#include "../secure/tlsutil.h"
+/** For the transport_t typedef. */
+#include "../transport/transport.h"
 
 /* For the H2_ERROR enum */
 #include "constants.h"
@@ -35,37 +39,245 @@ typedef struct {
 	char *data;
 } frame_t;
 
+/* the octets of the header of a frame (RFC 7540 Section 4.1) */
+#define FRAME_HEADER_SIZE 9
+/* the size of the payloads of the pool, the initial SETTINGS_MAX_FRAME_SIZE,
+ * larger frames are allocated on their own */
+#define FRAME_POOL_BUFFER_SIZE 16384
+/* the most unused payloads a reader keeps */
+#define FRAME_POOL_MAX 8
+/* the octets that are read ahead, a frame of the initial maximum size fits */
+#define FRAME_READER_SIZE (FRAME_HEADER_SIZE + FRAME_POOL_BUFFER_SIZE)
+
+/* a frame that can be kept after the next frame is read, the payload follows
+ * the structure */
+typedef struct frame_buffer_t {
+	struct frame_buffer_t *next;
+	size_t size;
+	frame_t frame;
+} frame_buffer_t;
+
+/**
+ * The reader of the frames of a connection. The transport is read in as few
+ * reads as possible: the octets after a frame are kept for the next one. The
+ * payloads of DATA frames, which the request workers keep, and of frames
+ * that don't fit in 'input' come from the pool, the payloads of other frames
+ * are parsed where they were read.
+ *
+ * The reader is resumable: frame_reader_receive reads what the transport
+ * has and frame_reader_next returns a frame once all of it has arrived, so
+ * the connection doesn't have to wait for the rest of a frame.
+ */
+typedef struct {
+	transport_t *transport;
+	/* the frame that was read last, unless it came from the pool */
+	frame_t frame;
+	char input[FRAME_READER_SIZE];
+	/* the octets of 'input' that haven't been parsed yet: [position, end) */
+	size_t position;
+	size_t end;
+	/* the frame of which the payload is being read into a payload of the
+	 * pool, and the octets of it that were read */
+	frame_buffer_t *partial;
+	size_t partial_length;
+
+	/* the pool is shared with the threads that release DATA frames */
+	pthread_mutex_t mutex;
+	frame_buffer_t *pool;
+	size_t pool_count;
+} frame_reader_t;
+
 /**
  * Description:
- *   Reads a frame.
- * 
+ *   Sets up a frame reader.
+ *
  * Parameters:
- *   TLS
+ *   frame_reader_t *
+ *     The reader.
+ *   transport_t *
  *     The source to read from.
+ */
+void frame_reader_init(frame_reader_t *, transport_t *);
+
+/**
+ * Description:
+ *   Destroys a frame reader and its pool. The frames that were read with
+ *   it should be released first.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader.
+ */
+void frame_reader_destroy(frame_reader_t *);
+
+/**
+ * Description:
+ *   Reads from the transport once, into the input or into the payload of
+ *   the frame that is being read. This should be called when the transport
+ *   is readable and frame_reader_ready is false.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader.
+ *
+ * Return Value:
+ *   (boolean) success status, false on I/O failure or the end of the
+ *   transport
+ */
+int frame_reader_receive(frame_reader_t *);
+
+/**
+ * Description:
+ *   Returns the next frame, if all of it was received.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader.
+ *   uint32_t
+ *     The maximum size for one frame.
+ *   H2_ERROR *
+ *     The pointer to an address where the error code is set. It is
+ *     H2_NO_ERROR if the frame is incomplete, or if a frame was returned.
+ *
+ * Notes:
+ *   The frame should be released with frame_reader_release. A frame that
+ *   isn't a DATA frame can be part of the reader, it is only valid until
+ *   the next frame is read.
+ *
+ * Return Value:
+ *   A 'frame *', or NULL if the frame is incomplete or an error occurred.
+ */
+frame_t *frame_reader_next(frame_reader_t *, uint32_t, H2_ERROR *);
+
+/**
+ * Description:
+ *   Reads a frame, waiting for the transport until all of it was received.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader.
  *   uint32_t
  *     The maximum size for one frame.
  *   H2_ERROR *
- *     The pointer to an address where 
- *     the error code is set, if an error 
- *     has occurred (i.e. if the return 
+ *     The pointer to an address where
+ *     the error code is set, if an error
+ *     has occurred (i.e. if the return
  *     value is NULL).
- * 
+ *
+ * Notes:
+ *   See frame_reader_next.
+ *
  * Return Value:
  *   A 'frame *', or NULL if failed.
  */
-frame_t *readfr(TLS, uint32_t, H2_ERROR *);
+frame_t *frame_reader_read(frame_reader_t *, uint32_t, H2_ERROR *);
 
 /**
  * Description:
- *   Sends a frame.
+ *   Releases a frame that was read, its payload is returned to the pool.
+ *   This can be called from any thread.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader that read the frame.
+ *   frame_t *
+ *     The frame.
+ */
+void frame_reader_release(frame_reader_t *, frame_t *);
+
+/**
+ * Description:
+ *   Tells whether a complete frame was read ahead, the transport doesn't
+ *   have to be readable for the next frame then.
+ *
+ * Parameters:
+ *   frame_reader_t *
+ *     The reader.
+ *
+ * Return Value:
+ *   (boolean) frame_reader_next returns a frame (or a frame error) without
+ *   reading
+ */
+int frame_reader_ready(const frame_reader_t *);
+
+/**
+ * Description:
+ *   Sends a frame, the header and the payload are written from separate
+ *   buffers.
  * 
  * Parameters:
- *   Except for 'TLS' as the source and max_size, are all the parameters types of HTTP frames.
+ *   Except for the transport as the source and max_size, are all the parameters types of HTTP frames.
  *   See RFC 7540 Section 4.1
  * 
  * Return Value:
  *   (boolean) I/O success status 
  */
-int send_frame(TLS, /*uint32_t max_size, */uint32_t length, char type, char flags, uint32_t stream, const char *data);
+int send_frame(transport_t *, /*uint32_t max_size, */uint32_t length, char type, char flags, uint32_t stream, const char *data);
+
+/* the octets of control frames that are batched, a frame that doesn't fit
+ * flushes the batch */
+#define FRAME_BATCH_SIZE 512
+
+/**
+ * The writer of the frames of a connection. Small control frames, like
+ * SETTINGS and PING acknowledgements, WINDOW_UPDATEs and RST_STREAMs, are
+ * batched and written together with the next frame that is sent, or when
+ * the batch is flushed.
+ */
+typedef struct {
+	transport_t *transport;
+	char batch[FRAME_BATCH_SIZE];
+	size_t batch_length;
+} frame_writer_t;
+
+/**
+ * Description:
+ *   Sets up a frame writer with an empty batch.
+ *
+ * Parameters:
+ *   frame_writer_t *
+ *     The writer.
+ *   transport_t *
+ *     The destination.
+ */
+void frame_writer_init(frame_writer_t *, transport_t *);
+
+/**
+ * Description:
+ *   Adds a control frame to the batch. The parameters after the writer are
+ *   those of send_frame.
+ *
+ * Notes:
+ *   The batch is only written by frame_writer_send and frame_writer_flush,
+ *   so it should be flushed before the connection waits for the client.
+ *
+ * Return Value:
+ *   (boolean) I/O success status, the batch is written when the frame
+ *   doesn't fit
+ */
+int frame_writer_queue(frame_writer_t *, uint32_t length, char type, char flags, uint32_t stream, const char *data);
+
+/**
+ * Description:
+ *   Sends a frame after the batch, in one write. The parameters after the
+ *   writer are those of send_frame.
+ *
+ * Return Value:
+ *   (boolean) I/O success status
+ */
+int frame_writer_send(frame_writer_t *, uint32_t length, char type, char flags, uint32_t stream, const char *data);
+
+/**
+ * Description:
+ *   Writes the batch, if there is one.
+ *
+ * Parameters:
+ *   frame_writer_t *
+ *     The writer.
+ *
+ * Return Value:
+ *   (boolean) I/O success status
+ */
+int frame_writer_flush(frame_writer_t *);
 
 #endif /* HTTP2_FRAME_H */
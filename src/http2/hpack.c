@@ -8,10 +8,13 @@
 
 #include "constants.h"
 #include "dynamic_table.h"
+#include "hpack_encoder.h"
 #include "http/header_list.h"
 #include "huffman.h"
+#include "static_table.h"
 #include "utils/util.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -50,31 +53,18 @@ char *dup_str(const char *src, size_t length) {
 	return copy;
 }
 
-/* duplicate string + NULL-termination */
-char *tdup_str(const char *src, size_t length) {
-	char *copy = malloc((length+1) * sizeof(char));
-	if (!copy)
-		return NULL;
-	copy[length] = 0;
-	size_t i;
-	for (i = 0; i < length; i++)
-		copy[i] = src[i];
-	return copy;
-}
-
 size_t parse_int(const char *stream, size_t *out_octets_used, size_t n) {
 	/* we can just use the first octet */
 	/* this is essentialy the same as stream < pow(2, n),
 	 * but is faster and looks cooler */
 	size_t next_n_bits = (1 << n)-1;
-	size_t i = (stream[0] & 0xFF) & ~(1<<n);
+	size_t i = (stream[0] & 0xFF) & next_n_bits;
 	#ifdef HPACK_LOGGING_VERBOSE
-	printf("parse int i=%zu s=%hhu n=%zu max=%zu other=%hhx\n", i, stream[0], n, next_n_bits, stream[0] & ~(1<<n));
+	printf("parse int i=%zu s=%hhu n=%zu max=%zu\n", i, stream[0], n, next_n_bits);
 	#endif
 	if (i < next_n_bits) {
 		*out_octets_used = 1;
-		char c = stream[0] & ~(1<<n);
-		return (size_t)c;
+		return i;
 	} else {
 		#ifdef HPACK_LOGGING_VERBOSE
 		printf("\x1b[31mok parse_int need fix, stream=%hhu %zu\x1b[0m\n", stream[0], i);
@@ -99,413 +89,186 @@ size_t parse_int(const char *stream, size_t *out_octets_used, size_t n) {
 	}
 }
 
-char *parse_string(const char *data, size_t *octets_used, size_t *length) {
-	size_t ioctets_used;
-	size_t ilength = parse_int(data, &ioctets_used, 7);
-	/*printf("Value length: %zu (huffman=%X)\n", *length, (data[0] & 0x80) >> 7);*/
-	*octets_used = ilength + ioctets_used;
-	
-	/* determine type of string (huffman, normal) */
-	if ((data[0] & 0x80) >> 7) {
-		char *huff = huff_decode(data + ioctets_used, ilength);
-		/*printf(" > parsed string='%s' (ioctets_used=%zu ilength=%zu octets_used=%zu)\n", huff, ioctets_used, ilength, *octets_used);*/
-		return huff;
+/* (boolean) parses an integer with an N-bit prefix (RFC 7541 Section 5.1) of
+ * at most 'available' octets, integers of more than 4 continuation octets
+ * are larger than anything a header block can refer to */
+static int parse_bounded_int(const char *data, size_t available, size_t n, size_t *value, size_t *octets_used) {
+	size_t max = (1 << n) - 1;
+	if (available == 0)
+		return 0;
+	*value = data[0] & max;
+	*octets_used = 1;
+	if (*value < max)
+		return 1;
+
+	size_t shift = 0;
+	do {
+		if (*octets_used == available || shift > 21)
+			return 0;
+		*value += (size_t) (data[*octets_used] & 0x7F) << shift;
+		shift += 7;
+	} while (data[(*octets_used)++] & 0x80);
+	return 1;
+}
+
+/* (boolean) parses a string literal (RFC 7541 Section 5.2) into the strings
+ * of the list, a Huffman-encoded string is decoded there directly */
+static int parse_string(const char *data, size_t available, http_header_list_t *list, char **string, size_t *length, size_t *octets_used) {
+	size_t encoded_length;
+	size_t prefix;
+	if (!parse_bounded_int(data, available, 7, &encoded_length, &prefix) || encoded_length > available - prefix)
+		return 0;
+	*octets_used = prefix + encoded_length;
+
+	if (data[0] & 0x80) {
+		size_t max = huff_decoded_length_max(encoded_length);
+		if (!(*string = http_header_list_allocate(list, max + 1))
+			|| !huff_decode_to(*string, data + prefix, encoded_length, length))
+			return 0;
+		http_header_list_release(list, max - *length);
 	} else {
-		char *pdata = malloc(sizeof(char) * (ilength + 1));
-		pdata[ilength] = 0;
-		memcpy(pdata, data+ioctets_used, ilength);
-		/*
-		printf(" > non_huff='%s'\n", pdata);
-		printf(" >> ilength=%zu otects_used=%zu [0]=%hhX [1]=%hhX data[first]=%hhX data[first-1]=%hhX\n", *length, *octets_used, pdata[0], pdata[1], data[*octets_used], data[*octets_used - 1]);
-		*/
-		return pdata;
+		if (!(*string = http_header_list_allocate(list, encoded_length + 1)))
+			return 0;
+		memcpy(*string, data + prefix, encoded_length);
+		*length = encoded_length;
 	}
-	return NULL;
+	(*string)[*length] = 0;
+	return 1;
 }
 
-static void write_str(char *data, const char *str, size_t *pos) {
-	size_t j, length = strlen(str);
-	/*
-	printf("String length: 0x%zx or %zu\n", length, length);
-	*/
-	data[(*pos)] = length;
-	
-	(*pos) += 1;
-	for (j = 0; j < length; j++) {
-		data[(*pos) + j] = str[j];
-	}
-	(*pos) += j;
+/* copies a string of the dynamic table into the strings of the list, the
+ * entry can be evicted while the request is handled */
+static char *copy_string(http_header_list_t *list, const char *string, size_t length) {
+	char *copy = http_header_list_allocate(list, length + 1);
+	if (copy)
+		memcpy(copy, string, length + 1);
+	return copy;
 }
 
 char *write_headers(http_response_headers_t *response_headers, size_t *size) {
-	char *headers = calloc(1, 256);
-	if (!headers)
-		return NULL;
-	size_t i, pos = 0;
-	http_response_header_t *header;
-	/*
-	printf(" Header count: %zu\n", list->count);
-	*/
-	for (i = 0; i < response_headers->count; i++) {
-		/*headers[pos] &= (1 << i);*/
-		header = response_headers->headers[i];
-		switch (header->name) {
-			case HTTP_RH_CONTENT_LENGTH:
-				headers[pos] = 0x5C; /* = 01011100 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_CONTENT_ENCODING:
-				headers[pos] = 0x5A; /* = 01011010 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_CONTENT_TYPE:
-				headers[pos] = 0x5F; /* = 01011111 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_DATE:
-				headers[pos] = 0x61; /* = 01100001 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_SERVER:
-				headers[pos] = 0x76; /* = 01110110 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_STRICT_TRANSPORT_SECURITY:
-				headers[pos] = 0x78; /* = 01111000 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_STATUS_200:
-				headers[pos] = 0x88; /* = 10001000 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_204:
-				headers[pos] = 0x89; /* = 10001001 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_304:
-				headers[pos] = 0x8B; /* = 10001011 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_400:
-				headers[pos] = 0x8C; /* = 10001100 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_404:
-				headers[pos] = 0x8D; /* = 10001101 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_500:
-				headers[pos] = 0x8E; /* = 10001110 */
-				pos += 1;
-				break;
-			case HTTP_RH_STATUS_503:
-				headers[pos] = 0x48; /* = 01001000 */
-				pos += 1;
-				write_str(headers, "503", &pos);
-				break;
-			case HTTP_RH_TK:
-				/* TODO: use dynamic table contents if it already is in table. */
-				headers[pos] = 0x40; /* = 01000000 */
-				pos += 1;
-				write_str(headers, "tk", &pos);
-				write_str(headers, header->value, &pos);
-				break;
-			case HTTP_RH_LAST_MODIFIED:
-				headers[pos] = 0x6C; /* = 01101100 */
-				pos += 1;
-				write_str(headers, header->value, &pos);
-				break;
-			default:
-				printf("(?) Unknown header type: %u\n", header->name);
-				break;
-		}
-	}
-	
-		/* Add EOS padding */
-	/* 	size_t bpleft = bp % 8;
- 	if (bpleft != 0) {
- 		for (i = 0; i < bpleft; i++) {
- 			headers[bp/8] &= (1 << i);
- 		}
- 		bp += bpleft;
- 	}
- 	*/
-	*size = pos;
+	hpack_encoder_t encoder;
+	hpack_encoder_init(&encoder, 0);
+	encoder.plain_dates = 1;
 
-	return realloc(headers, pos);
+	char *block = NULL;
+	if (hpack_encode(&encoder, response_headers)) {
+		block = encoder.block;
+		*size = encoder.block_length;
+		encoder.block = NULL;
+	}
+	hpack_encoder_destroy(&encoder);
+	return block;
 }
 
-void handle_headers(frame_t *frame, dynamic_table_t *dynamic_table, http_header_list_t *list) {
-	#ifdef HPACK_LOGGING_DUMP
-	puts("\x1b[93m>>> \x1b[94mHPACK\x1b[93m <<<\x1b[0m");
-	#endif
+int handle_headers(frame_t *frame, dynamic_table_t *dynamic_table, http_header_list_t *list) {
 	size_t offset = 0;
-	uint32_t padding = frame->flags & FLAG_PADDED ? frame->data[offset++] : 0;
-	
-	#ifdef HPACK_LOGGING_VERBOSE
-	uint32_t dependency = 0;
-	uint8_t weight = 0;
-	#endif
-	
-	if (frame->flags & FLAG_PRIORITY) {
-		#ifdef HPACK_LOGGING_VERBOSE
-		dependency = u32(frame->data + offset);
-		weight = frame->data[offset + 1];
-		#endif
-		offset += 5;
+	size_t padding = 0;
+	if (frame->flags & FLAG_PADDED) {
+		if (frame->length == 0)
+			goto error_label;
+		padding = frame->data[offset++] & 0xFF;
 	}
-	#ifdef HPACK_LOGGING_VERBOSE
-	printf("[HeaderBlockInfo] Dependency=%u Weight=%u\n", dependency, weight);
-	#endif
-
-	size_t packl = frame->length - offset - padding;
-	char *data = dup_str(frame->data + offset, packl);
+	/* the stream dependency and the weight */
+	if (frame->flags & FLAG_PRIORITY)
+		offset += 5;
+	if (offset + padding > frame->length)
+		goto error_label;
 
+	/* the strings are decoded from the frame into the strings of the list,
+	 * the names and values of the static table aren't copied */
+	const char *data = frame->data + offset;
+	size_t length = frame->length - offset - padding;
 	size_t i = 0;
-	#ifdef HPACK_LOGGING_DUMP
-	for (i = 0; i < packl; i++) {
-		printf("\x1b[32m > \x1b[34m(%03zu) \x1b[33m0x%02hhx int=%hhu\x1b[0m\n", i, data[i], data[i]/*, parse_int(frame->data+i, &i, 60)*/);
-	}
-	#endif
-
-	size_t octets_used = 0;
-	
-	size_t count = 0;
-	for (i = 0; i < packl; i++) {
+	while (i < length) {
 		unsigned char c = data[i];
-		count++;
-		
+		size_t index;
+		size_t octets_used;
+		const char *key;
+		size_t key_length;
+		char *value;
+		size_t value_length;
+
 		#ifdef HPACK_LOGGING_TYPE
-		printf("(0x%02hhX)", c);
+		printf("(0x%02hhX)\n", c);
 		#endif
-		
-		if (c > 127) {
-			#ifdef HPACK_LOGGING_TYPE
-			puts("\tIndexed Header Field");
-			#endif
-			size_t pos = parse_int(data+i, &octets_used, 7);
-			#ifdef HPACK_LOGGING_VERBOSE
-			printf(" > Pos: %zu max-int=%zu\n", pos, 62+dynamic_table->index_last);
-			#endif
-			
-			lookup_t result = dynamic_table_get(dynamic_table, pos);
-			const char *indexed_name = result.static_e ? result.static_e : (result.dynamic ? result.dynamic->key : NULL);
-			if (!indexed_name) {
+		if (c & 0x80) {
+			/* Indexed Header Field (RFC 7541 Section 6.1) */
+			if (!parse_bounded_int(data + i, length - i, 7, &index, &octets_used))
 				goto error_label;
-			}
-			
-			char *key, *value;
+			i += octets_used;
+
+			lookup_t result = dynamic_table_get(dynamic_table, index);
 			if (result.static_e) {
-				char *sign_position = strchr(indexed_name, '$');
-				if (!sign_position) {
-					printf("\nsign_entry is null!\nfield=%s\n\n", indexed_name);
-					goto error_label;
-				}
-				
-				size_t key_size = (sign_position - indexed_name) + 1;
-				size_t value_size = strlen(indexed_name) - (sign_position - indexed_name) + 1;
-				
-				key = malloc(sizeof(char) * key_size);
-				value = malloc(sizeof(char) * value_size);
-				
-				memcpy(key, indexed_name, key_size - 1);
-				key[key_size - 1] = 0;
-				
-				strcpy(value, sign_position+1);
-				value[value_size - 1] = 0;
-				
-				#ifdef HPACK_LOGGING_KEY_VALUE
-				printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", key, value);
-				#endif
-				
-				/* even though we got the string from the static table, 
-				   we are duplicating it so it isn't cached */
-				http_header_list_add(list, key, value, HTTP_HEADER_NOT_CACHED, pos);
+				key = result.static_e->name;
+				value = (char *) result.static_e->value;
 			} else if (result.dynamic) {
-				/**
-				 * The dynamic table SHOULD NOT be destroyed before these pointers are out of use,
-				 * because otherwise these pointers will point to disowned data.
-				 */
-				key = result.dynamic->key;
-				value = result.dynamic->value;
-				
-				#ifdef HPACK_LOGGING_KEY_VALUE
-				printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", key, value);
-				#endif
-				
-				http_header_list_add(list, key, value, HTTP_HEADER_CACHED, pos);
+				if (!(key = copy_string(list, result.dynamic->key, result.dynamic->key_length))
+					|| !(value = copy_string(list, result.dynamic->value, result.dynamic->value_length)))
+					goto error_label;
 			} else {
-				printf("Static+Dynamic table out-of-bounds error for pos=%zu\n", pos);
 				goto error_label;
 			}
-		} else if (c > 64) {
-			/* this value should be added to the list,
-			 but also added to the dynamic table (this is like caching headers) */
-			/* 01??????*/
-			#ifdef HPACK_LOGGING_TYPE
-			puts("\tLiteral Header Field with Incremental Indexing -- Indexed Name");
-			#endif
-			size_t length = 0;
-			size_t pos = parse_int(data + i, &octets_used, 6);
-			i += octets_used;
-			
-			/** Get the key ("name") out of either the static or dynamic table */
-			lookup_t result = dynamic_table_get(dynamic_table, pos);
-			const char *indexed_name = result.static_e ? result.static_e : result.dynamic->key;
-			if (!indexed_name) {
+		} else if ((c & 0xE0) == 0x20) {
+			/* Dynamic Table Size Update (RFC 7541 Section 6.3) */
+			size_t size;
+			if (!parse_bounded_int(data + i, length - i, 5, &size, &octets_used)
+				|| !dynamic_table_set_max_size(dynamic_table, size))
 				goto error_label;
-			}
-			
-			char *key = NULL;
-			char *sign_position = strchr(indexed_name, '$');
-			if (sign_position) {
-				key = tdup_str(indexed_name, sign_position - indexed_name);
-			} else {
-				key = strdup(indexed_name);
-			}
-
-			char *value = parse_string(data + i, &octets_used, &length);
-			i += octets_used - 1; /* we have to subtract 1 because the for loop adds one for us */
-			
-			#ifdef HPACK_LOGGING_KEY_VALUE
-			printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", key, value);
-			#endif
-			
-			dynamic_table_add(dynamic_table, key, value);
-			http_header_list_add(list, key, value, HTTP_HEADER_CACHED, pos);
-		} else if (c == 64) {
-			/* this value should be added to the list,
-			 but also added to the dynamic table (this is like caching headers) */
-			 #ifdef HPACK_LOGGING_TYPE
-			puts("\tLiteral Header Field with Incremental Indexing -- New Name");
-			#endif
-			/*both key and value are supplied*/
-			size_t length;
-			
-			i+=1;
-			char *hkey = parse_string(data+i, &octets_used, &length);
-			
 			i += octets_used;
-			char *hval = parse_string(data+i, &octets_used, &length);
-			
-			i += octets_used - 1; /* we have to subtract 1 because the for loop adds one for us */
-			#ifdef HPACK_LOGGING_KEY_VALUE
-			printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", hkey, hval);
-			#endif
-			
-			dynamic_table_add(dynamic_table, hkey, hval);
-			http_header_list_add(list, hkey, hval, HTTP_HEADER_CACHED, 0);
-			
-		} else if (c > 0 && c < 16) {
-			#ifdef HPACK_LOGGING_TYPE
-			puts("\tLiteral Header Field without Indexing -- Indexed Name");
-			#endif
-			
-			size_t length = 0;
-			size_t pos = parse_int(data+i, &octets_used, 6);
-			
-			/** Get the key ("name") out of either the static or dynamic table */
-			lookup_t result = dynamic_table_get(dynamic_table, pos);
-			const char *indexed_name = result.static_e ? result.static_e : result.dynamic->key;
-			if (!indexed_name) {
+			continue;
+		} else {
+			/* Literal Header Field with Incremental Indexing (01), without
+			 * Indexing (0000) or Never Indexed (0001) (RFC 7541 Section 6.2) */
+			int indexing = (c & 0xC0) == 0x40;
+			if (!parse_bounded_int(data + i, length - i, indexing ? 6 : 4, &index, &octets_used))
 				goto error_label;
-			}
-			
-			char *key = NULL;
-			char *sign_position = strchr(indexed_name, '$');
-			if (sign_position) {
-				key = tdup_str(indexed_name, sign_position - indexed_name);
+			i += octets_used;
+
+			if (index == 0) {
+				char *name;
+				if (!parse_string(data + i, length - i, list, &name, &key_length, &octets_used))
+					goto error_label;
+				key = name;
+				i += octets_used;
 			} else {
-				key = strdup(indexed_name);
+				lookup_t result = dynamic_table_get(dynamic_table, index);
+				if (result.static_e) {
+					key = result.static_e->name;
+					key_length = result.static_e->name_length;
+				} else if (result.dynamic) {
+					key_length = result.dynamic->key_length;
+					if (!(key = copy_string(list, result.dynamic->key, key_length)))
+						goto error_label;
+				} else {
+					goto error_label;
+				}
 			}
 
-			#ifdef HPACK_LOGGING_VERBOSE
-			printf("\x1b[33m [Header] %s (pos=%zu)\n", key, pos);
-			#endif
-			i += octets_used;
-
-			char *value = parse_string(data+i, &octets_used, &length);
-			#ifdef HPACK_LOGGING_KEY_VALUE
-			printf("\x1b[33m [Header] Key='%s' Value='%s' (pos=%zu)\n", key, value, pos);
-			#endif
-			http_header_list_add(list, key, value, HTTP_HEADER_NOT_CACHED, pos);
-			i += octets_used - 1;
-			
-		} else if (c == 0) {
-			#ifdef HPACK_LOGGING_TYPE
-			puts("\tLiteral Header Field without Indexing -- New Name");
-			#endif
-			
-			size_t length;
-			
-			i+=1;
-			char *hkey = parse_string(data+i, &octets_used, &length);
-			#ifdef HPACK_LOGGING_VERBOSE
-			printf("Test> HKEY='%s', length=%zu\n", hkey, length);
-			#endif
-			
+			if (!parse_string(data + i, length - i, list, &value, &value_length, &octets_used))
+				goto error_label;
 			i += octets_used;
-			char *hval = parse_string(data+i, &octets_used, &length);
-			#ifdef HPACK_LOGGING_VERBOSE
-			printf("Test> HVAL='%s', length=%zu\n", hval, length);
-			
-			printf("Bytes: 0x%hhx 0x%hhx 0x%hhx\n", data[i+octets_used-2], data[i+octets_used-1], data[i+octets_used]);
-			#endif
-			i += octets_used - 1; /* we have to subtract 1 because the for loop adds one for us */
-			#ifdef HPACK_LOGGING_KEY_VALUE
-			printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", hkey, hval);
-			#endif
-			
-			http_header_list_add(list, hkey, hval, HTTP_HEADER_NOT_CACHED, 0);
-		} else if (c > 32 && c < 64) {
-			/* dynamic table size update Section 6.3*/
-			#ifdef HPACK_LOGGING_TYPE
-			puts("\tDynamic Table Size Update");
-			#endif
-			
-			#ifdef HPACK_LOGGING_VERBOSE
-			size_t size =
-			#endif
-			parse_int(data+i, &octets_used, 5);
-			i += octets_used -1;
-			#ifdef HPACK_LOGGING_VERBOSE
-			printf("\t> New size: %zu\n", size);
-			#endif
-		} else {
-			#ifdef HPACK_LOGGING_ERROR
-			printf("\tother? i=%hhu\n", c);
-			#endif
+			if (indexing)
+				dynamic_table_add(dynamic_table, key, key_length, value, value_length);
 		}
+
+		#ifdef HPACK_LOGGING_KEY_VALUE
+		printf("\x1b[33m[Header] Key='%s' Value='%s'\x1b[0m\n", key, value);
+		#endif
+		if (!http_header_list_add(list, key, value, HTTP_HEADER_CACHED, index))
+			goto error_label;
 	}
-	#ifdef HPACK_LOGGING_RESULTS
-	printf("\nEnd of headers!\n\tpackl: %zu\n\ti: %zu\n\tcount: %zu\n", packl, i, count);
-	#endif
-	
 	#ifdef HPACK_LOGGING_VERBOSE
-	printf("Flag set: %s\n", (frame->flags & FLAG_END_HEADERS ? "true" : "false"));
-	
-	printf("DynamicTable (index_last=%zu size=%zu client_max_size=%zu)\n", dynamic_table->index_last, dynamic_table->size, dynamic_table->client_max_size);
-	if (dynamic_table->index_last != dynamic_table->client_max_size) {
-		for (i = 0; i < dynamic_table->index_last+1; i++) {
-			printf("> DynamicTable (%zu) Key='%s' Value='%s'\n", i, dynamic_table->entries[i]->key, dynamic_table->entries[i]->value);
-		}
+	printf("DynamicTable (count=%zu size=%zu max_size=%zu)\n", dynamic_table->count, dynamic_table->size, dynamic_table->max_size);
+	for (i = 0; i < dynamic_table->count; i++) {
+		lookup_t entry = dynamic_table_get(dynamic_table, HTTP2_STATIC_TABLE_SIZE + i);
+		printf("> DynamicTable (%zu) Key='%s' Value='%s'\n", i, entry.dynamic->key, entry.dynamic->value);
 	}
 	#endif
+	return 1;
 
-	free(data);
-	return;
-	
 error_label:
 	#ifdef HPACK_LOGGING_ERROR
 	puts("Parsing error encountered.");
 	#endif
-	free(data);
-	return;
+	return 0;
 }
- 
@@ -65,7 +65,11 @@ size_t parse_int(const char *, size_t *, size_t);
 
 /**
  * Description:
- *	 Writes the data of (a) header frame(s) as per RFC 7541.
+ *	 Writes the data of (a) header frame(s) as per RFC 7541, without the
+ *	 dynamic table, so the block can be sent on any connection. The Date
+ *	 header is written as a plain string, so it can be replaced (see
+ *	 prebuilt_response.h). The responses of a connection are encoded with
+ *	 its hpack_encoder_t instead.
  *
  * Parameters:
  *	 http_response_headers_t *
@@ -91,7 +95,12 @@ char *write_headers(http_response_headers_t *, size_t *);
  *     The dynamic table to store indexed headers in.
  *   http_header_list_t *
  *     The list to store the parsed headers in.
+ *
+ * Return Value:
+ *   (boolean) Success status, a failure is a decoding error: the dynamic
+ *   table doesn't follow the one of the client anymore, so the connection
+ *   can't be used (RFC 7540 Section 4.3).
  */
-void handle_headers(frame_t *, dynamic_table_t *, http_header_list_t *);
+int handle_headers(frame_t *, dynamic_table_t *, http_header_list_t *);
 
 #endif /* HTTP2_HPACK_H */
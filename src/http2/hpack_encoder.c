@@ -0,0 +1,311 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see hpack_encoder.h
+ */
+#include "hpack_encoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "huffman.h"
+#include "static_table.h"
+
+typedef struct {
+	/* the name as it is sent, for the size of an entry and for literal names */
+	const char *text;
+	/* the index of the header with this value in the static table, or 0 */
+	unsigned char field;
+	/* the index of the name in the static table, or 0 for a literal name */
+	unsigned char name;
+} header_info_t;
+
+/* in the order of http_response_header_name */
+static const header_info_t header_info[HTTP_RH_COUNT] = {
+	{ ":status", 0, 8 },	/* 103 */
+	{ ":status", 8, 8 },	/* 200 */
+	{ ":status", 9, 8 },	/* 204 */
+	{ ":status", 11, 8 },	/* 304 */
+	{ ":status", 12, 8 },	/* 400 */
+	{ ":status", 13, 8 },	/* 404 */
+	{ ":status", 0, 8 },	/* 405 */
+	{ ":status", 0, 8 },	/* 413 */
+	{ ":status", 0, 8 },	/* 414 */
+	{ ":status", 0, 8 },	/* 417 */
+	{ ":status", 0, 8 },	/* 425 */
+	{ ":status", 0, 8 },	/* 431 */
+	{ ":status", 14, 8 },	/* 500 */
+	{ ":status", 0, 8 },	/* 501 */
+	{ ":status", 0, 8 },	/* 503 */
+	{ ":status", 0, 8 },	/* 505 */
+	{ "content-length", 0, 28 },
+	{ "content-type", 0, 31 },
+	{ "date", 0, 33 },
+	{ "server", 0, 54 },
+	{ "tk", 0, 0 },
+	{ "vary", 0, 59 },
+	{ "content-encoding", 0, 26 },
+	{ "strict-transport-security", 0, 56 },
+	{ "last-modified", 0, 44 },
+	{ "allow", 0, 22 },
+	{ "link", 0, 45 },
+	{ "set-cookie", 0, 55 }
+};
+
+/* the string literals of the configured values, see hpack_encoder_setup */
+static char *configured_literals[HTTP_RH_COUNT];
+static size_t configured_lengths[HTTP_RH_COUNT];
+
+/* the length of an integer with an N-bit prefix (RFC 7541 Section 5.1) */
+static size_t int_length(size_t n, size_t value) {
+	size_t length = 1;
+	size_t max = (1 << n) - 1;
+	if (value < max)
+		return length;
+	for (value -= max; value >= 128; value >>= 7)
+		length++;
+	return length + 1;
+}
+
+/* writes an integer with an N-bit prefix after the bits in 'first', returns the length */
+static size_t write_int(char *destination, char first, size_t n, size_t value) {
+	size_t max = (1 << n) - 1;
+	if (value < max) {
+		destination[0] = first | value;
+		return 1;
+	}
+
+	size_t length = 1;
+	destination[0] = first | max;
+	for (value -= max; value >= 128; value >>= 7)
+		destination[length++] = (value & 0x7F) | 0x80;
+	destination[length++] = value;
+	return length;
+}
+
+/* writes a string literal (RFC 7541 Section 5.2), Huffman-encoded when that
+ * is shorter, returns the length */
+static size_t write_string(char *destination, const char *string, size_t length, int huffman) {
+	size_t huffman_length = huffman ? huff_encoded_length(string, length) : length;
+	if (huffman_length < length) {
+		size_t position = write_int(destination, (char) 0x80, 7, huffman_length);
+		huff_encode(destination + position, string, length);
+		return position + huffman_length;
+	}
+
+	size_t position = write_int(destination, 0x00, 7, length);
+	memcpy(destination + position, string, length);
+	return position + length;
+}
+
+int hpack_encoder_setup(void) {
+	size_t i;
+	for (i = HTTP_RH_STATUSES; i < HTTP_RH_COUNT; i++) {
+		http_response_header_t header;
+		header.name = i;
+		header.value = NULL;
+		const char *value = http_response_header_value(&header);
+		if (!value)
+			continue;
+
+		size_t length = strlen(value);
+		if (!(configured_literals[i] = malloc(int_length(7, length) + length))) {
+			hpack_encoder_cleanup();
+			return 0;
+		}
+		configured_lengths[i] = write_string(configured_literals[i], value, length, 1);
+	}
+	return 1;
+}
+
+void hpack_encoder_cleanup(void) {
+	size_t i;
+	for (i = 0; i < HTTP_RH_COUNT; i++) {
+		free(configured_literals[i]);
+		configured_literals[i] = NULL;
+	}
+}
+
+void hpack_encoder_init(hpack_encoder_t *encoder, size_t max_size) {
+	memset(encoder, 0, sizeof(hpack_encoder_t));
+	encoder->max_size = max_size;
+}
+
+/* removes the oldest entries until an entry of 'size' fits */
+static void evict(hpack_encoder_t *encoder, size_t size) {
+	while (encoder->count > 0 && encoder->size + size > encoder->max_size) {
+		hpack_encoder_entry_t *entry = &encoder->entries[encoder->first];
+		encoder->size -= entry->size;
+		free(entry->value);
+		encoder->first = (encoder->first + 1) % encoder->capacity;
+		encoder->count -= 1;
+	}
+}
+
+void hpack_encoder_destroy(hpack_encoder_t *encoder) {
+	encoder->max_size = 0;
+	evict(encoder, 0);
+	free(encoder->entries);
+	free(encoder->block);
+}
+
+void hpack_encoder_set_max_size(hpack_encoder_t *encoder, size_t size) {
+	if (size > HPACK_ENCODER_TABLE_SIZE)
+		size = HPACK_ENCODER_TABLE_SIZE;
+	if (size == encoder->max_size)
+		return;
+	if (!encoder->size_update || size < encoder->minimum_size)
+		encoder->minimum_size = size;
+	encoder->size_update = 1;
+	encoder->max_size = size;
+	evict(encoder, 0);
+}
+
+/* the index of the header in the dynamic table, or 0 */
+static size_t table_find(hpack_encoder_t *encoder, http_response_header_name name, const char *value, size_t length) {
+	size_t i;
+	for (i = 0; i < encoder->count; i++) {
+		/* the newest entry has the lowest index */
+		hpack_encoder_entry_t *entry = &encoder->entries[(encoder->first + encoder->count - 1 - i) % encoder->capacity];
+		if (entry->name == name && entry->value_length == length && !memcmp(entry->value, value, length))
+			return HTTP2_STATIC_TABLE_SIZE + i;
+	}
+	return 0;
+}
+
+/* (boolean) adds the header to the dynamic table, the entry has to fit */
+static int table_add(hpack_encoder_t *encoder, http_response_header_name name, const char *value, size_t length, size_t size) {
+	evict(encoder, size);
+	if (encoder->count == encoder->capacity) {
+		size_t capacity = encoder->capacity ? encoder->capacity * 2 : 16;
+		hpack_encoder_entry_t *entries = malloc(capacity * sizeof(hpack_encoder_entry_t));
+		if (!entries)
+			return 0;
+		size_t i;
+		for (i = 0; i < encoder->count; i++)
+			entries[i] = encoder->entries[(encoder->first + i) % encoder->capacity];
+		free(encoder->entries);
+		encoder->entries = entries;
+		encoder->capacity = capacity;
+		encoder->first = 0;
+	}
+
+	hpack_encoder_entry_t *entry = &encoder->entries[(encoder->first + encoder->count) % encoder->capacity];
+	if (!(entry->value = malloc(length)))
+		return 0;
+	memcpy(entry->value, value, length);
+	entry->name = name;
+	entry->value_length = length;
+	entry->size = size;
+	encoder->size += size;
+	encoder->count += 1;
+	return 1;
+}
+
+/* (boolean) makes room for 'length' more octets in the block */
+static int reserve(hpack_encoder_t *encoder, size_t length) {
+	if (encoder->block_length + length <= encoder->block_capacity)
+		return 1;
+
+	size_t capacity = encoder->block_capacity ? encoder->block_capacity * 2 : 256;
+	if (capacity < encoder->block_length + length)
+		capacity = encoder->block_length + length;
+	char *block = realloc(encoder->block, capacity);
+	if (!block)
+		return 0;
+	encoder->block = block;
+	encoder->block_capacity = capacity;
+	return 1;
+}
+
+/* (boolean) starts a block with the pending Dynamic Table Size Updates (RFC 7541 Section 6.3) */
+static int begin_block(hpack_encoder_t *encoder) {
+	encoder->block_length = 0;
+	if (!encoder->size_update)
+		return 1;
+	if (!reserve(encoder, 12))
+		return 0;
+	encoder->block_length += write_int(encoder->block, 0x20, 5, encoder->minimum_size);
+	if (encoder->max_size != encoder->minimum_size)
+		encoder->block_length += write_int(encoder->block + encoder->block_length, 0x20, 5, encoder->max_size);
+	encoder->size_update = 0;
+	return 1;
+}
+
+int hpack_encode(hpack_encoder_t *encoder, const http_response_headers_t *headers) {
+	if (!begin_block(encoder))
+		return 0;
+
+	size_t i;
+	for (i = 0; i < headers->count; i++) {
+		const http_response_header_t *header = headers->headers[i];
+		const header_info_t *info = &header_info[header->name];
+		if (info->field) {
+			if (!reserve(encoder, 1))
+				return 0;
+			encoder->block[encoder->block_length++] = (char) (0x80 | info->field);
+			continue;
+		}
+
+		const char *value;
+		size_t length;
+		if (header->name < HTTP_RH_STATUSES) {
+			/* the code in "HTTP/1.1 405 Method Not Allowed\r\n" */
+			value = http_rhnames[header->name] + 9;
+			length = 3;
+		} else if ((value = http_response_header_value(header))) {
+			length = strlen(value);
+		} else {
+			continue;
+		}
+
+		/* the representation, the name and the value, each with an integer of at most 6 octets */
+		if (!reserve(encoder, 18 + strlen(info->text) + length))
+			return 0;
+		char *destination = encoder->block + encoder->block_length;
+		size_t size = strlen(info->text) + length + 32;
+		/* a header that doesn't fit in the table isn't added, even the Date is
+		 * added: the responses of a page are usually sent in the same second */
+		int indexed = size <= encoder->max_size;
+		if (indexed) {
+			size_t index = table_find(encoder, header->name, value, length);
+			if (index) {
+				encoder->block_length += write_int(destination, (char) 0x80, 7, index);
+				continue;
+			}
+			/* Literal Header Field with Incremental Indexing (RFC 7541 Section 6.2.1) */
+			destination += write_int(destination, 0x40, 6, info->name);
+		} else {
+			/* Literal Header Field without Indexing (RFC 7541 Section 6.2.2) */
+			destination += write_int(destination, 0x00, 4, info->name);
+		}
+		if (!info->name)
+			destination += write_string(destination, info->text, strlen(info->text), 1);
+
+		if (!header->value && configured_literals[header->name]) {
+			memcpy(destination, configured_literals[header->name], configured_lengths[header->name]);
+			destination += configured_lengths[header->name];
+		} else {
+			destination += write_string(destination, value, length, !(encoder->plain_dates && header->name == HTTP_RH_DATE));
+		}
+		encoder->block_length = destination - encoder->block;
+
+		if (indexed && !table_add(encoder, header->name, value, length, size))
+			return 0;
+	}
+	return 1;
+}
+
+int hpack_encode_block(hpack_encoder_t *encoder, const char *block, size_t length) {
+	if (!begin_block(encoder) || !reserve(encoder, length))
+		return 0;
+	memcpy(encoder->block + encoder->block_length, block, length);
+	encoder->block_length += length;
+	return 1;
+}
+
+size_t hpack_encode_literal(char *destination, size_t index, const char *value, size_t length) {
+	size_t position = write_int(destination, 0x00, 4, index);
+	return position + write_string(destination + position, value, length, 1);
+}
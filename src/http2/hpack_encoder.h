@@ -0,0 +1,162 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the HPACK (RFC 7541) encoder of the response headers. A
+ * connection has one encoder, with a dynamic table of the headers that were
+ * sent before: a header that is repeated, like the Server header or the type
+ * of the files of a page, is sent as an index of one octet.
+ */
+#ifndef HTTP2_HPACK_ENCODER_H
+#define HTTP2_HPACK_ENCODER_H
+
+#include <stddef.h>
+
+#include "http/response_headers.h"
+
+/* The most the encoder uses of the dynamic table the client allows, this is
+ * the initial SETTINGS_HEADER_TABLE_SIZE. */
+#define HPACK_ENCODER_TABLE_SIZE 4096
+
+typedef struct hpack_encoder_entry_t {
+	http_response_header_name name;
+	char *value;
+	size_t value_length;
+	/* the size of the entry (RFC 7541 Section 4.1) */
+	size_t size;
+} hpack_encoder_entry_t;
+
+typedef struct hpack_encoder_t {
+	/* a ring of the entries of the dynamic table, the oldest is at 'first' */
+	hpack_encoder_entry_t *entries;
+	size_t capacity;
+	size_t first;
+	size_t count;
+	/* the sum of the sizes of the entries */
+	size_t size;
+	/* the maximum size of the table, the table isn't used when it is 0 */
+	size_t max_size;
+	/* (boolean) the maximum size was changed, the next header block starts
+	 * with Dynamic Table Size Updates of the smallest and the last maximum */
+	int size_update;
+	size_t minimum_size;
+	/* (boolean) Date values aren't Huffman-encoded, so they can be replaced
+	 * in the block, see write_headers */
+	int plain_dates;
+	/* the last header block, the buffer is reused */
+	char *block;
+	size_t block_length;
+	size_t block_capacity;
+} hpack_encoder_t;
+
+/**
+ * Description:
+ *   Encodes the configured values of the Server, Strict-Transport-Security
+ *   and Tk headers, these are copied into the header blocks.
+ *
+ * Return Value:
+ *   (boolean) Success status.
+ */
+int hpack_encoder_setup(void);
+
+/**
+ * Description:
+ *   Frees the encoded values of hpack_encoder_setup.
+ */
+void hpack_encoder_cleanup(void);
+
+/**
+ * Description:
+ *   Initializes an encoder with an empty dynamic table.
+ *
+ * Parameters:
+ *   hpack_encoder_t *
+ *     The encoder.
+ *   size_t
+ *     The maximum size of the dynamic table, 0 for an encoder that doesn't
+ *     use it, e.g. for header blocks that are sent on any connection.
+ */
+void hpack_encoder_init(hpack_encoder_t *, size_t);
+
+/**
+ * Description:
+ *   Frees the dynamic table and the block of the encoder.
+ */
+void hpack_encoder_destroy(hpack_encoder_t *);
+
+/**
+ * Description:
+ *   Changes the maximum size of the dynamic table after the client has sent
+ *   SETTINGS_HEADER_TABLE_SIZE. At most HPACK_ENCODER_TABLE_SIZE is used.
+ *
+ * Parameters:
+ *   hpack_encoder_t *
+ *     The encoder.
+ *   size_t
+ *     The value of the setting.
+ */
+void hpack_encoder_set_max_size(hpack_encoder_t *, size_t);
+
+/**
+ * Description:
+ *   Encodes the headers of a response into 'block' of the encoder. The
+ *   blocks have to be sent in the order they were encoded in, since the
+ *   dynamic table of the client follows the one of the encoder.
+ *
+ * Parameters:
+ *   hpack_encoder_t *
+ *     The encoder.
+ *   const http_response_headers_t *
+ *     The headers.
+ *
+ * Return Value:
+ *   (boolean) Success status.
+ */
+int hpack_encode(hpack_encoder_t *, const http_response_headers_t *);
+
+/**
+ * Description:
+ *   Copies a header block that doesn't use the dynamic table, like the
+ *   block of a prebuilt response, into 'block' of the encoder, after the
+ *   Dynamic Table Size Updates that are pending.
+ *
+ * Parameters:
+ *   hpack_encoder_t *
+ *     The encoder.
+ *   const char *
+ *     The header block.
+ *   size_t
+ *     The length of the header block.
+ *
+ * Return Value:
+ *   (boolean) Success status.
+ */
+int hpack_encode_block(hpack_encoder_t *, const char *, size_t);
+
+/* The most octets hpack_encode_literal writes more than the length of the value. */
+#define HPACK_LITERAL_OVERHEAD 16
+
+/**
+ * Description:
+ *   Writes a Literal Header Field without Indexing with the name of an entry
+ *   of the static table (RFC 7541 Section 6.2.2). It doesn't use the dynamic
+ *   table, so it can be encoded without the encoder of the connection, e.g.
+ *   the request of a PUSH_PROMISE.
+ *
+ * Parameters:
+ *   char *
+ *     The destination, with room for the length of the value plus
+ *     HPACK_LITERAL_OVERHEAD octets.
+ *   size_t
+ *     The index of the name in the static table.
+ *   const char *
+ *     The value.
+ *   size_t
+ *     The length of the value.
+ *
+ * Return Value:
+ *   The amount of octets that were written.
+ */
+size_t hpack_encode_literal(char *, size_t, const char *, size_t);
+
+#endif /* HTTP2_HPACK_ENCODER_H */
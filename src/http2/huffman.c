@@ -2,139 +2,89 @@
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
  * 
- * This file contains Huffman decoding/decompression functions.
+ * For information about these functions/symbols, see huffman.h
+ *
+ * The decoder reads a nibble at a time, with the state machine of huffman_fsm.h:
+ * the state is the position in the code that isn't complete yet.
  */
-#include "huffman_table.h"
+#include "huffman.h"
 
-#include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
 
-typedef struct hnode_t {
-	struct hnode_t *left;
-	struct hnode_t *right;
-	/* should only be accessed when left or right are NULL*/
-	size_t value;
-} hnode_t;
+#include "huffman_fsm.h"
+#include "huffman_table.h"
 
-static hnode_t *tree = NULL;
+size_t huff_decoded_length_max(size_t length) {
+	/* the shortest code has 5 bits */
+	return length * 8 / 5;
+}
 
-/*#define LOG_BITS*/
+int huff_decode_to(char *destination, const char *source, size_t length, size_t *decoded) {
+	const unsigned char *input = (const unsigned char *) source;
+	const unsigned char *end = input + length;
+	char *output = destination;
+	/* the empty string is accepted */
+	unsigned int state = 0;
+	unsigned int flags = HUFFMAN_FSM_ACCEPT;
+	unsigned int failed = 0;
 
-/**
- * TODOs:
- * 1. Ensure no data is read out side of the stream.
- * 2. Ensure no NULL leafs are taken.
- * 3. Comply to the rules of RFC7541 Section 5.2 (at the end):
- * 		"A padding not corresponding to the most significant bits of the code for the 
- *		 EOS symbol MUST be treated as a decoding error.  A Huffman-encoded string 
- *		 literal containing the EOS symbol MUST be treated as a decoding error."
- */
-char *huff_decode(const char *stream, const size_t len) {
-	size_t bp = 0; /* bit position */
-	char *out = malloc(256);
-	out[255] = 0;
-	
-	/*
-	printf("first 0x%hhX%hhX%hhX%hhX\n", stream[0], stream[1], stream[2], stream[3]);
-  printf("huff_decode len=%zu\n", len);
-  */
-  
-	size_t i = 0;
-	while (bp/8 < len && i < 255) {
-		hnode_t *cur = tree; /* current node */
-		do {
-			size_t p = 7 - (bp % 8);
-			/* bit state */
-			size_t bs = (stream[bp/8] & (1<<p)) >>p;
-		
-#ifdef LOG_BITS
-			printf("(l=%zu bp8=%zu i=%zu bp=%zu", len, bp/8, i, bp);
-			printf(", bap=0x%hhX pos=%zu bs=%zu) bit: %zu\n", stream[bp/8], bp%8, p, bs);
-#endif /* LOG_BITS */
-			
-			if (!cur->left || !cur->right) {
-				out[i++] = cur->value;
-				
-#ifdef LOG_BITS
-				printf(" > value=%zu %c bp=%zu i=%hhX\n", cur->value, cur->value, bp, stream[bp / 8]);
-				printf("%zu> %hhu (%c)\n", i, cur->value, cur->value);
-#endif /* LOG_BITS */
-				
-				break;
-			}
-			
-			if (bs) {
-				cur = cur->right;
-				/*printf("1");*/
-			} else {
-				cur = cur->left;
-				/*printf("0");*/
-			}
-			bp+=1;
-		} while (bp/8 < len && i < 255);
+	while (input < end) {
+		const huffman_fsm_entry_t *entry = &huffman_fsm[state][*input >> 4];
+		if (entry->flags & HUFFMAN_FSM_SYMBOL)
+			*output++ = entry->symbol;
+		/* EOS leads to the root like a symbol, the error is checked at the end */
+		failed |= entry->flags;
+
+		entry = &huffman_fsm[entry->state][*input++ & 0xF];
+		if (entry->flags & HUFFMAN_FSM_SYMBOL)
+			*output++ = entry->symbol;
+		failed |= entry->flags;
+		state = entry->state;
+		flags = entry->flags;
 	}
-	/* null-terminate string. */
-	out[i] = 0;
-	#ifdef LOG_BITS
-	printf("bp=%zu strindex=%zu ", bp, bp/8);
-	printf("last bytes used: (0x%hhx is after 0x%hhx)\n", stream[bp/8], stream[(bp/8)-1]);
-	#endif /* LOG_BITS */
-	return out;
-}
 
-int huff_setup() {
-	tree = calloc(1, sizeof(hnode_t));
-	if (!tree)
+	/* the padding has to be at most 7 bits of the start of EOS (RFC 7541 Section 5.2) */
+	if ((failed & HUFFMAN_FSM_FAIL) || !(flags & HUFFMAN_FSM_ACCEPT))
 		return 0;
-	
-	size_t i, j;
-	for (i = 0; i < sizeof(http2_huffman_tree) / sizeof (http2_huffman_tree[0]); i++) {
-		const char *text = http2_huffman_tree[i];
-		hnode_t *current = tree;
-		/* setting the value initially to a predefined value. this is useful for debugging.*/
-		current->value = 648;
-		
-		for (j = 0; j < strlen(text); j++) {
-			if (text[j] == '0') {
-				if (!current->left) {
-					current = current->left = calloc(1, sizeof(hnode_t));
-				} else {
-					current = current->left;
-				}
-			} else if (text[j] == '1') {
-				if (!current->right) {
-					current = current->right = calloc(1, sizeof(hnode_t));
-				} else {
-					current = current->right;
-				}
-			} else {
-				puts("Corrupted huffman tree.");
-				/* maybe clean already allocated data? */
-				return 0;
-			}
-		}
-		
-		current->value = i+1;
-	}
-	
-	/*char test[] = { 0x72 };
-	'%c'\n", (char)huff_get(test, 7, 1));*/
-	
+	*decoded = output - destination;
 	return 1;
 }
 
-/* recursively destroying the node and its children */
-void destroy_node(hnode_t *node) {
-	if (node->left)  destroy_node(node->left);
-	if (node->right) destroy_node(node->right);
-	free(node);
+char *huff_decode(const char *source, size_t length, size_t *decoded) {
+	char *string = malloc(huff_decoded_length_max(length) + 1);
+	if (!string)
+		return NULL;
+	if (!huff_decode_to(string, source, length, decoded)) {
+		free(string);
+		return NULL;
+	}
+	string[*decoded] = 0;
+	return string;
 }
 
-void huff_destroy(void) {
-	if (tree)
-		destroy_node(tree);
+size_t huff_encoded_length(const char *string, size_t length) {
+	size_t bits = 0;
+	size_t i;
+	for (i = 0; i < length; i++)
+		bits += http2_huffman_code_lengths[string[i] & 0xFF];
+	return (bits + 7) / 8;
 }
 
+void huff_encode(char *destination, const char *string, size_t length) {
+	/* the bits that don't fill an octet yet, in the least significant 'count' bits */
+	uint64_t bits = 0;
+	size_t count = 0;
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned char symbol = string[i];
+		bits = (bits << http2_huffman_code_lengths[symbol]) | http2_huffman_codes[symbol];
+		count += http2_huffman_code_lengths[symbol];
+		while (count >= 8) {
+			count -= 8;
+			*destination++ = (bits >> count) & 0xFF;
+		}
+	}
+	if (count > 0)
+		*destination = ((bits << (8 - count)) | (0xFF >> count)) & 0xFF;
+}
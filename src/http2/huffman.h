@@ -8,32 +8,83 @@
 
 /**
  * Description:
- *   Decode a string from the source using Huffman decompression.
+ *   Calculates the most octets a Huffman-encoded string can decode to.
  *
  * Parameters:
+ *   size_t
+ *     The length of the encoded string.
+ *
+ * Return Value:
+ *   The amount of octets, without a null-terminator.
+ */
+size_t huff_decoded_length_max(size_t);
+
+/**
+ * Description:
+ *   Decodes a Huffman-encoded string (RFC 7541 Section 5.2). A string that
+ *   contains EOS, or that ends with padding that is longer than 7 bits or
+ *   isn't the start of EOS, is a decoding error.
+ *
+ * Parameters:
+ *   char *
+ *     The destination, of at least huff_decoded_length_max octets.
  *   const char *
- *     The octet stream to get the data from.
- *   const size_t
- *     The amount of octets the string should take up. This is very likely to be 
- *     smaller than the string length (since it's decompression).
+ *     The encoded string.
+ *   size_t
+ *     The length of the encoded string.
+ *   size_t *
+ *     The length of the decoded string, only set on success.
  *
  * Return Value:
- *   The decompressed, NULL-terminated string. This should be freed.
+ *   (boolean) Success status.
  */
-char *huff_decode(const char *, const size_t);
+int huff_decode_to(char *, const char *, size_t, size_t *);
 
 /**
  * Description:
- *   This function will construct the Huffman tree, using the data defined in
- *   "huffman_table.h".
+ *   Decodes a Huffman-encoded string into a new, null-terminated string, see
+ *   huff_decode_to.
+ *
+ * Parameters:
+ *   const char *
+ *     The encoded string.
+ *   size_t
+ *     The length of the encoded string.
+ *   size_t *
+ *     The length of the decoded string, only set on success.
  *
  * Return Value:
- *   Success status.
+ *   The string, which should be freed, or NULL on a decoding error or a
+ *   failed allocation.
  */
-int huff_setup(void);
+char *huff_decode(const char *, size_t, size_t *);
 
 /**
  * Description:
- *   This function will destroy all data allocated by huff_setup.
+ *   Calculates the length of a string after Huffman encoding.
+ *
+ * Parameters:
+ *   const char *
+ *     The string, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the string.
+ *
+ * Return Value:
+ *   The amount of octets, including the padding.
+ */
+size_t huff_encoded_length(const char *, size_t);
+
+/**
+ * Description:
+ *   Encodes a string using the Huffman code of RFC 7541 Appendix B, the last
+ *   octet is padded with the most significant bits of EOS.
+ *
+ * Parameters:
+ *   char *
+ *     The destination, of at least huff_encoded_length octets.
+ *   const char *
+ *     The string, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the string.
  */
-void huff_destroy(void);
+void huff_encode(char *, const char *, size_t);
@@ -0,0 +1,4886 @@
+/**
+ * Generated by tools/huffman-fsm.c from src/http2/huffman_table.h, don't edit.
+ */
+#ifndef HTTP2_HUFFMAN_FSM_H
+#define HTTP2_HUFFMAN_FSM_H
+
+#include <stdint.h>
+
+#define HUFFMAN_FSM_ACCEPT 0x1
+#define HUFFMAN_FSM_SYMBOL 0x2
+#define HUFFMAN_FSM_FAIL 0x4
+
+typedef struct {
+	uint8_t state;
+	uint8_t flags;
+	uint8_t symbol;
+} huffman_fsm_entry_t;
+
+static const huffman_fsm_entry_t huffman_fsm[256][16] = {
+	/* 0 */
+	{
+		{ 87, 0, 0 },
+		{ 88, 0, 0 },
+		{ 131, 0, 0 },
+		{ 135, 0, 0 },
+		{ 143, 0, 0 },
+		{ 69, 0, 0 },
+		{ 83, 0, 0 },
+		{ 90, 0, 0 },
+		{ 100, 0, 0 },
+		{ 132, 0, 0 },
+		{ 138, 0, 0 },
+		{ 95, 0, 0 },
+		{ 105, 0, 0 },
+		{ 112, 0, 0 },
+		{ 119, 0, 0 },
+		{ 4, HUFFMAN_FSM_ACCEPT, 0 }
+	},
+	/* 1 */
+	{
+		{ 101, 0, 0 },
+		{ 129, 0, 0 },
+		{ 133, 0, 0 },
+		{ 134, 0, 0 },
+		{ 139, 0, 0 },
+		{ 140, 0, 0 },
+		{ 142, 0, 0 },
+		{ 96, 0, 0 },
+		{ 106, 0, 0 },
+		{ 109, 0, 0 },
+		{ 113, 0, 0 },
+		{ 116, 0, 0 },
+		{ 120, 0, 0 },
+		{ 136, 0, 0 },
+		{ 144, 0, 0 },
+		{ 5, HUFFMAN_FSM_ACCEPT, 0 }
+	},
+	/* 2 */
+	{
+		{ 107, 0, 0 },
+		{ 108, 0, 0 },
+		{ 110, 0, 0 },
+		{ 111, 0, 0 },
+		{ 114, 0, 0 },
+		{ 115, 0, 0 },
+		{ 117, 0, 0 },
+		{ 118, 0, 0 },
+		{ 121, 0, 0 },
+		{ 122, 0, 0 },
+		{ 137, 0, 0 },
+		{ 141, 0, 0 },
+		{ 145, 0, 0 },
+		{ 146, 0, 0 },
+		{ 75, 0, 0 },
+		{ 6, HUFFMAN_FSM_ACCEPT, 0 }
+	},
+	/* 3 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 85 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 86 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 87 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 89 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 106 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 107 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 113 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 118 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 119 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 120 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 121 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 122 },
+		{ 76, 0, 0 },
+		{ 80, 0, 0 },
+		{ 123, 0, 0 },
+		{ 7, HUFFMAN_FSM_ACCEPT, 0 }
+	},
+	/* 4 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 119 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 120 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 121 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 122 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 38 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 42 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 44 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 59 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 88 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 90 },
+		{ 71, 0, 0 },
+		{ 8, 0, 0 }
+	},
+	/* 5 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 38 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 42 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 44 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 59 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 88 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 90 },
+		{ 72, 0, 0 },
+		{ 79, 0, 0 },
+		{ 77, 0, 0 },
+		{ 9, 0, 0 }
+	},
+	/* 6 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 88 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 90 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 33 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 34 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 40 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 41 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 63 },
+		{ 78, 0, 0 },
+		{ 73, 0, 0 },
+		{ 10, 0, 0 }
+	},
+	/* 7 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 33 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 34 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 40 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 41 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 63 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 39 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 43 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 124 },
+		{ 74, 0, 0 },
+		{ 11, 0, 0 },
+		{ 13, 0, 0 }
+	},
+	/* 8 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 63 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 39 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 43 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 124 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 35 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 62 },
+		{ 12, 0, 0 },
+		{ 102, 0, 0 },
+		{ 127, 0, 0 },
+		{ 14, 0, 0 }
+	},
+	/* 9 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 124 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 35 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 62 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 0 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 36 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 64 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 91 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 93 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 126 },
+		{ 128, 0, 0 },
+		{ 15, 0, 0 }
+	},
+	/* 10 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 0 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 36 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 64 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 91 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 93 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 126 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 94 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 125 },
+		{ 98, 0, 0 },
+		{ 16, 0, 0 }
+	},
+	/* 11 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 0 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 36 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 64 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 91 }
+	},
+	/* 12 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 0 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 0 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 36 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 36 }
+	},
+	/* 13 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 93 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 126 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 94 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 125 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 60 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 96 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 123 },
+		{ 17, 0, 0 }
+	},
+	/* 14 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 94 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 125 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 60 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 96 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 123 },
+		{ 124, 0, 0 },
+		{ 18, 0, 0 }
+	},
+	/* 15 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 60 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 96 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 123 },
+		{ 125, 0, 0 },
+		{ 155, 0, 0 },
+		{ 150, 0, 0 },
+		{ 19, 0, 0 }
+	},
+	/* 16 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 123 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 123 },
+		{ 126, 0, 0 },
+		{ 148, 0, 0 },
+		{ 156, 0, 0 },
+		{ 175, 0, 0 },
+		{ 196, 0, 0 },
+		{ 151, 0, 0 },
+		{ 20, 0, 0 },
+		{ 25, 0, 0 }
+	},
+	/* 17 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 92 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 195 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 208 },
+		{ 149, 0, 0 },
+		{ 157, 0, 0 },
+		{ 204, 0, 0 },
+		{ 241, 0, 0 },
+		{ 176, 0, 0 },
+		{ 197, 0, 0 },
+		{ 235, 0, 0 },
+		{ 152, 0, 0 },
+		{ 178, 0, 0 },
+		{ 199, 0, 0 },
+		{ 21, 0, 0 },
+		{ 167, 0, 0 },
+		{ 26, 0, 0 }
+	},
+	/* 18 */
+	{
+		{ 198, 0, 0 },
+		{ 202, 0, 0 },
+		{ 236, 0, 0 },
+		{ 242, 0, 0 },
+		{ 153, 0, 0 },
+		{ 158, 0, 0 },
+		{ 179, 0, 0 },
+		{ 183, 0, 0 },
+		{ 200, 0, 0 },
+		{ 206, 0, 0 },
+		{ 216, 0, 0 },
+		{ 22, 0, 0 },
+		{ 168, 0, 0 },
+		{ 185, 0, 0 },
+		{ 41, 0, 0 },
+		{ 27, 0, 0 }
+	},
+	/* 19 */
+	{
+		{ 201, 0, 0 },
+		{ 205, 0, 0 },
+		{ 207, 0, 0 },
+		{ 210, 0, 0 },
+		{ 217, 0, 0 },
+		{ 243, 0, 0 },
+		{ 23, 0, 0 },
+		{ 162, 0, 0 },
+		{ 169, 0, 0 },
+		{ 173, 0, 0 },
+		{ 186, 0, 0 },
+		{ 194, 0, 0 },
+		{ 208, 0, 0 },
+		{ 42, 0, 0 },
+		{ 191, 0, 0 },
+		{ 28, 0, 0 }
+	},
+	/* 20 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 178 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 181 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 185 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 186 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 187 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 189 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 190 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 196 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 198 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 228 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 232 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 233 },
+		{ 24, 0, 0 },
+		{ 161, 0, 0 },
+		{ 163, 0, 0 },
+		{ 164, 0, 0 }
+	},
+	/* 21 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 198 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 228 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 232 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 233 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 1 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 135 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 137 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 138 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 139 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 140 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 141 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 143 }
+	},
+	/* 22 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 1 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 135 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 137 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 138 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 139 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 140 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 141 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 143 }
+	},
+	/* 23 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 1 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 135 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 137 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 138 }
+	},
+	/* 24 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 1 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 1 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 135 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 135 }
+	},
+	/* 25 */
+	{
+		{ 170, 0, 0 },
+		{ 172, 0, 0 },
+		{ 174, 0, 0 },
+		{ 181, 0, 0 },
+		{ 187, 0, 0 },
+		{ 189, 0, 0 },
+		{ 195, 0, 0 },
+		{ 203, 0, 0 },
+		{ 209, 0, 0 },
+		{ 215, 0, 0 },
+		{ 43, 0, 0 },
+		{ 165, 0, 0 },
+		{ 192, 0, 0 },
+		{ 218, 0, 0 },
+		{ 211, 0, 0 },
+		{ 29, 0, 0 }
+	},
+	/* 26 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 188 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 191 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 197 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 231 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 239 },
+		{ 44, 0, 0 },
+		{ 166, 0, 0 },
+		{ 171, 0, 0 },
+		{ 193, 0, 0 },
+		{ 234, 0, 0 },
+		{ 245, 0, 0 },
+		{ 219, 0, 0 },
+		{ 212, 0, 0 },
+		{ 224, 0, 0 },
+		{ 229, 0, 0 },
+		{ 30, 0, 0 }
+	},
+	/* 27 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 171 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 206 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 215 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 225 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 236 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 237 },
+		{ 220, 0, 0 },
+		{ 244, 0, 0 },
+		{ 213, 0, 0 },
+		{ 222, 0, 0 },
+		{ 237, 0, 0 },
+		{ 225, 0, 0 },
+		{ 230, 0, 0 },
+		{ 249, 0, 0 },
+		{ 31, 0, 0 },
+		{ 45, 0, 0 }
+	},
+	/* 28 */
+	{
+		{ 214, 0, 0 },
+		{ 221, 0, 0 },
+		{ 223, 0, 0 },
+		{ 228, 0, 0 },
+		{ 238, 0, 0 },
+		{ 246, 0, 0 },
+		{ 248, 0, 0 },
+		{ 226, 0, 0 },
+		{ 231, 0, 0 },
+		{ 239, 0, 0 },
+		{ 250, 0, 0 },
+		{ 253, 0, 0 },
+		{ 32, 0, 0 },
+		{ 38, 0, 0 },
+		{ 55, 0, 0 },
+		{ 46, 0, 0 }
+	},
+	/* 29 */
+	{
+		{ 232, 0, 0 },
+		{ 233, 0, 0 },
+		{ 240, 0, 0 },
+		{ 247, 0, 0 },
+		{ 251, 0, 0 },
+		{ 252, 0, 0 },
+		{ 254, 0, 0 },
+		{ 255, 0, 0 },
+		{ 33, 0, 0 },
+		{ 35, 0, 0 },
+		{ 39, 0, 0 },
+		{ 52, 0, 0 },
+		{ 56, 0, 0 },
+		{ 60, 0, 0 },
+		{ 63, 0, 0 },
+		{ 47, 0, 0 }
+	},
+	/* 30 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 254 },
+		{ 34, 0, 0 },
+		{ 36, 0, 0 },
+		{ 37, 0, 0 },
+		{ 40, 0, 0 },
+		{ 51, 0, 0 },
+		{ 53, 0, 0 },
+		{ 54, 0, 0 },
+		{ 57, 0, 0 },
+		{ 58, 0, 0 },
+		{ 61, 0, 0 },
+		{ 62, 0, 0 },
+		{ 64, 0, 0 },
+		{ 65, 0, 0 },
+		{ 147, 0, 0 },
+		{ 48, 0, 0 }
+	},
+	/* 31 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 254 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 2 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 3 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 4 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 5 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 6 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 7 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 8 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 11 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 12 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 14 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 15 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 16 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 17 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 18 }
+	},
+	/* 32 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 254 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 2 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 3 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 4 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 5 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 6 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 7 }
+	},
+	/* 33 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 254 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 254 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 2 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 3 }
+	},
+	/* 34 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 2 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 2 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 3 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 3 }
+	},
+	/* 35 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 4 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 5 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 6 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 7 }
+	},
+	/* 36 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 4 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 4 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 5 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 5 }
+	},
+	/* 37 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 6 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 6 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 7 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 7 }
+	},
+	/* 38 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 8 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 11 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 12 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 14 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 15 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 16 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 17 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 18 }
+	},
+	/* 39 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 8 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 11 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 12 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 14 }
+	},
+	/* 40 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 8 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 8 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 11 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 11 }
+	},
+	/* 41 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 188 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 191 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 197 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 231 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 239 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 9 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 142 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 144 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 145 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 148 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 159 }
+	},
+	/* 42 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 239 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 9 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 142 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 144 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 145 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 148 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 159 }
+	},
+	/* 43 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 239 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 239 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 9 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 142 }
+	},
+	/* 44 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 9 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 9 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 142 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 142 }
+	},
+	/* 45 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 19 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 20 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 21 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 23 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 24 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 25 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 26 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 27 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 28 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 29 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 30 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 31 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 127 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 220 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 249 },
+		{ 49, 0, 0 }
+	},
+	/* 46 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 28 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 29 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 30 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 31 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 127 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 220 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 249 },
+		{ 50, 0, 0 },
+		{ 59, 0, 0 }
+	},
+	/* 47 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 127 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 220 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 249 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 10 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 13 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 22 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 }
+	},
+	/* 48 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 249 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 249 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 10 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 13 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 22 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 }
+	},
+	/* 49 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 10 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 13 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 22 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 }
+	},
+	/* 50 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 10 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 10 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 13 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 13 }
+	},
+	/* 51 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 12 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 12 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 14 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 14 }
+	},
+	/* 52 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 15 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 16 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 17 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 18 }
+	},
+	/* 53 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 15 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 15 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 16 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 16 }
+	},
+	/* 54 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 17 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 17 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 18 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 18 }
+	},
+	/* 55 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 19 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 20 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 21 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 23 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 24 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 25 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 26 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 27 }
+	},
+	/* 56 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 19 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 20 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 21 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 23 }
+	},
+	/* 57 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 19 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 19 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 20 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 20 }
+	},
+	/* 58 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 21 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 21 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 23 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 23 }
+	},
+	/* 59 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 22 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 22 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 },
+		{ 0, HUFFMAN_FSM_FAIL, 0 }
+	},
+	/* 60 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 24 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 25 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 26 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 27 }
+	},
+	/* 61 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 24 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 24 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 25 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 25 }
+	},
+	/* 62 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 26 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 26 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 27 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 27 }
+	},
+	/* 63 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 28 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 29 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 30 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 31 }
+	},
+	/* 64 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 28 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 28 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 29 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 29 }
+	},
+	/* 65 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 30 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 30 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 31 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 31 }
+	},
+	/* 66 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 48 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 49 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 50 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 97 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 99 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 101 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 105 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 111 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 115 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 116 },
+		{ 70, 0, 0 },
+		{ 81, 0, 0 },
+		{ 84, 0, 0 },
+		{ 89, 0, 0 },
+		{ 91, 0, 0 },
+		{ 92, 0, 0 }
+	},
+	/* 67 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 115 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 116 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 32 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 37 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 45 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 46 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 47 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 51 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 52 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 53 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 54 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 55 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 56 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 57 }
+	},
+	/* 68 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 115 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 116 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 32 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 37 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 45 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 46 }
+	},
+	/* 69 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 32 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 37 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 45 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 46 }
+	},
+	/* 70 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 32 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 32 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 37 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 37 }
+	},
+	/* 71 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 33 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 34 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 40 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 41 }
+	},
+	/* 72 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 33 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 33 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 34 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 34 }
+	},
+	/* 73 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 124 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 124 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 35 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 62 }
+	},
+	/* 74 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 35 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 35 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 62 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 62 }
+	},
+	/* 75 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 38 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 42 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 44 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 59 }
+	},
+	/* 76 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 38 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 38 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 42 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 42 }
+	},
+	/* 77 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 63 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 63 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 39 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 43 }
+	},
+	/* 78 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 39 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 39 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 43 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 43 }
+	},
+	/* 79 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 40 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 40 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 41 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 41 }
+	},
+	/* 80 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 44 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 44 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 59 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 59 }
+	},
+	/* 81 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 45 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 45 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 46 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 46 }
+	},
+	/* 82 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 47 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 51 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 52 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 53 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 54 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 55 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 56 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 57 }
+	},
+	/* 83 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 47 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 51 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 52 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 53 }
+	},
+	/* 84 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 47 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 47 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 51 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 51 }
+	},
+	/* 85 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 48 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 49 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 50 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 97 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 99 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 101 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 105 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 111 }
+	},
+	/* 86 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 48 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 49 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 50 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 97 }
+	},
+	/* 87 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 48 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 48 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 49 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 49 }
+	},
+	/* 88 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 50 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 50 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 97 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 97 }
+	},
+	/* 89 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 52 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 52 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 53 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 53 }
+	},
+	/* 90 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 54 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 55 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 56 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 57 }
+	},
+	/* 91 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 54 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 54 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 55 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 55 }
+	},
+	/* 92 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 56 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 56 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 57 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 57 }
+	},
+	/* 93 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 61 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 65 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 95 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 98 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 100 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 102 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 103 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 104 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 108 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 109 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 110 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 112 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 114 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 117 },
+		{ 97, 0, 0 },
+		{ 103, 0, 0 }
+	},
+	/* 94 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 108 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 109 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 110 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 112 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 114 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 117 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 58 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 66 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 67 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 68 }
+	},
+	/* 95 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 114 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 117 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 58 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 66 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 67 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 68 }
+	},
+	/* 96 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 58 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 66 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 67 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 68 }
+	},
+	/* 97 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 58 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 58 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 66 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 66 }
+	},
+	/* 98 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 60 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 60 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 96 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 96 }
+	},
+	/* 99 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 61 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 65 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 95 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 98 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 100 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 102 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 103 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 104 }
+	},
+	/* 100 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 61 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 65 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 95 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 98 }
+	},
+	/* 101 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 61 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 61 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 65 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 65 }
+	},
+	/* 102 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 64 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 64 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 91 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 91 }
+	},
+	/* 103 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 67 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 67 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 68 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 68 }
+	},
+	/* 104 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 69 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 70 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 71 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 72 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 73 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 74 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 75 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 76 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 77 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 78 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 79 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 80 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 81 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 82 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 83 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 84 }
+	},
+	/* 105 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 69 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 70 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 71 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 72 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 73 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 74 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 75 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 76 }
+	},
+	/* 106 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 69 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 70 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 71 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 72 }
+	},
+	/* 107 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 69 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 69 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 70 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 70 }
+	},
+	/* 108 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 71 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 71 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 72 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 72 }
+	},
+	/* 109 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 73 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 74 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 75 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 76 }
+	},
+	/* 110 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 73 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 73 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 74 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 74 }
+	},
+	/* 111 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 75 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 75 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 76 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 76 }
+	},
+	/* 112 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 77 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 78 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 79 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 80 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 81 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 82 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 83 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 84 }
+	},
+	/* 113 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 77 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 78 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 79 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 80 }
+	},
+	/* 114 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 77 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 77 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 78 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 78 }
+	},
+	/* 115 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 79 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 79 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 80 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 80 }
+	},
+	/* 116 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 81 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 82 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 83 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 84 }
+	},
+	/* 117 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 81 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 81 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 82 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 82 }
+	},
+	/* 118 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 83 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 83 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 84 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 84 }
+	},
+	/* 119 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 85 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 86 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 87 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 89 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 106 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 107 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 113 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 118 }
+	},
+	/* 120 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 85 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 86 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 87 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 89 }
+	},
+	/* 121 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 85 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 85 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 86 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 86 }
+	},
+	/* 122 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 87 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 87 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 89 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 89 }
+	},
+	/* 123 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 88 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 88 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 90 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 90 }
+	},
+	/* 124 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 92 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 195 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 208 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 128 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 130 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 131 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 162 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 184 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 194 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 224 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 226 },
+		{ 177, 0, 0 },
+		{ 188, 0, 0 }
+	},
+	/* 125 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 92 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 195 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 208 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 128 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 130 }
+	},
+	/* 126 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 92 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 92 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 195 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 195 }
+	},
+	/* 127 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 93 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 93 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 126 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 126 }
+	},
+	/* 128 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 94 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 94 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 125 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 125 }
+	},
+	/* 129 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 95 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 95 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 98 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 98 }
+	},
+	/* 130 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 99 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 101 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 105 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 111 }
+	},
+	/* 131 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 99 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 99 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 101 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 101 }
+	},
+	/* 132 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 100 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 102 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 103 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 104 }
+	},
+	/* 133 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 100 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 100 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 102 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 102 }
+	},
+	/* 134 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 103 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 103 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 104 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 104 }
+	},
+	/* 135 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 105 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 105 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 111 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 111 }
+	},
+	/* 136 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 106 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 107 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 113 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 118 }
+	},
+	/* 137 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 106 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 106 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 107 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 107 }
+	},
+	/* 138 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 108 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 109 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 110 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 112 }
+	},
+	/* 139 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 108 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 108 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 109 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 109 }
+	},
+	/* 140 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 110 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 110 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 112 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 112 }
+	},
+	/* 141 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 113 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 113 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 118 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 118 }
+	},
+	/* 142 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 114 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 114 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 117 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 117 }
+	},
+	/* 143 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 115 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 115 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 116 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 116 }
+	},
+	/* 144 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 119 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 120 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 121 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 122 }
+	},
+	/* 145 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 119 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 119 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 120 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 120 }
+	},
+	/* 146 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 121 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 121 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 122 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 122 }
+	},
+	/* 147 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 127 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 127 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 220 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 220 }
+	},
+	/* 148 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 208 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 208 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 128 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 130 }
+	},
+	/* 149 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 128 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 128 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 130 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 130 }
+	},
+	/* 150 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 176 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 177 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 179 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 209 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 216 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 217 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 227 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 229 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 230 },
+		{ 154, 0, 0 },
+		{ 159, 0, 0 },
+		{ 160, 0, 0 },
+		{ 180, 0, 0 },
+		{ 182, 0, 0 },
+		{ 184, 0, 0 },
+		{ 190, 0, 0 }
+	},
+	/* 151 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 230 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 129 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 132 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 133 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 134 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 136 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 146 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 154 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 156 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 160 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 163 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 164 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 169 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 170 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 173 }
+	},
+	/* 152 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 230 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 129 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 132 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 133 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 134 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 136 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 146 }
+	},
+	/* 153 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 230 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 230 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 129 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 132 }
+	},
+	/* 154 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 129 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 129 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 132 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 132 }
+	},
+	/* 155 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 131 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 162 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 184 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 194 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 224 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 226 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 153 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 161 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 167 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 172 }
+	},
+	/* 156 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 131 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 162 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 184 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 194 }
+	},
+	/* 157 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 131 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 131 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 162 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 162 }
+	},
+	/* 158 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 133 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 134 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 136 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 146 }
+	},
+	/* 159 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 133 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 133 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 134 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 134 }
+	},
+	/* 160 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 136 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 136 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 146 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 146 }
+	},
+	/* 161 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 137 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 137 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 138 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 138 }
+	},
+	/* 162 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 139 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 140 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 141 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 143 }
+	},
+	/* 163 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 139 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 139 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 140 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 140 }
+	},
+	/* 164 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 141 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 141 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 143 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 143 }
+	},
+	/* 165 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 144 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 145 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 148 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 159 }
+	},
+	/* 166 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 144 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 144 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 145 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 145 }
+	},
+	/* 167 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 147 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 149 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 150 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 151 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 152 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 155 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 157 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 158 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 165 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 166 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 168 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 174 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 175 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 180 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 182 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 183 }
+	},
+	/* 168 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 147 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 149 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 150 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 151 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 152 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 155 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 157 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 158 }
+	},
+	/* 169 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 147 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 149 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 150 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 151 }
+	},
+	/* 170 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 147 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 147 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 149 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 149 }
+	},
+	/* 171 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 148 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 148 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 159 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 159 }
+	},
+	/* 172 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 150 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 150 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 151 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 151 }
+	},
+	/* 173 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 152 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 155 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 157 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 158 }
+	},
+	/* 174 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 152 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 152 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 155 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 155 }
+	},
+	/* 175 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 224 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 226 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 153 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 161 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 167 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 172 }
+	},
+	/* 176 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 153 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 161 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 167 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 172 }
+	},
+	/* 177 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 153 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 153 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 161 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 161 }
+	},
+	/* 178 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 154 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 156 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 160 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 163 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 164 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 169 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 170 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 173 }
+	},
+	/* 179 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 154 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 156 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 160 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 163 }
+	},
+	/* 180 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 154 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 154 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 156 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 156 }
+	},
+	/* 181 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 157 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 157 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 158 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 158 }
+	},
+	/* 182 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 160 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 160 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 163 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 163 }
+	},
+	/* 183 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 164 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 169 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 170 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 173 }
+	},
+	/* 184 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 164 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 164 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 169 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 169 }
+	},
+	/* 185 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 165 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 166 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 168 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 174 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 175 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 180 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 182 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 183 }
+	},
+	/* 186 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 165 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 166 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 168 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 174 }
+	},
+	/* 187 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 165 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 165 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 166 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 166 }
+	},
+	/* 188 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 167 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 167 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 172 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 172 }
+	},
+	/* 189 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 168 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 168 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 174 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 174 }
+	},
+	/* 190 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 170 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 170 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 173 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 173 }
+	},
+	/* 191 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 171 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 206 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 215 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 225 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 236 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 237 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 199 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 207 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 234 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 235 }
+	},
+	/* 192 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 171 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 206 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 215 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 225 }
+	},
+	/* 193 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 171 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 171 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 206 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 206 }
+	},
+	/* 194 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 175 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 180 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 182 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 183 }
+	},
+	/* 195 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 175 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 175 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 180 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 180 }
+	},
+	/* 196 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 176 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 177 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 179 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 209 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 216 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 217 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 227 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 229 }
+	},
+	/* 197 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 176 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 177 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 179 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 209 }
+	},
+	/* 198 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 176 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 176 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 177 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 177 }
+	},
+	/* 199 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 178 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 181 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 185 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 186 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 187 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 189 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 190 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 196 }
+	},
+	/* 200 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 178 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 181 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 185 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 186 }
+	},
+	/* 201 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 178 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 178 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 181 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 181 }
+	},
+	/* 202 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 179 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 179 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 209 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 209 }
+	},
+	/* 203 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 182 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 182 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 183 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 183 }
+	},
+	/* 204 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 184 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 184 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 194 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 194 }
+	},
+	/* 205 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 185 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 185 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 186 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 186 }
+	},
+	/* 206 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 187 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 189 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 190 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 196 }
+	},
+	/* 207 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 187 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 187 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 189 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 189 }
+	},
+	/* 208 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 188 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 191 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 197 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 231 }
+	},
+	/* 209 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 188 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 188 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 191 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 191 }
+	},
+	/* 210 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 190 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 190 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 196 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 196 }
+	},
+	/* 211 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 192 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 193 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 200 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 201 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 202 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 205 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 210 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 213 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 218 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 219 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 238 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 240 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 242 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 243 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 255 },
+		{ 227, 0, 0 }
+	},
+	/* 212 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 192 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 193 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 200 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 201 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 202 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 205 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 210 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 213 }
+	},
+	/* 213 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 192 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 193 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 200 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 201 }
+	},
+	/* 214 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 192 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 192 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 193 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 193 }
+	},
+	/* 215 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 197 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 197 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 231 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 231 }
+	},
+	/* 216 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 198 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 228 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 232 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 233 }
+	},
+	/* 217 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 198 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 198 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 228 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 228 }
+	},
+	/* 218 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 236 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 237 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 199 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 207 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 234 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 235 }
+	},
+	/* 219 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 199 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 207 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 234 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 235 }
+	},
+	/* 220 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 199 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 199 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 207 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 207 }
+	},
+	/* 221 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 200 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 200 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 201 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 201 }
+	},
+	/* 222 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 202 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 205 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 210 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 213 }
+	},
+	/* 223 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 202 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 202 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 205 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 205 }
+	},
+	/* 224 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 218 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 219 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 238 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 240 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 242 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 243 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 255 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 203 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 204 }
+	},
+	/* 225 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 242 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 243 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 255 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 203 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 204 }
+	},
+	/* 226 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 255 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 255 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 203 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 204 }
+	},
+	/* 227 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 203 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 203 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 204 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 204 }
+	},
+	/* 228 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 210 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 210 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 213 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 213 }
+	},
+	/* 229 */
+	{
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 211 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 212 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 214 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 221 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 222 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 223 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 241 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 244 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 245 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 246 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 247 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 248 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 250 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 251 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 252 },
+		{ 0, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 253 }
+	},
+	/* 230 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 211 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 212 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 214 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 221 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 222 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 223 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 241 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 244 }
+	},
+	/* 231 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 211 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 212 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 214 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 221 }
+	},
+	/* 232 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 211 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 211 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 212 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 212 }
+	},
+	/* 233 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 214 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 214 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 221 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 221 }
+	},
+	/* 234 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 215 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 215 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 225 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 225 }
+	},
+	/* 235 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 216 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 217 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 227 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 229 }
+	},
+	/* 236 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 216 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 216 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 217 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 217 }
+	},
+	/* 237 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 218 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 219 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 238 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 240 }
+	},
+	/* 238 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 218 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 218 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 219 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 219 }
+	},
+	/* 239 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 222 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 223 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 241 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 244 }
+	},
+	/* 240 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 222 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 222 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 223 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 223 }
+	},
+	/* 241 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 224 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 224 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 226 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 226 }
+	},
+	/* 242 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 227 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 227 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 229 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 229 }
+	},
+	/* 243 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 232 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 232 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 233 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 233 }
+	},
+	/* 244 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 234 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 234 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 235 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 235 }
+	},
+	/* 245 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 236 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 236 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 237 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 237 }
+	},
+	/* 246 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 238 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 238 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 240 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 240 }
+	},
+	/* 247 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 241 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 241 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 244 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 244 }
+	},
+	/* 248 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 242 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 242 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 243 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 243 }
+	},
+	/* 249 */
+	{
+		{ 66, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 245 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 246 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 247 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 248 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 250 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 251 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 252 },
+		{ 66, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 1, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 253 }
+	},
+	/* 250 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 245 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 246 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 247 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 248 }
+	},
+	/* 251 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 245 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 245 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 246 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 246 }
+	},
+	/* 252 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 247 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 247 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 248 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 248 }
+	},
+	/* 253 */
+	{
+		{ 85, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 250 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 251 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 252 },
+		{ 85, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 67, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 93, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 2, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 253 }
+	},
+	/* 254 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 250 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 250 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 251 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 251 }
+	},
+	/* 255 */
+	{
+		{ 86, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 252 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 252 },
+		{ 86, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 130, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 68, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 82, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 99, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 94, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 104, HUFFMAN_FSM_SYMBOL, 253 },
+		{ 3, HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT, 253 }
+	}
+};
+
+#endif /* HTTP2_HUFFMAN_FSM_H */
@@ -2,273 +2,67 @@
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
  * 
- * This file contains symbols describing functions about the dynamic & static tables.
+ * This file contains the Huffman code of RFC 7541 Appendix B. The decoder uses
+ * the state machine that tools/huffman-fsm.c generates from it.
  */
+#include <stdint.h>
 
 /**
- * Can't think of anything clever to store these right now, other than as string literals.
- * The problem is that, the length of the bits, and the bits themselve must be stored in a 
- * fast but compact format. strings are easy to represent, so i'll do this for now.
- * 
- * This table is only used in initialization of the Huffman tree, so only that section may 
- * take long. (This isn't the case, since I ran a time test.
+ * The codes of RFC 7541 Appendix B: the bits of a code are the least
+ * significant bits of the value. The last one is EOS.
  */
-const char *http2_huffman_tree[256] = {
-	"1111111111000",
-	"11111111111111111011000",
-	"1111111111111111111111100010",				/* 1 */
-	"1111111111111111111111100011",
-	"1111111111111111111111100100",
-	"1111111111111111111111100101",
-	"1111111111111111111111100110",
-	"1111111111111111111111100111",
-	"1111111111111111111111101000",
-	"111111111111111111101010",
-	"111111111111111111111111111100",			/* 10 */
-	"1111111111111111111111101001",
-	"1111111111111111111111101010"
-	"111111111111111111111111111101",
-	"1111111111111111111111101011",
-	"1111111111111111111111101100",
-	"1111111111111111111111101101",
-	"1111111111111111111111101110",
-	"1111111111111111111111101111",
-	"1111111111111111111111110000",
-	"1111111111111111111111110001",				/* 20 */
-	"1111111111111111111111110010",
-	"111111111111111111111111111110",
-	"1111111111111111111111110011",
-	"1111111111111111111111110100",
-	"1111111111111111111111110101",
-	"1111111111111111111111110110",
-	"1111111111111111111111110111",
-	"1111111111111111111111111000",
-	"1111111111111111111111111001",
-	"1111111111111111111111111010",				/* 30 */
-	"1111111111111111111111111011",
-	"010100",
-	"1111111000",
-	"1111111001", 
-	"111111111010",
-	"1111111111001",
-	"010101",
-	"11111000",
-	"11111111010",
-	"1111111010",													/* 40 */
-	"1111111011",
-	"11111001",
-	"11111111011",
-	"11111010",
-	"010110",
-	"010111",
-	"011000",
-	"00000",
-	"00001",
-	"00010",															/* 50 */
-	"011001",
-	"011010",
-	"011011",
-	"011100",
-	"011101",
-	"011110",
-	"011111",
-	"1011100",
-	"11111011",
-	"11111111111110",											/* 60 */
-	"100000",
-	"111111111011",
-	"1111111100",
-	"1111111111010",
-	"100001",
-	"1011101",
-	"1011110",              
-	"1011111",
-	"1100000",
-	"1100001",														/* 70 */
-	"1100010",
-	"1100011",
-	"1100100",
-	"1100101",
-	"1100110",
-	"1100111",
-	"1101000",
-	"1101001",
-	"1101010",
-	"1101011",														/* 80 */
-	"1101100",
-	"1101101",
-	"1101110",
-	"1101111",
-	"1110000",
-	"1110001",
-	"1110010",
-	"11111100",
-	"1110011",
-	"11111101",														/* 90 */
-	"1111111111011",
-	"1111111111111110000",
-	"1111111111100",
-	"11111111111100",
-	"100010",
-	"111111111111101",
-	"00011",
-	"100011",
-	"00100",
-	"100100",															/* 100 */
-	"00101",
-	"100101",
-	"100110",
-	"100111",
-	"00110",
-	"1110100",
-	"1110101",
-	"101000",
-	"101001",
-	"101010",															/* 110 */
-	"00111",
-	"101011",
-	"1110110",
-	"101100",
-	"01000",
-	"01001",
-	"101101",
-	"1110111",
-	"1111000",
-	"1111001",														/* 120 */
-	"1111010",
-	"1111011",
-	"111111111111110",
-	"11111111100",
-	"11111111111101",
-	"1111111111101",
-	"1111111111111111111111111100",
-	"11111111111111100110",
-	"1111111111111111010010",
-	"11111111111111100111",								/* 130 */
-	"11111111111111101000",
-	"1111111111111111010011",
-	"1111111111111111010100",
-	"1111111111111111010101",
-	"11111111111111111011001",
-	"1111111111111111010110",
-	"11111111111111111011010",
-	"11111111111111111011011",
-	"11111111111111111011100",
-	"11111111111111111011101",						/* 140 */
-	"11111111111111111011110",
-	"111111111111111111101011",
-	"11111111111111111011111",
-	"111111111111111111101100",
-	"111111111111111111101101",
-	"1111111111111111010111",
-	"11111111111111111100000",
-	"111111111111111111101110",
-	"11111111111111111100001",
-	"11111111111111111100010",						/* 150 */
-	"11111111111111111100011",
-	"11111111111111111100100",
-	"111111111111111011100",
-	"1111111111111111011000",
-	"11111111111111111100101",
-	"1111111111111111011001",
-	"11111111111111111100110",
-	"11111111111111111100111",
-	"111111111111111111101111",
-	"1111111111111111011010",							/* 160 */
-	"111111111111111011101",
-	"11111111111111101001",
-	"1111111111111111011011",
-	"1111111111111111011100",
-	"11111111111111111101000",
-	"11111111111111111101001",
-	"111111111111111011110",
-	"11111111111111111101010",
-	"1111111111111111011101",
-	"1111111111111111011110",							/* 170 */
-	"111111111111111111110000",
-	"111111111111111011111",
-	"1111111111111111011111",
-	"11111111111111111101011",
-	"11111111111111111101100",
-	"111111111111111100000",
-	"111111111111111100001",
-	"1111111111111111100000",
-	"111111111111111100010",
-	"11111111111111111101101",						/* 180 */
-	"1111111111111111100001",
-	"11111111111111111101110",
-	"11111111111111111101111",
-	"11111111111111101010",
-	"1111111111111111100010",
-	"1111111111111111100011",
-	"1111111111111111100100",
-	"11111111111111111110000",
-	"1111111111111111100101",
-	"1111111111111111100110",							/* 190 */
-	"11111111111111111110001",
-	"11111111111111111111100000",
-	"11111111111111111111100001",
-	"11111111111111101011",
-	"1111111111111110001",
-	"1111111111111111100111",
-	"11111111111111111110010",
-	"1111111111111111101000",
-	"1111111111111111111101100",
-	"11111111111111111111100010",					/* 200 */
-	"11111111111111111111100011",
-	"11111111111111111111100100",
-	"111111111111111111111011110",
-	"111111111111111111111011111",
-	"11111111111111111111100101",
-	"111111111111111111110001",
-	"1111111111111111111101101",
-	"1111111111111110010",
-	"111111111111111100011",
-	"11111111111111111111100110",					/* 210 */
-	"111111111111111111111100000",
-	"111111111111111111111100001",
-	"11111111111111111111100111",
-	"111111111111111111111100010",
-	"111111111111111111110010",
-	"111111111111111100100",
-	"111111111111111100101",
-	"11111111111111111111101000",
-	"11111111111111111111101001",
-	"1111111111111111111111111101",				/* 220 */
-	"111111111111111111111100011",
-	"111111111111111111111100100",
-	"111111111111111111111100101",
-	"11111111111111101100",
-	"111111111111111111110011",
-	"11111111111111101101",
-	"111111111111111100110",
-	"1111111111111111101001",
-	"111111111111111100111",
-	"111111111111111101000",							/* 230 */
-	"11111111111111111110011",
-	"1111111111111111101010",
-	"1111111111111111101011",
-	"1111111111111111111101110",
-	"1111111111111111111101111",
-	"111111111111111111110100",
-	"111111111111111111110101",
-	"11111111111111111111101010",
-	"11111111111111111110100",
-	"11111111111111111111101011",					/* 240 */
-	"111111111111111111111100110",
-	"11111111111111111111101100",
-	"11111111111111111111101101",
-	"111111111111111111111100111",
-	"111111111111111111111101000",
-	"111111111111111111111101001",
-	"111111111111111111111101010",
-	"111111111111111111111101011",
-	"1111111111111111111111111110",
-	"111111111111111111111101100",				/* 250 */
-	"111111111111111111111101101",
-	"111111111111111111111101110",
-	"111111111111111111111101111",
-	"111111111111111111111110000",
-	"11111111111111111111101110",
-	"111111111111111111111111111111",			/* EOS */
+const uint32_t http2_huffman_codes[257] = {
+	0x1ff8, 0x7fffd8, 0xfffffe2, 0xfffffe3, 0xfffffe4, 0xfffffe5, 0xfffffe6, 0xfffffe7,	/* 0 */
+	0xfffffe8, 0xffffea, 0x3ffffffc, 0xfffffe9, 0xfffffea, 0x3ffffffd, 0xfffffeb, 0xfffffec,	/* 8 */
+	0xfffffed, 0xfffffee, 0xfffffef, 0xffffff0, 0xffffff1, 0xffffff2, 0x3ffffffe, 0xffffff3,	/* 16 */
+	0xffffff4, 0xffffff5, 0xffffff6, 0xffffff7, 0xffffff8, 0xffffff9, 0xffffffa, 0xffffffb,	/* 24 */
+	0x14, 0x3f8, 0x3f9, 0xffa, 0x1ff9, 0x15, 0xf8, 0x7fa,	/* 32 */
+	0x3fa, 0x3fb, 0xf9, 0x7fb, 0xfa, 0x16, 0x17, 0x18,	/* 40 */
+	0x0, 0x1, 0x2, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,	/* 48 */
+	0x1e, 0x1f, 0x5c, 0xfb, 0x7ffc, 0x20, 0xffb, 0x3fc,	/* 56 */
+	0x1ffa, 0x21, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62,	/* 64 */
+	0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,	/* 72 */
+	0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,	/* 80 */
+	0xfc, 0x73, 0xfd, 0x1ffb, 0x7fff0, 0x1ffc, 0x3ffc, 0x22,	/* 88 */
+	0x7ffd, 0x3, 0x23, 0x4, 0x24, 0x5, 0x25, 0x26,	/* 96 */
+	0x27, 0x6, 0x74, 0x75, 0x28, 0x29, 0x2a, 0x7,	/* 104 */
+	0x2b, 0x76, 0x2c, 0x8, 0x9, 0x2d, 0x77, 0x78,	/* 112 */
+	0x79, 0x7a, 0x7b, 0x7ffe, 0x7fc, 0x3ffd, 0x1ffd, 0xffffffc,	/* 120 */
+	0xfffe6, 0x3fffd2, 0xfffe7, 0xfffe8, 0x3fffd3, 0x3fffd4, 0x3fffd5, 0x7fffd9,	/* 128 */
+	0x3fffd6, 0x7fffda, 0x7fffdb, 0x7fffdc, 0x7fffdd, 0x7fffde, 0xffffeb, 0x7fffdf,	/* 136 */
+	0xffffec, 0xffffed, 0x3fffd7, 0x7fffe0, 0xffffee, 0x7fffe1, 0x7fffe2, 0x7fffe3,	/* 144 */
+	0x7fffe4, 0x1fffdc, 0x3fffd8, 0x7fffe5, 0x3fffd9, 0x7fffe6, 0x7fffe7, 0xffffef,	/* 152 */
+	0x3fffda, 0x1fffdd, 0xfffe9, 0x3fffdb, 0x3fffdc, 0x7fffe8, 0x7fffe9, 0x1fffde,	/* 160 */
+	0x7fffea, 0x3fffdd, 0x3fffde, 0xfffff0, 0x1fffdf, 0x3fffdf, 0x7fffeb, 0x7fffec,	/* 168 */
+	0x1fffe0, 0x1fffe1, 0x3fffe0, 0x1fffe2, 0x7fffed, 0x3fffe1, 0x7fffee, 0x7fffef,	/* 176 */
+	0xfffea, 0x3fffe2, 0x3fffe3, 0x3fffe4, 0x7ffff0, 0x3fffe5, 0x3fffe6, 0x7ffff1,	/* 184 */
+	0x3ffffe0, 0x3ffffe1, 0xfffeb, 0x7fff1, 0x3fffe7, 0x7ffff2, 0x3fffe8, 0x1ffffec,	/* 192 */
+	0x3ffffe2, 0x3ffffe3, 0x3ffffe4, 0x7ffffde, 0x7ffffdf, 0x3ffffe5, 0xfffff1, 0x1ffffed,	/* 200 */
+	0x7fff2, 0x1fffe3, 0x3ffffe6, 0x7ffffe0, 0x7ffffe1, 0x3ffffe7, 0x7ffffe2, 0xfffff2,	/* 208 */
+	0x1fffe4, 0x1fffe5, 0x3ffffe8, 0x3ffffe9, 0xffffffd, 0x7ffffe3, 0x7ffffe4, 0x7ffffe5,	/* 216 */
+	0xfffec, 0xfffff3, 0xfffed, 0x1fffe6, 0x3fffe9, 0x1fffe7, 0x1fffe8, 0x7ffff3,	/* 224 */
+	0x3fffea, 0x3fffeb, 0x1ffffee, 0x1ffffef, 0xfffff4, 0xfffff5, 0x3ffffea, 0x7ffff4,	/* 232 */
+	0x3ffffeb, 0x7ffffe6, 0x3ffffec, 0x3ffffed, 0x7ffffe7, 0x7ffffe8, 0x7ffffe9, 0x7ffffea,	/* 240 */
+	0x7ffffeb, 0xffffffe, 0x7ffffec, 0x7ffffed, 0x7ffffee, 0x7ffffef, 0x7fffff0, 0x3ffffee,	/* 248 */
+	0x3fffffff	/* 256 */
+};
+
+const uint8_t http2_huffman_code_lengths[257] = {
+	13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28,	/* 0 */
+	28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,	/* 16 */
+	6, 10, 10, 12, 13, 6, 8, 11, 10, 10, 8, 11, 8, 6, 6, 6,	/* 32 */
+	5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 15, 6, 12, 10,	/* 48 */
+	13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,	/* 64 */
+	7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 13, 19, 13, 14, 6,	/* 80 */
+	15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6, 6, 5,	/* 96 */
+	6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7, 15, 11, 14, 13, 28,	/* 112 */
+	20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23,	/* 128 */
+	24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,	/* 144 */
+	22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23,	/* 160 */
+	21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,	/* 176 */
+	26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,	/* 192 */
+	19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,	/* 208 */
+	20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23,	/* 224 */
+	26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,	/* 240 */
+	30	/* 256 */
 };
@@ -0,0 +1,156 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see scheduler.h
+ */
+#include "scheduler.h"
+
+#include <string.h>
+
+h2_priority_t h2_priority_default(void) {
+	h2_priority_t priority;
+	priority.urgency = H2_PRIORITY_URGENCY_DEFAULT;
+	priority.incremental = 0;
+	return priority;
+}
+
+static int is_key_character(char c) {
+	return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '.' || c == '*';
+}
+
+/* A simplified parser of the Structured Field dictionary (RFC 8941 Section
+ * 3.2): only integers and booleans are understood, parameters are skipped. */
+void h2_priority_parse(h2_priority_t *priority, const char *value, size_t length) {
+	size_t position = 0;
+	while (position < length) {
+		while (position < length && (value[position] == ' ' || value[position] == '\t'))
+			position++;
+
+		size_t key = position;
+		while (position < length && is_key_character(value[position]))
+			position++;
+		size_t key_length = position - key;
+
+		/* a bare key is the boolean true */
+		const char *item = "?1";
+		size_t item_length = 2;
+		if (position < length && value[position] == '=') {
+			item = value + ++position;
+			while (position < length && value[position] != ';' && value[position] != ',')
+				position++;
+			item_length = value + position - item;
+		}
+		while (position < length && value[position] != ',')
+			position++;
+		position++;
+
+		while (item_length > 0 && (item[item_length - 1] == ' ' || item[item_length - 1] == '\t'))
+			item_length--;
+		if (key_length != 1)
+			continue;
+		if (value[key] == 'u' && item_length == 1 && item[0] >= '0' && item[0] <= '7')
+			priority->urgency = item[0] - '0';
+		else if (value[key] == 'i' && item_length == 2 && item[0] == '?' && (item[1] == '0' || item[1] == '1'))
+			priority->incremental = item[1] == '1';
+	}
+}
+
+h2_priority_t h2_priority_from_weight(unsigned weight) {
+	h2_priority_t priority;
+	if (weight < 1)
+		weight = 1;
+	/* the default weight has the default urgency, every doubling of the
+	 * weight is one step more urgent: 128 to 256 is 0, 64 to 127 is 1,
+	 * 32 to 63 is 2, 16 to 31 is 3, ..., 1 is 7 */
+	priority.urgency = H2_PRIORITY_URGENCY_DEFAULT + 4;
+	while (weight > 1 && priority.urgency > 0) {
+		weight >>= 1;
+		priority.urgency--;
+	}
+	priority.incremental = 1;
+	return priority;
+}
+
+void h2_scheduler_init(h2_scheduler_t *scheduler) {
+	memset(scheduler, 0, sizeof(h2_scheduler_t));
+}
+
+void h2_scheduler_add(h2_scheduler_t *scheduler, h2_scheduler_node_t *node) {
+	uint8_t urgency = node->priority.urgency;
+	node->scheduled = 1;
+	if (node->priority.incremental) {
+		node->next = NULL;
+		node->previous = scheduler->incremental_last[urgency];
+		if (node->previous)
+			node->previous->next = node;
+		else
+			scheduler->incremental[urgency] = node;
+		scheduler->incremental_last[urgency] = node;
+		return;
+	}
+
+	h2_scheduler_node_t *previous = NULL;
+	h2_scheduler_node_t *next = scheduler->sequential[urgency];
+	while (next && next->stream < node->stream) {
+		previous = next;
+		next = next->next;
+	}
+	node->previous = previous;
+	node->next = next;
+	if (previous)
+		previous->next = node;
+	else
+		scheduler->sequential[urgency] = node;
+	if (next)
+		next->previous = node;
+}
+
+void h2_scheduler_remove(h2_scheduler_t *scheduler, h2_scheduler_node_t *node) {
+	if (!node->scheduled)
+		return;
+	uint8_t urgency = node->priority.urgency;
+	h2_scheduler_node_t **first = node->priority.incremental ? &scheduler->incremental[urgency] : &scheduler->sequential[urgency];
+	if (node->previous)
+		node->previous->next = node->next;
+	else
+		*first = node->next;
+	if (node->next)
+		node->next->previous = node->previous;
+	else if (node->priority.incremental)
+		scheduler->incremental_last[urgency] = node->previous;
+	node->next = NULL;
+	node->previous = NULL;
+	node->scheduled = 0;
+}
+
+void h2_scheduler_set_priority(h2_scheduler_t *scheduler, h2_scheduler_node_t *node, h2_priority_t priority) {
+	if (node->priority.urgency == priority.urgency && node->priority.incremental == priority.incremental)
+		return;
+	int scheduled = node->scheduled;
+	h2_scheduler_remove(scheduler, node);
+	node->priority = priority;
+	if (scheduled)
+		h2_scheduler_add(scheduler, node);
+}
+
+h2_scheduler_node_t *h2_scheduler_next(h2_scheduler_t *scheduler, int (*can_send)(h2_scheduler_node_t *, void *), void *data) {
+	size_t urgency;
+	h2_scheduler_node_t *node;
+	for (urgency = 0; urgency < H2_PRIORITY_URGENCY_COUNT; urgency++) {
+		for (node = scheduler->sequential[urgency]; node; node = node->next)
+			if (can_send(node, data))
+				return node;
+		for (node = scheduler->incremental[urgency]; node; node = node->next)
+			if (can_send(node, data))
+				return node;
+	}
+	return NULL;
+}
+
+void h2_scheduler_sent(h2_scheduler_t *scheduler, h2_scheduler_node_t *node) {
+	if (!node->scheduled || !node->priority.incremental || !node->next)
+		return;
+	h2_scheduler_remove(scheduler, node);
+	h2_scheduler_add(scheduler, node);
+}
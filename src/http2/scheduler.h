@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the scheduler that decides which stream of a connection
+ * sends the next DATA frame, using the extensible priorities of RFC 9218: the
+ * streams with the lowest urgency go first, non-incremental streams are sent
+ * one after another in the order of their identifiers, and incremental streams
+ * take turns.
+ */
+#ifndef HTTP2_SCHEDULER_H
+#define HTTP2_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define H2_PRIORITY_URGENCY_COUNT 8
+#define H2_PRIORITY_URGENCY_DEFAULT 3
+
+/* The default weight of RFC 7540 Section 5.3.5. */
+#define H2_PRIORITY_WEIGHT_DEFAULT 16
+
+typedef struct h2_priority_t {
+	/* 0 (the most urgent) to 7 */
+	uint8_t urgency;
+	/* (boolean) the response is useful while it is received, e.g. an image */
+	uint8_t incremental;
+} h2_priority_t;
+
+typedef struct h2_scheduler_node_t {
+	struct h2_scheduler_node_t *next;
+	struct h2_scheduler_node_t *previous;
+	uint32_t stream;
+	h2_priority_t priority;
+	/* (boolean) the node is in the scheduler */
+	int scheduled;
+	/* the owner of the node, e.g. the task of the stream */
+	void *data;
+} h2_scheduler_node_t;
+
+typedef struct h2_scheduler_t {
+	/* per urgency, the non-incremental streams by identifier */
+	h2_scheduler_node_t *sequential[H2_PRIORITY_URGENCY_COUNT];
+	/* per urgency, the incremental streams in the order of their turns */
+	h2_scheduler_node_t *incremental[H2_PRIORITY_URGENCY_COUNT];
+	h2_scheduler_node_t *incremental_last[H2_PRIORITY_URGENCY_COUNT];
+} h2_scheduler_t;
+
+/**
+ * Description:
+ *   Returns the default priority: urgency 3, not incremental.
+ */
+h2_priority_t h2_priority_default(void);
+
+/**
+ * Description:
+ *   Parses a Priority Field Value (RFC 9218 Section 4), the value of the
+ *   'priority' header or of a PRIORITY_UPDATE frame, e.g. "u=1, i". Keys that
+ *   are unknown or have invalid values are ignored, so they keep the value
+ *   they had in 'priority'.
+ *
+ * Parameters:
+ *   h2_priority_t *
+ *     The priority to update.
+ *   const char *
+ *     The value, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the value.
+ */
+void h2_priority_parse(h2_priority_t *, const char *, size_t);
+
+/**
+ * Description:
+ *   Converts a weight of RFC 7540 Section 5.3, for clients that don't send
+ *   extensible priorities. The default weight gets the default urgency and
+ *   every doubling of the weight is one step more urgent, so weight 16 is
+ *   urgency 3 and 128 and up is urgency 0. The streams are incremental, since RFC 7540 shares the connection between
+ *   streams of the same weight.
+ *
+ * Parameters:
+ *   unsigned
+ *     The weight, 1 to 256.
+ */
+h2_priority_t h2_priority_from_weight(unsigned);
+
+/**
+ * Description:
+ *   Initializes an empty scheduler.
+ */
+void h2_scheduler_init(h2_scheduler_t *);
+
+/**
+ * Description:
+ *   Adds a stream to the scheduler, with the priority of the node.
+ *
+ * Parameters:
+ *   h2_scheduler_t *
+ *     The scheduler.
+ *   h2_scheduler_node_t *
+ *     The node of the stream, 'stream', 'priority' and 'data' should be set.
+ */
+void h2_scheduler_add(h2_scheduler_t *, h2_scheduler_node_t *);
+
+/**
+ * Description:
+ *   Removes a stream from the scheduler, nothing happens when it wasn't added.
+ */
+void h2_scheduler_remove(h2_scheduler_t *, h2_scheduler_node_t *);
+
+/**
+ * Description:
+ *   Changes the priority of a stream, e.g. after a PRIORITY_UPDATE frame. A
+ *   stream that changes urgency or incrementalness loses its turn.
+ */
+void h2_scheduler_set_priority(h2_scheduler_t *, h2_scheduler_node_t *, h2_priority_t);
+
+/**
+ * Description:
+ *   Chooses the stream that sends next, among the streams that can send.
+ *
+ * Parameters:
+ *   h2_scheduler_t *
+ *     The scheduler.
+ *   int (*)(h2_scheduler_node_t *, void *)
+ *     (boolean) the stream can send, e.g. it has data queued and window left.
+ *   void *
+ *     Passed to the function.
+ *
+ * Return Value:
+ *   The node of the stream, or NULL if no stream can send.
+ */
+h2_scheduler_node_t *h2_scheduler_next(h2_scheduler_t *, int (*)(h2_scheduler_node_t *, void *), void *);
+
+/**
+ * Description:
+ *   Tells the scheduler that the stream has sent a frame: an incremental
+ *   stream moves to the end of its turns.
+ */
+void h2_scheduler_sent(h2_scheduler_t *, h2_scheduler_node_t *);
+
+#endif /* HTTP2_SCHEDULER_H */
@@ -2,81 +2,80 @@
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
  */
+#include "static_table.h"
 
 #include <stddef.h>
 
-/**
- * Some padding so the static table is easier to travers as a human xd
- */
+#define ENTRY(name, value) { name, value, sizeof(name) - 1, sizeof(value) - 1 }
 
 /**
  * Definition:
  *   Appendix A. Static Table Definition
  *
  * Notes:
- *	 Header fields with values are seperated by a '$' character, a.k.a DOLLAR_SIGN.
+ *   The entries without a value have an empty value, index 0 isn't used.
  */
-const char *static_table[] = {
-	NULL,
-	":authority",
-	":method$GET",
-	":method$POST",
-	":path$/",
-	":path$/index.html",
-	":scheme$http",
-	":scheme$https",
-	":status$200",
-	":status$204",
-	":status$206",
-	":status$304",
-	":status$400",
-	":status$404",
-	":status$500",
-	"accept-charset",
-	"accept-encoding$gzip, deflate",
-	"accept-language",
-	"accept-ranges",
-	"accept",
-	"access-control-allow-origin",
-	"age",
-	"allow",
-	"authorization",
-	"cache-control",
-	"content-disposition",
-	"content-encoding",
-	"content-language",
-	"content-length",
-	"content-location",
-	"content-range",
-	"content-type",
-	"cookie",
-	"date",
-	"etag",
-	"expect",
-	"expires",
-	"from",
-	"host",
-	"if-match",
-	"if-modified-since",
-	"if-none-match",
-	"if-range",
-	"if-unmodified-since",
-	"last-modified",
-	"link",
-	"location",
-	"max-forwards",
-	"proxy-authenticate",
-	"proxy-authorization",
-	"range",
-	"referer",
-	"refresh",
-	"retry-after",
-	"server",
-	"set-cookie",
-	"strict-transport-security",
-	"transfer-encoding",
-	"user-agent",
-	"vary",
-	"via",
-	"www-authenticate"
-}; 
+const static_table_entry_t static_table[HTTP2_STATIC_TABLE_SIZE] = {
+	{ NULL, NULL, 0, 0 },
+	ENTRY(":authority", ""),
+	ENTRY(":method", "GET"),
+	ENTRY(":method", "POST"),
+	ENTRY(":path", "/"),
+	ENTRY(":path", "/index.html"),
+	ENTRY(":scheme", "http"),
+	ENTRY(":scheme", "https"),
+	ENTRY(":status", "200"),
+	ENTRY(":status", "204"),
+	ENTRY(":status", "206"),
+	ENTRY(":status", "304"),
+	ENTRY(":status", "400"),
+	ENTRY(":status", "404"),
+	ENTRY(":status", "500"),
+	ENTRY("accept-charset", ""),
+	ENTRY("accept-encoding", "gzip, deflate"),
+	ENTRY("accept-language", ""),
+	ENTRY("accept-ranges", ""),
+	ENTRY("accept", ""),
+	ENTRY("access-control-allow-origin", ""),
+	ENTRY("age", ""),
+	ENTRY("allow", ""),
+	ENTRY("authorization", ""),
+	ENTRY("cache-control", ""),
+	ENTRY("content-disposition", ""),
+	ENTRY("content-encoding", ""),
+	ENTRY("content-language", ""),
+	ENTRY("content-length", ""),
+	ENTRY("content-location", ""),
+	ENTRY("content-range", ""),
+	ENTRY("content-type", ""),
+	ENTRY("cookie", ""),
+	ENTRY("date", ""),
+	ENTRY("etag", ""),
+	ENTRY("expect", ""),
+	ENTRY("expires", ""),
+	ENTRY("from", ""),
+	ENTRY("host", ""),
+	ENTRY("if-match", ""),
+	ENTRY("if-modified-since", ""),
+	ENTRY("if-none-match", ""),
+	ENTRY("if-range", ""),
+	ENTRY("if-unmodified-since", ""),
+	ENTRY("last-modified", ""),
+	ENTRY("link", ""),
+	ENTRY("location", ""),
+	ENTRY("max-forwards", ""),
+	ENTRY("proxy-authenticate", ""),
+	ENTRY("proxy-authorization", ""),
+	ENTRY("range", ""),
+	ENTRY("referer", ""),
+	ENTRY("refresh", ""),
+	ENTRY("retry-after", ""),
+	ENTRY("server", ""),
+	ENTRY("set-cookie", ""),
+	ENTRY("strict-transport-security", ""),
+	ENTRY("transfer-encoding", ""),
+	ENTRY("user-agent", ""),
+	ENTRY("vary", ""),
+	ENTRY("via", ""),
+	ENTRY("www-authenticate", "")
+};
@@ -5,7 +5,17 @@
 #ifndef HTTP2_STATIC_TABLE_H
 #define HTTP2_STATIC_TABLE_H
 
-#define HTTP2_STATIC_TABLE_SIZE 62 
-extern const char *static_table[];
+#include <stddef.h>
+
+#define HTTP2_STATIC_TABLE_SIZE 62
+
+typedef struct {
+	const char *name;
+	const char *value;
+	size_t name_length;
+	size_t value_length;
+} static_table_entry_t;
+
+extern const static_table_entry_t static_table[HTTP2_STATIC_TABLE_SIZE];
 
 #endif /* HTTP2_STATIC_TABLE_H */
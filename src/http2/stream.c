@@ -6,15 +6,97 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#define STREAM_ID_MASK 0x7FFFFFFF
+
+/* the slot a stream belongs in, the identifiers of a peer go up by two */
+static uint32_t home(h2stream_list_t *list, uint32_t id) {
+	return (id >> 1) & (list->size - 1);
+}
+
+/* the slot of the stream, or of the empty slot where it belongs */
+static uint32_t find(h2stream_list_t *list, uint32_t id) {
+	uint32_t i = home(list, id);
+	while (list->streams[i] && list->streams[i]->id != id)
+		i = (i + 1) & (list->size - 1);
+	return i;
+}
+
+/* (boolean) doubles the capacity of the table */
+static int grow(h2stream_list_t *list) {
+	h2stream_t **old = list->streams;
+	uint32_t old_size = list->size;
+	h2stream_t **streams = calloc(old_size * 2, sizeof(h2stream_t *));
+	if (!streams)
+		return 0;
+
+	list->streams = streams;
+	list->size = old_size * 2;
+	uint32_t i;
+	for (i = 0; i < old_size; i++)
+		if (old[i])
+			list->streams[find(list, old[i]->id)] = old[i];
+	free(old);
+	return 1;
+}
+
+/* takes a stream from the pool, allocating a new block when it's empty */
+static h2stream_t *allocate(h2stream_list_t *list) {
+	if (!list->pool) {
+		h2stream_t **blocks = realloc(list->blocks, (list->block_count + 1) * sizeof(h2stream_t *));
+		if (!blocks)
+			return NULL;
+		list->blocks = blocks;
+
+		h2stream_t *block = malloc(STREAM_LIST_POOL_STEP_SIZE * sizeof(h2stream_t));
+		if (!block)
+			return NULL;
+		list->blocks[list->block_count++] = block;
+
+		size_t i;
+		for (i = 0; i < STREAM_LIST_POOL_STEP_SIZE; i++) {
+			block[i].next = list->pool;
+			list->pool = &block[i];
+		}
+	}
+
+	h2stream_t *stream = list->pool;
+	list->pool = stream->next;
+	return stream;
+}
+
+/* removes the stream in the slot, the streams after it are moved back so
+ * every stream can still be found from its home slot */
+static void remove_slot(h2stream_list_t *list, uint32_t i) {
+	h2stream_t *stream = list->streams[i];
+	stream->next = list->pool;
+	list->pool = stream;
+	list->count -= 1;
+
+	uint32_t mask = list->size - 1;
+	uint32_t j = i;
+	for (;;) {
+		j = (j + 1) & mask;
+		if (!list->streams[j])
+			break;
+		uint32_t k = home(list, list->streams[j]->id);
+		/* the stream in slot j can move to slot i if its home isn't in (i, j] */
+		if ((i < j && (k <= i || k > j)) || (i > j && k <= i && k > j)) {
+			list->streams[i] = list->streams[j];
+			i = j;
+		}
+	}
+	list->streams[i] = NULL;
+}
 
 h2stream_list_t *h2stream_list_create(uint32_t max_size) {
-	h2stream_list_t *list = malloc(sizeof(h2stream_list_t));
+	h2stream_list_t *list = calloc(1, sizeof(h2stream_list_t));
 	if (!list)
 		return NULL;
-	list->count = 0;
 	list->max = max_size;
-	list->size = STREAM_LIST_STEP_SIZE;
-	list->streams = malloc(STREAM_LIST_STEP_SIZE * sizeof(h2stream_t *));
+	list->size = STREAM_LIST_INITIAL_CAPACITY;
+	list->streams = calloc(STREAM_LIST_INITIAL_CAPACITY, sizeof(h2stream_t *));
 	if (!list->streams) {
 		free(list);
 		return NULL;
@@ -22,8 +104,7 @@ h2stream_list_t *h2stream_list_create(uint32_t max_size) {
 
 	/* set stream with id 0x0 to "open" */
 	if (!h2stream_set_state(list, 0x0, H2_STREAM_OPEN)) {
-		free(list->streams);
-		free(list);
+		h2stream_list_destroy(list);
 		return NULL;
 	}
 	return list;
@@ -32,12 +113,13 @@ h2stream_list_t *h2stream_list_create(uint32_t max_size) {
 void h2stream_list_destroy(h2stream_list_t *list) {
 	if (!list)
 		return;
-	
+
 	size_t i;
-	for (i = 0; i < list->count; i++) {
-		free(list->streams[i]);
+	for (i = 0; i < list->block_count; i++) {
+		free(list->blocks[i]);
 	}
-	
+
+	free(list->blocks);
 	free(list->streams);
 	free(list);
 }
@@ -45,54 +127,87 @@ void h2stream_list_destroy(h2stream_list_t *list) {
 h2stream_t *h2stream_get(h2stream_list_t *list, uint32_t id) {
 	if (!list)
 		return NULL;
-	
-	size_t i;
-	for (i = 0; i < list->count; i++) {
-		if (list->streams[i] && list->streams[i]->id == id)
-			return list->streams[i];
-	}
-	
-	if (list->count == list->size) {
-		h2stream_t **streams = realloc(list->streams, (list->size + STREAM_LIST_STEP_SIZE) * sizeof(h2stream_t *));
-		
-		if (!streams)
+
+	id &= STREAM_ID_MASK;
+	uint32_t i = find(list, id);
+	if (list->streams[i])
+		return list->streams[i];
+
+	/* a stream that was used before, but isn't in the table, is closed */
+	if (id != 0 && id <= list->highest[id & 1])
+		return NULL;
+	if (list->count >= list->max)
+		return NULL;
+	if ((list->count + 1) * 2 > list->size) {
+		if (!grow(list))
 			return NULL;
-		
-		list->size += STREAM_LIST_STEP_SIZE;
-		list->streams = streams;
+		i = find(list, id);
 	}
-	
-	h2stream_t *stream = malloc(sizeof(h2stream_t));
+
+	h2stream_t *stream = allocate(list);
+	if (!stream)
+		return NULL;
 	stream->id = id;
 	/**
-	 * If this the following 'wrong', use h2stream_set_state 
+	 * If this the following 'wrong', use h2stream_set_state
 	 * instead, as that function uses this function.
 	 */
 	stream->state = H2_STREAM_IDLE;
-	list->streams[list->count++] = stream;
-	
+	stream->next = NULL;
+	list->streams[i] = stream;
+	list->count += 1;
+	list->highest[id & 1] = id;
+
 	return stream;
 }
 
 h2stream_state_t h2stream_get_state(h2stream_list_t *list, uint32_t id) {
 	if (!list)
 		return H2_STREAM_UNKNOWN_STATE;
-	
-	size_t i;
-	for (i = 0; i < list->count; i++) {
-		if (list->streams[i] && list->streams[i]->id == id)
-			return list->streams[i]->state;
-	}
-	
-	return H2_STREAM_IDLE;
+
+	id &= STREAM_ID_MASK;
+	h2stream_t *stream = list->streams[find(list, id)];
+	if (stream)
+		return stream->state;
+
+	return id != 0 && id <= list->highest[id & 1] ? H2_STREAM_CLOSED_STATE : H2_STREAM_IDLE;
 }
 
 int h2stream_set_state(h2stream_list_t *list, uint32_t id, h2stream_state_t state) {
+	if (!list)
+		return 0;
+
+	id &= STREAM_ID_MASK;
+	if (state == H2_STREAM_CLOSED_STATE) {
+		uint32_t i = find(list, id);
+		if (list->streams[i])
+			remove_slot(list, i);
+		else if (id != 0 && id <= list->highest[id & 1])
+			return 1;
+		if (id > list->highest[id & 1])
+			list->highest[id & 1] = id;
+		list->recently_closed[list->recently_closed_position] = id;
+		list->recently_closed_position = (list->recently_closed_position + 1) % STREAM_LIST_RECENTLY_CLOSED;
+		return 1;
+	}
+
 	h2stream_t *stream = h2stream_get(list, id);
-	
+
 	if (!stream)
 		return 0;
-	
+
 	stream->state = state;
 	return 1;
-}
\ No newline at end of file
+}
+
+int h2stream_recently_closed(h2stream_list_t *list, uint32_t id) {
+	id &= STREAM_ID_MASK;
+	if (id == 0 || h2stream_get_state(list, id) != H2_STREAM_CLOSED_STATE)
+		return 0;
+
+	size_t i;
+	for (i = 0; i < STREAM_LIST_RECENTLY_CLOSED; i++)
+		if (list->recently_closed[i] == id)
+			return 1;
+	return 0;
+}
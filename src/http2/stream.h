@@ -5,9 +5,16 @@
 #ifndef STREAM_H
 #define STREAM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
-#define STREAM_LIST_STEP_SIZE 4
+/* The initial capacity of the table of open streams, a power of two. */
+#define STREAM_LIST_INITIAL_CAPACITY 16
+/* The amount of streams that is allocated at once. */
+#define STREAM_LIST_POOL_STEP_SIZE 16
+/* The amount of closed stream identifiers that are remembered, see
+ * h2stream_recently_closed. */
+#define STREAM_LIST_RECENTLY_CLOSED 64
 
 typedef enum {
 	/* IDLE streams shouldn't really exists in code, 
@@ -22,16 +29,35 @@ typedef enum {
 	H2_STREAM_UNKNOWN_STATE = 0x7
 } h2stream_state_t;
 
-typedef struct {
+typedef struct h2stream_t {
 	uint32_t id;
 	h2stream_state_t state;
+	/* the next free stream in the pool */
+	struct h2stream_t *next;
 } h2stream_t;
 
+/* The streams that aren't idle or closed are in a hash table, with open
+ * addressing. A closed stream is removed and its memory is reused: since the
+ * identifiers of new streams have to increase (RFC 7540 Section 5.1.1), a
+ * stream that isn't in the table is idle when its identifier is larger than
+ * that of every stream that was opened before it, and closed otherwise. */
 typedef struct {
 	uint32_t count;
 	uint32_t max;
+	/* the capacity of 'streams', a power of two */
 	uint32_t size;
 	h2stream_t **streams;
+	/* the largest identifiers that were used, of the even (server) and odd
+	 * (client) streams */
+	uint32_t highest[2];
+	/* the streams that aren't used */
+	h2stream_t *pool;
+	/* the blocks the streams were allocated in */
+	h2stream_t **blocks;
+	size_t block_count;
+	/* a ring of the identifiers of the streams that were closed last */
+	uint32_t recently_closed[STREAM_LIST_RECENTLY_CLOSED];
+	size_t recently_closed_position;
 } h2stream_list_t;
 
 /**
@@ -76,12 +102,9 @@ void h2stream_list_destroy(h2stream_list_t *);
  *    The stream, or NULL if one of the following conditions are 
  *    met:
  *      1. The list is invalid.
- *      2. The stream is invalid (the functionality of these 
- *         functions is ill-implemented. This is generally 
- *         the fault of the callee or its neighboring functions.
- *      3. The identifier is outside the maximum size 
- *         boundaries.
- *      4. An I/O error has occurred.
+ *      2. The stream is closed.
+ *      3. The maximum amount of streams is open.
+ *      4. An allocation error has occurred.
  */
 h2stream_t *h2stream_get(h2stream_list_t *, uint32_t);
 
@@ -120,9 +143,27 @@ h2stream_state_t h2stream_get_state(h2stream_list_t *, uint32_t);
  * 
  *  Return Value:
  *    (boolean) Success status. This function fails
- *    when the stream identifier is outside the maximum
- *    size boundaries.
+ *    when the stream can't be opened, see h2stream_get.
+ *    A stream that is closed is removed from the list.
  */
 int h2stream_set_state(h2stream_list_t *, uint32_t, h2stream_state_t);
 
+/**
+ * Description:
+ *   Checks whether a stream is one of the last STREAM_LIST_RECENTLY_CLOSED
+ *   streams that were closed. The client may still send WINDOW_UPDATE,
+ *   RST_STREAM and DATA frames on those, since they were in flight when the
+ *   stream was closed (RFC 7540 Section 5.1).
+ * 
+ * Parameters:
+ *   h2stream_list_t *
+ *     The list of streams.
+ *   uint32_t
+ *     The stream identifier.
+ * 
+ *  Return Value:
+ *    (boolean) the stream was closed recently
+ */
+int h2stream_recently_closed(h2stream_list_t *, uint32_t);
+
 #endif /* STREAM_H */
@@ -18,15 +18,19 @@
 #include "client.h"
 #include "configuration/config.h"
 #include "handling/handlers.h"
+#include "http/common.h"
 #include "http/header_parser.h"
 #include "http/http1.h"
 #include "http/parser.h"
+#include "http/response_serializer.h"
 #include "http2/core.h"
+#include "http2/hpack_encoder.h"
 #include "secure/tlsutil.h"
 #include "server.h"
 #include "utils/encoders.h"
 #include "utils/fileutil.h"
 #include "utils/io.h"
+#include "utils/mime.h"
 #include "utils/threads.h"
 #include "utils/util.h"
 
@@ -60,6 +64,8 @@ static void catch_signal(int signo, siginfo_t *info, void *context) {
 	if (signo == SIGINT && socket_initialized) {
 		GLOBAL_SETTINGS_cancel_requested = 1;
 		close(sock);
+	} else if (signo == SIGHUP) {
+		GLOBAL_SETTINGS_reload_requested = 1;
 	}
 }
 
@@ -71,7 +77,7 @@ int main(int argc, char **argv) {
 	act.sa_sigaction = catch_signal;
 	act.sa_flags = SA_SIGINFO;
 
-	if (sigaction(SIGINT, &act, NULL) == -1 || sigaction(SIGPIPE, &act, NULL) == -1) {
+	if (sigaction(SIGINT, &act, NULL) == -1 || sigaction(SIGPIPE, &act, NULL) == -1 || sigaction(SIGHUP, &act, NULL) == -1) {
 		fputs("Failed to set signal handler!\n", stderr);
 		perror("info");
 		exit(EXIT_FAILURE);
@@ -110,6 +116,26 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 
+	if (!mime_setup(config_get(config, "mime-types"))) {
+		fputs("Failed to setup MIME types!\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	if (!http1_serializer_setup()) {
+		fputs("Failed to setup HTTP/1.1 response serializer!\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	if (!hpack_encoder_setup()) {
+		fputs("Failed to setup HPACK encoder!\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	if (!http_error_responses_setup()) {
+		fputs("Failed to setup HTTP error responses!\n", stderr);
+		return EXIT_FAILURE;
+	}
+
 	/** static configuration options: **/
 	http_headers_strict = config_get_bool(config, "headers-strict", 0);
 	http_host_strict = config_get_bool(config, "hostname-strict", 0);
@@ -122,24 +148,34 @@ int main(int argc, char **argv) {
 	}
 	
 	/** secure configuration options: **/
-	secure_config_t *sconfig;
-	const char *tls_mode_options[] = { "letsencrypt", "manual" };
-	switch (strswitch(config_get(config, "tls-mode"), tls_mode_options, sizeof(tls_mode_options)/sizeof(tls_mode_options[0]), CASEFLAG_IGNORE_A)) {
-		case 0:
-			sconfig = secure_config_letsencrypt();
-			break;
-		default:
-			printf("[Config] Encountered invalid TLS mode! Value='%s'\n", config_get(config, "tls-mode"));
-		case 1:
-			sconfig = secure_config_manual(config);
-			break;
-	}
-	
-	if (!secure_config_others(config, sconfig)) {
-		puts("Secure config failure.");
-		free(sconfig);
-		config_destroy(config);
-		return EXIT_FAILURE;
+	secure_config_t *sconfig = NULL;
+	if (GLOBAL_SETTING_cleartext) {
+		puts("[Config] Using the cleartext transport, TLS is disabled.");
+	} else {
+		const char *tls_mode_options[] = { "letsencrypt", "manual" };
+		switch (strswitch(config_get(config, "tls-mode"), tls_mode_options, sizeof(tls_mode_options)/sizeof(tls_mode_options[0]), CASEFLAG_IGNORE_A)) {
+			case 0:
+				sconfig = secure_config_letsencrypt();
+				break;
+			default:
+				printf("[Config] Encountered invalid TLS mode! Value='%s'\n", config_get(config, "tls-mode"));
+			case 1:
+				sconfig = secure_config_manual(config);
+				break;
+		}
+
+		if (!sconfig) {
+			puts("Secure config failure.");
+			config_destroy(config);
+			return EXIT_FAILURE;
+		}
+
+		if (!secure_config_others(config, sconfig)) {
+			puts("Secure config failure.");
+			secure_config_destroy(sconfig);
+			config_destroy(config);
+			return EXIT_FAILURE;
+		}
 	}
 	
 	/* Request log type: */
@@ -162,13 +198,17 @@ int main(int argc, char **argv) {
 		fputs("\x1b[33m[Config] Warning: request log type not defined, setting to default: verbose\x1b[0m\n", stderr);
 	}
 
-	tls_setup(sconfig);
+	if (sconfig && !tls_setup(sconfig)) {
+		fputs("[Secure] Failed to setup TLS!\n", stderr);
+		secure_config_destroy(sconfig);
+		config_destroy(config);
+		return EXIT_FAILURE;
+	}
 	
 	sock = server_create_socket((uint16_t)strtoul(config_get(config, "port"), NULL, 0));
 	socket_initialized = 1;
 	
-	/* post-init: */
-	free(sconfig);
+	/* post-init: (sconfig is kept for reloading the certificates) */
 	config_destroy(config);
 	
 	/* This new line character is intentional ;) */
@@ -179,9 +219,15 @@ int main(int argc, char **argv) {
 	while(!GLOBAL_SETTINGS_cancel_requested) {
 		struct sockaddr_in addr;
 
+		if (GLOBAL_SETTINGS_reload_requested) {
+			GLOBAL_SETTINGS_reload_requested = 0;
+			if (sconfig)
+				tls_reload(sconfig);
+		}
+
 		int client = accept(sock, (struct sockaddr*)&addr, &len);
 		if (client < 0) {
-			if (errno == EWOULDBLOCK || errno == EAGAIN) {
+			if (errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR) {
 				threads_yield_thread();
 				continue;
 			}
@@ -200,10 +246,17 @@ int main(int argc, char **argv) {
 	thread_manager_wait_or_kill();
 	handle_destroy();
 	close(sock);
-	tls_destroy();
+	if (sconfig) {
+		tls_destroy();
+		secure_config_destroy(sconfig);
+	}
 	GLOBAL_SETTINGS_destroy();
 	encoder_destroy();
 	http_header_parser_destroy();
+	http_error_responses_destroy();
+	http1_serializer_destroy();
+	hpack_encoder_cleanup();
+	mime_destroy();
 	http2_destroy();
 
 	puts("Successfully stopped server.");
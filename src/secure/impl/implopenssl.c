@@ -2,24 +2,62 @@
  * Copyright (C) 2019-2020 Tristan
  * For conditions of distribution and use, see copyright notice in the COPYING file.
  */
+/* for clock_gettime */
+#define _POSIX_C_SOURCE 200809L
+
 #include "../tlsutil.h"
 
+#include <errno.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <poll.h>
 #include <string.h>
+#include <time.h>
 
 #include "base/global_settings.h"
+#include "utils/util.h"
 
 BIO *bio_err = NULL;
 
 #include "ossl-ocsp.c"
-
-ocsp_data_t ocsp_data = { 0 };
+#include "ossl-sni.c"
+#include "ossl-certcomp.c"
 
 /*#define LOG_ALPNS*/
 
-SSL_CTX *ctx;
+/* The maximum plaintext size of a TLS record. */
+#define TLS_RECORD_SIZE_MAX 16384
+
+/* Dynamic record sizing, see 'secure_config_t' */
+static size_t record_size_small = TLS_RECORD_SIZE_MAX;
+static size_t record_boost_threshold = 0;
+static unsigned long record_idle_timeout = 0;
+
+/* TLS 1.3 early data, see 'secure_config_t' */
+static size_t early_data_max = 0;
+static size_t early_data_window = 0;
+
+/* This is what the 'TLS' handle points to. */
+typedef struct tls_client_t {
+	SSL *ssl;
+	/* the store the SSL object is returned to */
+	tls_store_t *store;
+	/* the amount of bytes written since the connection was new or idle */
+	size_t record_bytes_sent;
+	/* the time of the last write, in milliseconds */
+	unsigned long record_last_write;
+
+	/* (boolean) the handshake hasn't completed yet, reads return TLS 1.3 early data */
+	int early;
+	/* the early data read during the handshake, but not yet by the application */
+	char early_buffer[TLS_RECORD_SIZE_MAX];
+	size_t early_position;
+	size_t early_length;
+
+	/* (boolean) a fatal error occurred, the connection can't be shut down cleanly */
+	int failed;
+} tls_client_t;
+
 typedef const unsigned char *cucp;
 const unsigned char alpn_h1[] = "http/1.1";
 const unsigned char alpn_h2[] = "h2";
@@ -38,7 +76,7 @@ int comp(cucp a, cucp b, size_t len) {
 TLS_AP tls_get_ap(TLS tls) {
 	cucp dat;
 	uint32_t len;
-	SSL_get0_alpn_selected((SSL *)tls, &dat, &len);
+	SSL_get0_alpn_selected(((tls_client_t *) tls)->ssl, &dat, &len);
 	
 	/* if dat == null, alpn wasn't performed, so just use HTTP/1.1 */
 	if (!dat)
@@ -118,66 +156,34 @@ static int alpn_handle (SSL *ssl, const unsigned char **out, unsigned char *outl
 	return SSL_TLSEXT_ERR_OK;
 }
 
-int tls_setup(secure_config_t *sconfig) {
-	SSL_load_error_strings();
-	OpenSSL_add_ssl_algorithms();
-	
-	bio_err = BIO_new(BIO_s_file());
-	BIO_set_fp(bio_err, stderr, 0);
-
-	const SSL_METHOD *method;
-
-	method =  SSLv23_server_method();
+/* Only accept early data for tickets issued within the window, older tickets are resumed without it. */
+static int early_data_allow(SSL *ssl, void *arg) {
+	SSL_SESSION *session = SSL_get0_session(ssl);
+	return session && time(NULL) - SSL_SESSION_get_time(session) <= (long) early_data_window;
+}
 
-	ctx = SSL_CTX_new(method);
+/* Creates a context with the shared settings, but without certificates. */
+static SSL_CTX *create_context(secure_config_t *sconfig, tls_store_t *store) {
+	SSL_CTX *ctx = SSL_CTX_new(SSLv23_server_method());
 	if (!ctx) {
 		perror("Unable to create SSL context");
 		ERR_print_errors_fp(stderr);
-		return 0;
+		return NULL;
 	}
 
 	SSL_CTX_set_ecdh_auto(ctx, 1);
 
-	/* Set the key and cert */
-	if (SSL_CTX_use_certificate_file(ctx, sconfig->cert, SSL_FILETYPE_PEM) <= 0) {
-		ERR_print_errors_fp(stderr);
-		return 0;
-	}
-	
-	if (sconfig->chain) {
-		FILE *file = fopen(sconfig->chain, "r");
-		X509 *cert = PEM_read_X509(file, NULL, 0, NULL);
-		fclose(file);
-		if (!SSL_CTX_add_extra_chain_cert(ctx, cert)) {
-			puts("Failed to load certificate chain :(");
-			ERR_print_errors_fp(stderr);
-			return 0;
-		}
-	}
+	/* Prefer our cipher order, so ECDSA is used when the client supports it.
+	 * Renegotiation is disabled because the store is only referenced during
+	 * the initial handshake. */
+	SSL_CTX_set_options(ctx, SSL_OP_CIPHER_SERVER_PREFERENCE | SSL_OP_NO_RENEGOTIATION);
 
-	if (SSL_CTX_use_PrivateKey_file(ctx, sconfig->key, SSL_FILETYPE_PEM) <= 0) {
-		ERR_print_errors_fp(stderr);
-		return 0;
-	}
-
-	if (sconfig->chain) {
-		BIO *bio = BIO_new(BIO_s_file());
-		X509 *cert = X509_new();
-		if (!BIO_read_filename(bio, sconfig->chain))
-			perror("chain read failure");
-		
-		PEM_read_bio_X509(bio, &cert, 0, NULL);
+	/* free the read and write buffers of idle connections */
+	SSL_CTX_set_mode(ctx, SSL_MODE_RELEASE_BUFFERS);
 
-		if (!cert) {
-			puts("Failed to load chain");
-		}
+	/* the same for every context, so sessions can be resumed after SNI switched the context */
+	SSL_CTX_set_session_id_context(ctx, (const unsigned char *) "wss", 3);
 
-		if (bio)
-			BIO_free(bio);
-		
-		SSL_CTX_add1_chain_cert(ctx, cert);
-	}
-	
 	if (sconfig->min_protocol_version != PROTOCOL_NULL) {
 		SSL_CTX_set_min_proto_version(ctx, TLS1_VERSION + sconfig->min_protocol_version);
 	}
@@ -190,39 +196,216 @@ int tls_setup(secure_config_t *sconfig) {
 		perror("[Secure] Failed to set cipher list");
 	}
 	
-	
-	/*STACK_OF(SSL_CIPHER) *stack = SSL_CTX_get_ciphers(ctx);
-	printf("%p\n", stack);
-	
-	size_t i;
-	for (i = 0; i < sk_SSL_CIPHER_num(stack); i++) {
-		const SSL_CIPHER *cipher = sk_SSL_CIPHER_value(stack, i);
-		printf("> '%s'\n", SSL_CIPHER_get_name(cipher));
-	}*/
-	
-	
 	/* set ALPN */
 	SSL_CTX_set_alpn_select_cb(ctx, alpn_handle, NULL);
+
+	/* set SNI */
+	SSL_CTX_set_tlsext_servername_callback(ctx, sni_handle);
+	SSL_CTX_set_tlsext_servername_arg(ctx, store);
+
+	if (sconfig->early_data_max > 0) {
+		SSL_CTX_set_max_early_data(ctx, sconfig->early_data_max);
+		SSL_CTX_set_recv_max_early_data(ctx, sconfig->early_data_max);
+		SSL_CTX_set_allow_early_data_cb(ctx, early_data_allow, NULL);
+		/* OpenSSL's anti-replay keeps used tickets in the session cache, so
+		 * the cache entries should live at least as long as the window. */
+		if (SSL_CTX_get_timeout(ctx) < (long) sconfig->early_data_window)
+			SSL_CTX_set_timeout(ctx, sconfig->early_data_window);
+	}
+
+	return ctx;
+}
+
+/* Loads the certificate into the context of its host names, or into a new context. */
+static int store_load_certificate(tls_store_t *store, secure_config_t *sconfig, secure_cert_t *entry) {
+	int success = 0;
+	X509 *cert = NULL;
+	EVP_PKEY *key = NULL;
+	STACK_OF(X509) *chain = sk_X509_new_null();
+	char *names[64];
+	size_t name_count = 0, i;
+
+	BIO *bio = BIO_new_file(entry->cert, "r");
+	if (!bio || !(cert = PEM_read_bio_X509(bio, NULL, NULL, NULL))) {
+		printf("[Secure] Failed to read certificate: '%s'\n", entry->cert);
+		goto end;
+	}
+
+	/* a "fullchain" file contains the intermediates as well */
+	X509 *intermediate;
+	while ((intermediate = PEM_read_bio_X509(bio, NULL, NULL, NULL)))
+		sk_X509_push(chain, intermediate);
+	ERR_clear_error();
+	BIO_free(bio);
+
+	bio = BIO_new_file(entry->key, "r");
+	if (!bio || !(key = PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL))) {
+		printf("[Secure] Failed to read private key: '%s'\n", entry->key);
+		goto end;
+	}
+
+	if (!X509_check_private_key(cert, key)) {
+		printf("[Secure] The private key '%s' doesn't match the certificate '%s'\n", entry->key, entry->cert);
+		goto end;
+	}
+
+	unsigned key_type = key_type_of(key);
+	name_count = certificate_names(cert, names, sizeof(names) / sizeof(names[0]));
+
+	/* find a context serving these names that doesn't have a certificate of this key type yet */
+	tls_context_t *context = NULL;
+	for (i = 0; i < name_count && !context; i++) {
+		char normalized[TLS_HOST_NAME_MAX];
+		if (store->host_count && host_normalize(normalized, names[i])) {
+			tls_host_t *host = store_find_slot(store, normalized);
+			if (host->name && !(host->context->key_types & key_type))
+				context = host->context;
+		}
+	}
+
+	if (!context) {
+		tls_context_t **contexts = realloc(store->contexts, (store->context_count + 1) * sizeof(tls_context_t *));
+		if (!contexts)
+			goto end;
+		store->contexts = contexts;
+
+		if (!(context = calloc(1, sizeof(tls_context_t))))
+			goto end;
+		if (!(context->ctx = create_context(sconfig, store))) {
+			free(context);
+			goto end;
+		}
+		store->contexts[store->context_count++] = context;
+	}
+
+	if (SSL_CTX_use_certificate(context->ctx, cert) <= 0 || SSL_CTX_use_PrivateKey(context->ctx, key) <= 0) {
+		ERR_print_errors_fp(stderr);
+		goto end;
+	}
+
+	/* the chain belongs to the certificate that was set last */
+	if (sk_X509_num(chain) > 0) {
+		for (i = 0; i < (size_t) sk_X509_num(chain); i++) {
+			if (!SSL_CTX_add1_chain_cert(context->ctx, sk_X509_value(chain, i))) {
+				ERR_print_errors_fp(stderr);
+				goto end;
+			}
+		}
+	} else if (entry->chain[0] && !load_chain_file(context->ctx, entry->chain)) {
+		puts("Failed to load certificate chain :(");
+		ERR_print_errors_fp(stderr);
+		goto end;
+	}
+
+	if (sconfig->certificate_compression)
+		certificate_compress(context->ctx, entry->cert);
+
+	context->key_types |= key_type;
+	if (!store->default_context)
+		store->default_context = context;
+
+	for (i = 0; i < name_count; i++) {
+		tls_context_t *bound = store_bind(store, names[i], context);
+		if (bound && bound != context)
+			printf("[Secure] '%s' is already served by another certificate, ignoring it for '%s'\n", names[i], entry->cert);
+	}
+
+	success = 1;
+	end:
+	for (i = 0; i < name_count; i++)
+		OPENSSL_free(names[i]);
+	if (bio)
+		BIO_free(bio);
+	sk_X509_pop_free(chain, X509_free);
+	X509_free(cert);
+	EVP_PKEY_free(key);
+	return success;
+}
+
+static tls_store_t *store_create(secure_config_t *sconfig) {
+	tls_store_t *store = calloc(1, sizeof(tls_store_t));
+	if (!store)
+		return NULL;
+	pthread_mutex_init(&store->pool_mutex, NULL);
+
+	size_t i;
+	for (i = 0; i < sconfig->cert_count; i++) {
+		if (!store_load_certificate(store, sconfig, &sconfig->certs[i])) {
+			store_destroy(store);
+			return NULL;
+		}
+	}
+
+	if (!store->default_context) {
+		puts("[Secure] No certificates configured!");
+		store_destroy(store);
+		return NULL;
+	}
 	
-	/* OCSP stapling */
+	/* OCSP stapling (this response belongs to the default certificate) */
 	if (sconfig->ocsp_file) {
-		ocsp_data.file = sconfig->ocsp_file;
+		store->ocsp.file = strdup(sconfig->ocsp_file);
 		
-		SSL_CTX_set_tlsext_status_cb(ctx, cert_status_cb);
-		SSL_CTX_set_tlsext_status_arg(ctx, &ocsp_data);
+		SSL_CTX_set_tlsext_status_cb(store->default_context->ctx, cert_status_cb);
+		SSL_CTX_set_tlsext_status_arg(store->default_context->ctx, &store->ocsp);
 		
-		if (!setup_ocsp(&ocsp_data)) {
+		if (!setup_ocsp(&store->ocsp)) {
 			puts("Failed to setup OCSP.");
 		}
 	}
+
+	printf("[Secure] Loaded %zu certificate(s) into %zu context(s) for %zu host name(s).\n", sconfig->cert_count, store->context_count, store->host_count);
+	return store;
+}
+
+static void settings_set(secure_config_t *sconfig) {
+	record_size_small = sconfig->record_size_small;
+	record_boost_threshold = sconfig->record_boost_threshold;
+	record_idle_timeout = sconfig->record_idle_timeout;
+	early_data_max = sconfig->early_data_max;
+	early_data_window = sconfig->early_data_window;
+}
+
+int tls_setup(secure_config_t *sconfig) {
+	SSL_load_error_strings();
+	OpenSSL_add_ssl_algorithms();
 	
+	bio_err = BIO_new(BIO_s_file());
+	BIO_set_fp(bio_err, stderr, 0);
+
+	tls_store_t *store = store_create(sconfig);
+	if (!store)
+		return 0;
+
+	settings_set(sconfig);
+	store_publish(store);
+	return 1;
+}
+
+int tls_reload(secure_config_t *sconfig) {
+	/* Building the new store happens on the caller's thread, without holding
+	 * the lock, so handshakes keep using the old store until the swap. */
+	tls_store_t *store = store_create(sconfig);
+	if (!store) {
+		puts("[Secure] Reload failed, keeping the current certificates.");
+		return 0;
+	}
+
+	settings_set(sconfig);
+	store_publish(store);
+	puts("[Secure] Certificates reloaded.");
 	return 1;
 }
 
 void tls_destroy(void) {
-	free(ocsp_data.file);
+	pthread_mutex_lock(&store_mutex);
+	tls_store_t *store = current_store;
+	current_store = NULL;
+	pthread_mutex_unlock(&store_mutex);
+
+	if (store)
+		store_release(store);
 	BIO_free(bio_err);
-	SSL_CTX_free(ctx);
 	EVP_cleanup();
 }
 
@@ -232,7 +415,7 @@ static int wait_for_read(int socket) {
 	poller.events = POLLIN;
 	poller.revents = 0;
 	int result;
-	while ((result = poll(&poller, 1, GLOBAL_SETTING_read_timeout)) == 0
+	while (((result = poll(&poller, 1, GLOBAL_SETTING_read_timeout)) == 0 || (result == -1 && errno == EINTR))
 		&& !GLOBAL_SETTINGS_cancel_requested) {
 		/* waiting until poll has finished, indefinitely (until GLOBAL_SETTINGS_cancel_requested is > 0). */
 	}
@@ -254,13 +437,114 @@ static const char *get_ssl_error_name(int error) {
 	}
 }
 
+static int wait_for_write(int socket) {
+	struct pollfd poller;
+	poller.fd = socket;
+	poller.events = POLLOUT;
+	poller.revents = 0;
+	int result;
+	while (((result = poll(&poller, 1, GLOBAL_SETTING_read_timeout)) == 0 || (result == -1 && errno == EINTR))
+		&& !GLOBAL_SETTINGS_cancel_requested) {
+		/* waiting until the socket has room again */
+	}
+	return result > 0;
+}
+
+/* a monotonic clock in milliseconds, used for the idle detection of dynamic record sizing */
+static unsigned long time_milliseconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000UL + now.tv_nsec / 1000000UL;
+}
+
+/* Completes the handshake, returns 0 on failure. */
+static int handshake_finish(tls_client_t *tls) {
+	SSL *ssl = tls->ssl;
+	int client = SSL_get_fd(ssl);
+
+	while (1) {
+		int ret = SSL_accept(ssl);
+		if (ret > 0)
+			break;
+
+		int error_code = SSL_get_error(ssl, ret);
+		if (error_code == SSL_ERROR_WANT_READ && wait_for_read(client))
+			continue;
+		if (error_code == SSL_ERROR_WANT_WRITE && wait_for_write(client))
+			continue;
+
+		if (error_code != SSL_ERROR_WANT_READ && error_code != SSL_ERROR_WANT_WRITE) {
+			tls->failed = 1;
+			ERR_print_errors_fp(stderr);
+			if (GLOBAL_SETTINGS_log_tls_errors)
+				printf("[TLSError] (ClientSetup) Accept error: %s or %i\n", get_ssl_error_name(error_code), error_code);
+		}
+		return 0;
+	}
+
+	tls->early = 0;
+	return 1;
+}
+
+/**
+ * Reads early data into 'buffer'. When the client has sent all of its early
+ * data (or none at all), the handshake is completed.
+ *
+ * Return Value:
+ *   The amount of bytes read, 0 when there is no (more) early data and -1 on
+ *   failure.
+ */
+static int early_data_read(tls_client_t *tls, char *buffer, size_t length) {
+	SSL *ssl = tls->ssl;
+	size_t read;
+
+	while (1) {
+		read = 0;
+		switch (SSL_read_early_data(ssl, buffer, length, &read)) {
+			case SSL_READ_EARLY_DATA_SUCCESS:
+				tls->early = 1;
+				return read;
+			case SSL_READ_EARLY_DATA_FINISH:
+				if (!SSL_is_init_finished(ssl) && !handshake_finish(tls))
+					return -1;
+				tls->early = 0;
+				return read;
+			default: {
+				int error_code = SSL_get_error(ssl, 0);
+				if (error_code == SSL_ERROR_WANT_READ && wait_for_read(SSL_get_rfd(ssl)))
+					continue;
+				if (error_code == SSL_ERROR_WANT_WRITE && wait_for_write(SSL_get_wfd(ssl)))
+					continue;
+				ERR_print_errors_fp(stderr);
+				if (GLOBAL_SETTINGS_log_tls_errors)
+					printf("[TLSError] (EarlyData) Read error: %s\n", get_ssl_error_name(error_code));
+				tls->failed = 1;
+				return -1;
+			}
+		}
+	}
+}
+
 void *tls_setup_client(int client) {
 	if (!wait_for_read(client))
 		return NULL;
 	
-	SSL *ssl = SSL_new(ctx);
+	tls_store_t *store = store_acquire();
+	if (!store)
+		return NULL;
+
+	tls_client_t *tls = calloc(1, sizeof(tls_client_t));
+	if (!tls) {
+		store_release(store);
+		return NULL;
+	}
+
+	tls->store = store;
+	SSL *ssl = tls->ssl = store_ssl_take(store);
 
 	if (!ssl) {
+		store_release(store);
+		free(tls);
 		if (GLOBAL_SETTINGS_log_tls_errors)
 			puts("[TLSError] (ClientSetup) Failed to create SSL object!");
 		return NULL;
@@ -269,54 +553,96 @@ void *tls_setup_client(int client) {
 		ERR_print_errors_fp(stderr);
 		if (GLOBAL_SETTINGS_log_tls_errors)
 			puts("[TLSError] (ClientSetup) Failed to set file descriptor!");
-		tls_destroy_client(ssl);
+		tls->failed = 1;
+		tls_destroy_client(tls);
 		return NULL;
 	}
 
-	size_t retries = 0;
-	while (1) {
-		retries++;
-		int ret = SSL_accept(ssl);
-		if (ret <= 0) {
-			int error_code = SSL_get_error(ssl, ret);
-			if (error_code == SSL_ERROR_WANT_READ) {
-				if (wait_for_read(client))
-					continue;
-				else
-					goto error_end;
-			}
-			ERR_print_errors_fp(stderr);
-			if (GLOBAL_SETTINGS_log_tls_errors)
-				printf("[TLSError] (ClientSetup) Accept error: %s or %i\n", get_ssl_error_name(error_code), error_code);
-			error_end:
-			tls_destroy_client(ssl);
-			return NULL;
-		} else break;
+	int success;
+	if (early_data_max > 0) {
+		/* This processes the ClientHello, and returns the first early data
+		 * (if any) without waiting for the client's Finished message, so a
+		 * request sent as early data can be answered a round trip sooner. */
+		int read = early_data_read(tls, tls->early_buffer, sizeof(tls->early_buffer));
+		success = read >= 0;
+		if (success)
+			tls->early_length = read;
+	} else {
+		success = handshake_finish(tls);
 	}
-	
-	return ssl;
-}
 
-void tls_destroy_client(void *ssl) {
-	char unused[1];
-	/* poll the connection */
-	if (SSL_get_error((const SSL *)ssl, SSL_read((SSL *)ssl, unused, 1)) == SSL_ERROR_NONE) {
-		SSL_shutdown((SSL *) ssl);
+	if (!success) {
+		tls_destroy_client(tls);
+		return NULL;
 	}
-	SSL_free((SSL *) ssl);
+
+	/* a new connection starts with small records */
+	tls->record_bytes_sent = 0;
+	tls->record_last_write = time_milliseconds();
+	return tls;
+}
+
+void tls_destroy_client(void *tls) {
+	tls_client_t *client = (tls_client_t *) tls;
+	char unused[256];
+
+	/* finish the handshake (the response could have been sent before it completed) */
+	while (client->early && early_data_read(client, unused, sizeof(unused)) > 0);
+
+	/* Send a close_notify. Without it, OpenSSL removes the session from the
+	 * cache, and the anti-replay of early data needs the cached session. */
+	if (SSL_is_init_finished(client->ssl) && !client->failed)
+		SSL_shutdown(client->ssl);
+	/* SSL_clear doesn't reset the early data state, SSL_read_early_data would fail on a reused object */
+	if (early_data_max > 0)
+		SSL_free(client->ssl);
+	else
+		store_ssl_give(client->store, client->ssl);
+	store_release(client->store);
+	free(client);
+}
+
+int tls_in_early_data(void *tls) {
+	return ((tls_client_t *) tls)->early;
+}
+
+int tls_pending(void *tls) {
+	tls_client_t *client = (tls_client_t *) tls;
+	return client->early_position < client->early_length || SSL_has_pending(client->ssl);
 }
 
-int tls_read_client(void *pssl, char *result, size_t length) {
+int tls_read_client(void *tls, char *result, size_t length) {
+	tls_client_t *client = (tls_client_t *) tls;
+	SSL *ssl = client->ssl;
+
+	if (client->early_position < client->early_length) {
+		size_t available = client->early_length - client->early_position;
+		if (length > available)
+			length = available;
+		memcpy(result, client->early_buffer + client->early_position, length);
+		client->early_position += length;
+		return length;
+	}
+
+	if (client->early) {
+		int read = early_data_read(client, result, length);
+		if (read != 0)
+			return read < 0 ? 0 : read;
+		/* the handshake is complete, continue with normal application data */
+	}
+
 	int resval;
-	while ((resval = SSL_read((SSL *) pssl, result, length)) <= 0) {
-		int error = SSL_get_error((const SSL *)pssl, resval);
+	while ((resval = SSL_read(ssl, result, length)) <= 0) {
+		int error = SSL_get_error((const SSL *)ssl, resval);
 		if (error == SSL_ERROR_WANT_READ) {
-			if (!wait_for_read(SSL_get_rfd((const SSL *)pssl))) {
+			if (!wait_for_read(SSL_get_rfd((const SSL *)ssl))) {
 				if (GLOBAL_SETTINGS_log_tls_errors)
 					puts("[TLSError] (Read) Poll failure");
 				return 0;
 			} else continue;
 		}
+		if (error != SSL_ERROR_ZERO_RETURN)
+			client->failed = 1;
 		if (GLOBAL_SETTINGS_log_tls_errors)
 			printf("[TLSError] (Read) Error: %s\n", get_ssl_error_name(error));
 		return 0;
@@ -324,39 +650,70 @@ int tls_read_client(void *pssl, char *result, size_t length) {
 	return resval;
 }
 
-int tls_read_client_complete(void *pssl, char *result, size_t length) {
-	int read = 0;
+int tls_read_client_complete(void *tls, char *result, size_t length) {
 	size_t bytes_read = 0;
 	
-	do {
-		read = SSL_read((SSL *) pssl, result + bytes_read, length - bytes_read);
-
-		if (read <= 0) {
-			int error = SSL_get_error((const SSL *)pssl, read);
-			
-			if (error == SSL_ERROR_WANT_READ) {
-				if (!wait_for_read(SSL_get_rfd((const SSL *)pssl))) {
-					if (GLOBAL_SETTINGS_log_tls_errors)
-						puts("[TLSError] (Read) Poll failure");
-					return 0;
-				} else continue;
-			}
-
+	while (bytes_read != length) {
+		int read = tls_read_client(tls, result + bytes_read, length - bytes_read);
+		if (read <= 0)
 			return 0;
-		}
-		read += bytes_read;
-	} while (read != length);
+		bytes_read += read;
+	}
 	
 	return 1;
 }
 
-int tls_write_client(void *pssl, const char *data, size_t length) {
-	int i = SSL_write((SSL *) pssl, data, length);
-	if (i > 0)
-		return 1;
+/* The size of the next record: small records until enough has been sent 
+ * since the connection was new or idle, full records afterwards. */
+static size_t next_record_size(tls_client_t *tls) {
+	if (record_boost_threshold == 0 || tls->record_bytes_sent >= record_boost_threshold)
+		return TLS_RECORD_SIZE_MAX;
+	return record_size_small;
+}
+
+int tls_write_client(void *tls, const char *data, size_t length) {
+	tls_client_t *client = (tls_client_t *) tls;
+	SSL *ssl = client->ssl;
 
-	if (GLOBAL_SETTINGS_log_tls_errors)
-		printf("[TLSError] (Write) Failed to write data. Code=%s ssl=%p data=%p len=%zi\n", get_ssl_error_name(SSL_get_error((const SSL *)pssl, i)), pssl, data, length);
-	ERR_print_errors_fp(stderr);
-	return 0;
+	unsigned long now = time_milliseconds();
+	if (now - client->record_last_write > record_idle_timeout) {
+		/* the congestion window has probably been reset, start small again */
+		client->record_bytes_sent = 0;
+	}
+
+	size_t position = 0;
+	while (position < length) {
+		size_t size = next_record_size(client);
+		if (size > length - position)
+			size = length - position;
+
+		/* one SSL_write of at most TLS_RECORD_SIZE_MAX bytes results in one record */
+		int i;
+		if (client->early) {
+			/* the response to early data, sent before the handshake has completed (0.5-RTT data) */
+			size_t written;
+			i = SSL_write_early_data(ssl, data + position, size, &written) ? (int) written : -1;
+		} else {
+			i = SSL_write(ssl, data + position, size);
+		}
+		if (i <= 0) {
+			int error = SSL_get_error((const SSL *)ssl, i);
+			if (error == SSL_ERROR_WANT_WRITE && wait_for_write(SSL_get_wfd(ssl)))
+				continue;
+			if (error == SSL_ERROR_WANT_READ && wait_for_read(SSL_get_rfd(ssl)))
+				continue;
+
+			client->failed = 1;
+			if (GLOBAL_SETTINGS_log_tls_errors)
+				printf("[TLSError] (Write) Failed to write data. Code=%s ssl=%p data=%p len=%zi\n", get_ssl_error_name(error), (void *) ssl, data, length);
+			ERR_print_errors_fp(stderr);
+			return 0;
+		}
+
+		position += i;
+		client->record_bytes_sent += i;
+	}
+
+	client->record_last_write = time_milliseconds();
+	return 1;
 }
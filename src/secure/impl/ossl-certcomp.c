@@ -0,0 +1,150 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains TLS certificate compression (RFC 8879). A certificate
+ * chain is easily 3-5 KB, which can make the server's first flight exceed the
+ * initial congestion window and cost an extra round trip. The TLS 1.3
+ * Certificate message of every certificate is compressed once when it is
+ * loaded, using the encoders that also compress the responses (see
+ * utils/encoders.h), and handed to OpenSSL, which sends it to clients that
+ * advertise the algorithm.
+ *
+ * Sending precompressed certificates requires OpenSSL 3.2 or newer. Older
+ * versions still log the sizes, but send the certificates uncompressed.
+ */
+#include "utils/encoders.h"
+
+#if OPENSSL_VERSION_NUMBER >= 0x30200000L && !defined(OPENSSL_NO_COMP_ALG)
+	#define TLS_CERT_COMPRESSION_SUPPORTED
+#endif
+
+static void put_u24(unsigned char *destination, size_t value) {
+	destination[0] = (value >> 16) & 0xFF;
+	destination[1] = (value >> 8) & 0xFF;
+	destination[2] = value & 0xFF;
+}
+
+/* appends a CertificateEntry without extensions, returns the new position or 0 on failure */
+static size_t certificate_message_add(unsigned char *message, size_t position, X509 *cert) {
+	unsigned char *der = message + position + 3;
+	int length = i2d_X509(cert, &der);
+	if (length <= 0)
+		return 0;
+	put_u24(message + position, length);
+	position += 3 + length;
+	message[position++] = 0;
+	message[position++] = 0;
+	return position;
+}
+
+/**
+ * Description:
+ *   Creates the body of the TLS 1.3 Certificate message (RFC 8446 Section
+ *   4.4.2) for the certificate that was set last, with its chain.
+ *
+ * Return Value:
+ *   The message (to be freed), or NULL on failure
+ */
+static unsigned char *certificate_message_create(SSL_CTX *ctx, size_t *message_length) {
+	X509 *leaf = SSL_CTX_get0_certificate(ctx);
+	STACK_OF(X509) *chain = NULL;
+	if (!leaf || !SSL_CTX_get0_chain_certs(ctx, &chain))
+		return NULL;
+
+	/* request context (1) + list length (3) + per entry: length (3) + extensions (2) */
+	int i, count = chain ? sk_X509_num(chain) : 0;
+	size_t capacity = 4 + 5 + i2d_X509(leaf, NULL);
+	for (i = 0; i < count; i++)
+		capacity += 5 + i2d_X509(sk_X509_value(chain, i), NULL);
+
+	unsigned char *message = malloc(capacity);
+	if (!message)
+		return NULL;
+
+	message[0] = 0;
+	size_t position = certificate_message_add(message, 4, leaf);
+	for (i = 0; i < count && position; i++)
+		position = certificate_message_add(message, position, sk_X509_value(chain, i));
+
+	if (!position || position > capacity) {
+		free(message);
+		return NULL;
+	}
+
+	put_u24(message + 1, position - 4);
+	*message_length = position;
+	return message;
+}
+
+#ifdef TLS_CERT_COMPRESSION_SUPPORTED
+/* OpenSSL copies the data, so the encoded data can be freed afterwards */
+static int certificate_compressed_set(SSL_CTX *ctx, int algorithm, encoded_data_t *data, size_t original_length) {
+	return SSL_CTX_set1_compressed_cert(ctx, algorithm, (unsigned char *) data->data, data->size, original_length);
+}
+#endif
+
+/**
+ * Description:
+ *   Compresses the certificate that was set last, and logs the savings.
+ *
+ * Parameters:
+ *   SSL_CTX *
+ *     The context the certificate and chain are loaded into.
+ *   const char *
+ *     The certificate file, for logging.
+ *
+ * Return Value:
+ *   (boolean) success status, failing isn't fatal: the certificate is then
+ *   sent uncompressed.
+ */
+static int certificate_compress(SSL_CTX *ctx, const char *file) {
+	size_t length;
+	unsigned char *message = certificate_message_create(ctx, &length);
+	if (!message) {
+		printf("[Secure] Failed to create the certificate message for compression: '%s'\n", file);
+		return 0;
+	}
+
+	encoded_data_t *brotli = ENCODER_STATUS_brotli ? encode_brotli((const char *) message, length) : NULL;
+	encoded_data_t *zlib = encode_zlib((const char *) message, length);
+	free(message);
+
+	printf("[Secure] Certificate compression for '%s': %zu bytes", file, length);
+	if (brotli)
+		printf(", brotli %zu bytes (-%zu)", brotli->size, length > brotli->size ? length - brotli->size : 0);
+	if (zlib)
+		printf(", zlib %zu bytes (-%zu)", zlib->size, length > zlib->size ? length - zlib->size : 0);
+	putchar('\n');
+
+	int success = brotli || zlib;
+#ifdef TLS_CERT_COMPRESSION_SUPPORTED
+	/* the preference order of the server: brotli compresses certificates best */
+	int algorithms[2];
+	size_t algorithm_count = 0;
+	if (brotli && certificate_compressed_set(ctx, TLSEXT_comp_cert_brotli, brotli, length))
+		algorithms[algorithm_count++] = TLSEXT_comp_cert_brotli;
+	if (zlib && certificate_compressed_set(ctx, TLSEXT_comp_cert_zlib, zlib, length))
+		algorithms[algorithm_count++] = TLSEXT_comp_cert_zlib;
+	success = algorithm_count > 0 && SSL_CTX_set1_cert_comp_preference(ctx, algorithms, algorithm_count);
+	if (!success)
+		ERR_print_errors_fp(stderr);
+#else
+	static int warned = 0;
+	if (!warned) {
+		puts("[Secure] Certificate compression requires OpenSSL 3.2 or newer, certificates are sent uncompressed.");
+		warned = 1;
+	}
+	success = 0;
+#endif
+
+	if (brotli) {
+		free(brotli->data);
+		free(brotli);
+	}
+	if (zlib) {
+		free(zlib->data);
+		free(zlib);
+	}
+	return success;
+}
@@ -11,18 +11,27 @@
 typedef struct {
 	/* (nullable) OCSP file. */
 	char *file;
+	/* The DER-encoded response, loaded by setup_ocsp. */
+	unsigned char *der;
+	int der_length;
 } ocsp_data_t;
 
-unsigned char *rspder = NULL;
-int rspderlen;
-
 /*
  * Certificate Status callback. This is called when a client includes a
  * certificate status request extension. The response is either obtained from a
  * file, or from an OCSP responder.
  */
 static int cert_status_cb(SSL *s, void *arg) {
-	SSL_set_tlsext_status_ocsp_resp(s, rspder, rspderlen);
+	ocsp_data_t *data = (ocsp_data_t *) arg;
+	if (!data->der)
+		return SSL_TLSEXT_ERR_NOACK;
+
+	/* OpenSSL takes ownership of the response, so give it a copy */
+	unsigned char *copy = OPENSSL_malloc(data->der_length);
+	if (!copy)
+		return SSL_TLSEXT_ERR_NOACK;
+	memcpy(copy, data->der, data->der_length);
+	SSL_set_tlsext_status_ocsp_resp(s, copy, data->der_length);
 	return SSL_TLSEXT_ERR_OK;
 }
 
@@ -58,8 +67,8 @@ int setup_ocsp(ocsp_data_t *data) {
 		fputs("OCSP file not set.\n", stderr);
 	}
 
-    rspderlen = i2d_OCSP_RESPONSE(resp, &rspder);
-    if (rspderlen <= 0)
+    data->der_length = i2d_OCSP_RESPONSE(resp, &data->der);
+    if (data->der_length <= 0)
         goto err;
 	
 	/*puts("cert_status: ocsp response sent:");
@@ -72,4 +81,12 @@ err:
 end:
     OCSP_RESPONSE_free(resp);
     return ret;
+}
+
+void destroy_ocsp(ocsp_data_t *data) {
+	OPENSSL_free(data->der);
+	data->der = NULL;
+	data->der_length = 0;
+	free(data->file);
+	data->file = NULL;
 } 
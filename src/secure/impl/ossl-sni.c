@@ -0,0 +1,334 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the SNI context store: every configured certificate is
+ * loaded into a SSL_CTX, and the host names of the certificates are put into
+ * a hash table, so the servername callback can switch to the right context.
+ *
+ * Certificates that share a host name but have a different key type end up
+ * in the same SSL_CTX. OpenSSL keeps a slot per key type, so an ECDSA and an
+ * RSA certificate can be offered side by side; the ECDSA one is picked for
+ * clients that support it, since those handshakes are a lot cheaper.
+ *
+ * A store is reference counted, so a reload can build a new store and swap
+ * it in while connections on the old one are still running.
+ *
+ * The SSL objects of ended connections are kept in the store and reset for
+ * the next connection, since SSL_new and SSL_free allocate and free a lot of
+ * internal state. They belong to the store, because an SSL object keeps the
+ * session cache of the context it was created with.
+ */
+#include <ctype.h>
+#include <pthread.h>
+
+#include <openssl/x509v3.h>
+
+#define TLS_KEY_TYPE_RSA   0x1
+#define TLS_KEY_TYPE_EC    0x2
+#define TLS_KEY_TYPE_OTHER 0x4
+
+/* The longest host name (RFC 1035) + null-terminator */
+#define TLS_HOST_NAME_MAX 256
+
+/* The maximum amount of idle SSL objects kept for reuse */
+#define TLS_SSL_POOL_SIZE 64
+
+typedef struct tls_context_t {
+	SSL_CTX *ctx;
+	/* The TLS_KEY_TYPE_* bits of the certificates loaded into ctx. */
+	unsigned key_types;
+} tls_context_t;
+
+typedef struct tls_host_t {
+	/* lowercased; NULL means an empty slot */
+	char *name;
+	tls_context_t *context;
+} tls_host_t;
+
+typedef struct tls_store_t {
+	tls_context_t **contexts;
+	size_t context_count;
+	/* The context of the first certificate, used when SNI doesn't match. */
+	tls_context_t *default_context;
+
+	/* open addressing with linear probing, host_capacity is a power of two */
+	tls_host_t *hosts;
+	size_t host_count;
+	size_t host_capacity;
+
+	ocsp_data_t ocsp;
+
+	/* idle SSL objects, guarded by pool_mutex */
+	SSL *pool[TLS_SSL_POOL_SIZE];
+	size_t pool_count;
+	pthread_mutex_t pool_mutex;
+
+	/* guarded by store_mutex */
+	unsigned references;
+} tls_store_t;
+
+static pthread_mutex_t store_mutex = PTHREAD_MUTEX_INITIALIZER;
+static tls_store_t *current_store = NULL;
+
+/* FNV-1a */
+static size_t host_hash(const char *name) {
+	size_t hash = 2166136261u;
+	while (*name) {
+		hash ^= (unsigned char) *name++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/* lowercases 'name' into 'dest', returns 0 if the name is too long */
+static int host_normalize(char *dest, const char *name) {
+	size_t i;
+	for (i = 0; name[i]; i++) {
+		if (i == TLS_HOST_NAME_MAX - 1)
+			return 0;
+		dest[i] = tolower((unsigned char) name[i]);
+	}
+	dest[i] = 0;
+	return 1;
+}
+
+static tls_host_t *store_find_slot(tls_store_t *store, const char *name) {
+	size_t mask = store->host_capacity - 1;
+	size_t i = host_hash(name) & mask;
+	while (store->hosts[i].name && strcmp(store->hosts[i].name, name))
+		i = (i + 1) & mask;
+	return &store->hosts[i];
+}
+
+static int store_grow(tls_store_t *store) {
+	size_t old_capacity = store->host_capacity;
+	tls_host_t *old_hosts = store->hosts;
+
+	store->host_capacity = old_capacity ? old_capacity * 2 : 16;
+	store->hosts = calloc(store->host_capacity, sizeof(tls_host_t));
+	if (!store->hosts) {
+		store->hosts = old_hosts;
+		store->host_capacity = old_capacity;
+		return 0;
+	}
+
+	size_t i;
+	for (i = 0; i < old_capacity; i++)
+		if (old_hosts[i].name)
+			*store_find_slot(store, old_hosts[i].name) = old_hosts[i];
+	free(old_hosts);
+	return 1;
+}
+
+static tls_context_t *store_lookup(tls_store_t *store, const char *name) {
+	char normalized[TLS_HOST_NAME_MAX];
+	if (!store->host_count || !host_normalize(normalized, name))
+		return NULL;
+
+	tls_host_t *host = store_find_slot(store, normalized);
+	if (host->name)
+		return host->context;
+
+	/* try the wildcard of the parent domain: "www.example.org" => "*.example.org" */
+	char *dot = strchr(normalized, '.');
+	if (!dot || dot == normalized)
+		return NULL;
+	dot[-1] = '*';
+	host = store_find_slot(store, dot - 1);
+	return host->name ? host->context : NULL;
+}
+
+/* returns the context the name is already bound to, or binds it to 'context' */
+static tls_context_t *store_bind(tls_store_t *store, const char *name, tls_context_t *context) {
+	char normalized[TLS_HOST_NAME_MAX];
+	if (!host_normalize(normalized, name)) {
+		printf("[Secure] Host name too long, ignoring: '%s'\n", name);
+		return NULL;
+	}
+
+	/* keep the load factor below 0.5 */
+	if ((store->host_count + 1) * 2 > store->host_capacity && !store_grow(store))
+		return NULL;
+
+	tls_host_t *host = store_find_slot(store, normalized);
+	if (host->name)
+		return host->context;
+
+	if (!(host->name = strdup(normalized)))
+		return NULL;
+	host->context = context;
+	store->host_count += 1;
+	return context;
+}
+
+static unsigned key_type_of(EVP_PKEY *key) {
+	switch (EVP_PKEY_base_id(key)) {
+		case EVP_PKEY_RSA:
+			return TLS_KEY_TYPE_RSA;
+		case EVP_PKEY_EC:
+			return TLS_KEY_TYPE_EC;
+		default:
+			return TLS_KEY_TYPE_OTHER;
+	}
+}
+
+/* Collects the DNS names of the certificate (subjectAltName, or the CN as fallback). */
+static size_t certificate_names(X509 *cert, char **names, size_t max) {
+	size_t count = 0;
+
+	GENERAL_NAMES *alt_names = X509_get_ext_d2i(cert, NID_subject_alt_name, NULL, NULL);
+	if (alt_names) {
+		int i;
+		for (i = 0; i < sk_GENERAL_NAME_num(alt_names) && count < max; i++) {
+			GENERAL_NAME *entry = sk_GENERAL_NAME_value(alt_names, i);
+			unsigned char *dns;
+			if (entry->type != GEN_DNS || ASN1_STRING_to_UTF8(&dns, entry->d.dNSName) < 0)
+				continue;
+			names[count++] = (char *) dns;
+		}
+		GENERAL_NAMES_free(alt_names);
+	}
+
+	if (count == 0) {
+		X509_NAME *subject = X509_get_subject_name(cert);
+		int position = X509_NAME_get_index_by_NID(subject, NID_commonName, -1);
+		unsigned char *common_name;
+		if (position >= 0 && ASN1_STRING_to_UTF8(&common_name, X509_NAME_ENTRY_get_data(X509_NAME_get_entry(subject, position))) >= 0)
+			names[count++] = (char *) common_name;
+	}
+
+	return count;
+}
+
+/* Loads the intermediates of 'file' into the current certificate of the context. */
+static int load_chain_file(SSL_CTX *ctx, const char *file) {
+	BIO *bio = BIO_new_file(file, "r");
+	if (!bio) {
+		printf("[Secure] Failed to open chain file: '%s'\n", file);
+		return 0;
+	}
+
+	X509 *cert;
+	size_t count = 0;
+	while ((cert = PEM_read_bio_X509(bio, NULL, NULL, NULL))) {
+		if (!SSL_CTX_add0_chain_cert(ctx, cert)) {
+			X509_free(cert);
+			BIO_free(bio);
+			return 0;
+		}
+		count += 1;
+	}
+	/* reading until EOF leaves a 'no start line' error on the queue */
+	ERR_clear_error();
+	BIO_free(bio);
+
+	if (count == 0)
+		printf("[Secure] No certificates in chain file: '%s'\n", file);
+	return count > 0;
+}
+
+static void store_destroy(tls_store_t *store) {
+	size_t i;
+	for (i = 0; i < store->host_capacity; i++)
+		free(store->hosts[i].name);
+	free(store->hosts);
+
+	for (i = 0; i < store->context_count; i++) {
+		/* connections still using the context hold their own reference */
+		SSL_CTX_free(store->contexts[i]->ctx);
+		free(store->contexts[i]);
+	}
+	free(store->contexts);
+
+	for (i = 0; i < store->pool_count; i++)
+		SSL_free(store->pool[i]);
+	pthread_mutex_destroy(&store->pool_mutex);
+
+	destroy_ocsp(&store->ocsp);
+	free(store);
+}
+
+/* Takes an idle SSL object, or creates one. */
+static SSL *store_ssl_take(tls_store_t *store) {
+	SSL *ssl = NULL;
+	pthread_mutex_lock(&store->pool_mutex);
+	if (store->pool_count > 0)
+		ssl = store->pool[--store->pool_count];
+	pthread_mutex_unlock(&store->pool_mutex);
+
+	if (!ssl)
+		return SSL_new(store->default_context->ctx);
+
+	/* the SNI callback of the previous connection could have switched the context */
+	if (SSL_get_SSL_CTX(ssl) != store->default_context->ctx)
+		SSL_set_SSL_CTX(ssl, store->default_context->ctx);
+	return ssl;
+}
+
+/* Resets the SSL object for the next connection, or frees it if the pool is full. */
+static void store_ssl_give(tls_store_t *store, SSL *ssl) {
+	if (!SSL_clear(ssl)) {
+		ERR_clear_error();
+		SSL_free(ssl);
+		return;
+	}
+
+	pthread_mutex_lock(&store->pool_mutex);
+	if (store->pool_count < TLS_SSL_POOL_SIZE) {
+		store->pool[store->pool_count++] = ssl;
+		ssl = NULL;
+	}
+	pthread_mutex_unlock(&store->pool_mutex);
+
+	if (ssl)
+		SSL_free(ssl);
+}
+
+static tls_store_t *store_acquire(void) {
+	pthread_mutex_lock(&store_mutex);
+	tls_store_t *store = current_store;
+	if (store)
+		store->references += 1;
+	pthread_mutex_unlock(&store_mutex);
+	return store;
+}
+
+static void store_release(tls_store_t *store) {
+	pthread_mutex_lock(&store_mutex);
+	unsigned references = --store->references;
+	pthread_mutex_unlock(&store_mutex);
+	if (references == 0)
+		store_destroy(store);
+}
+
+/* Makes 'store' the current store, the old store is destroyed when the last connection on it has ended. */
+static void store_publish(tls_store_t *store) {
+	pthread_mutex_lock(&store_mutex);
+	tls_store_t *old = current_store;
+	store->references = 1;
+	current_store = store;
+	pthread_mutex_unlock(&store_mutex);
+
+	if (old)
+		store_release(old);
+}
+
+static int sni_handle(SSL *ssl, int *alert, void *arg) {
+	tls_store_t *store = (tls_store_t *) arg;
+	const char *name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+	if (!name)
+		return SSL_TLSEXT_ERR_NOACK;
+
+	tls_context_t *context = store_lookup(store, name);
+	if (!context) {
+		/* unknown host, continue with the default certificate */
+		return SSL_TLSEXT_ERR_NOACK;
+	}
+
+	if (context != store->default_context && !SSL_set_SSL_CTX(ssl, context->ctx)) {
+		*alert = SSL_AD_INTERNAL_ERROR;
+		return SSL_TLSEXT_ERR_ALERT_FATAL;
+	}
+	return SSL_TLSEXT_ERR_OK;
+}
@@ -36,6 +36,21 @@ TLS_AP  tls_get_ap(TLS);
  *   (boolean) success status
  */
 int  tls_setup(secure_config_t *);
+/**
+ * Description:
+ *   Reloads the certificates (and OCSP response) from the files in the
+ *   configuration. The new contexts are loaded next to the current ones and
+ *   swapped in afterwards, so this doesn't block handshakes. Connections
+ *   that are already set up keep using their old context.
+ * 
+ * Parameters:
+ *   The configuration with file paths pointing to certificates etc. 
+ *   (see 'src/utils/fileutil.h')
+ * 
+ * Return value:
+ *   (boolean) success status, on failure the current certificates are kept.
+ */
+int  tls_reload(secure_config_t *);
 /**
  * Description:
  *   This function should set up a correct environment with TLS. This 
@@ -101,6 +116,33 @@ int  tls_read_client(TLS, char *, size_t);
  *   (boolean) success staus
  */
 int  tls_read_client_complete(TLS, char *, size_t);
+/**
+ * Description:
+ *   Checks if the handshake is still in progress, i.e. the data read from the
+ *   client is TLS 1.3 early data. Early data can be replayed by an attacker,
+ *   so only requests that are safe to repeat should be processed.
+ * 
+ * Parameters:
+ *   TLS
+ *     The data created by 'tls_setup_client'.
+ * 
+ * Return value:
+ *   (boolean) the data read so far is early data
+ */
+int  tls_in_early_data(TLS);
+/**
+ * Description:
+ *   Checks if there is data that was received (and decrypted), but hasn't
+ *   been read yet, so polling the socket would wait for nothing.
+ * 
+ * Parameters:
+ *   TLS
+ *     The data created by 'tls_setup_client'.
+ * 
+ * Return value:
+ *   (boolean) there is buffered data
+ */
+int  tls_pending(TLS);
 /**
  * Description:
  *   This function should destroy data created/allocated by 
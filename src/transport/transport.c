@@ -0,0 +1,382 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see transport.h
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "transport.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+
+#include "base/global_settings.h"
+#include "secure/tlsutil.h"
+
+/* the size of the buffer used when the transport can't use sendfile(2) */
+#define TRANSPORT_FILE_CHUNK_SIZE 16384
+/* the size of the buffer the parts of transport_writev are copied into, when
+ * the transport can't gather them (the maximum size of a TLS record) */
+#define TRANSPORT_GATHER_SIZE 16384
+
+static const char preface[] = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+/** TLS **/
+static int tls_transport_read(transport_t *transport, char *buffer, size_t length) {
+	return tls_read_client(transport->data, buffer, length);
+}
+
+static int tls_transport_write(transport_t *transport, const char *buffer, size_t length) {
+	return tls_write_client(transport->data, buffer, length);
+}
+
+static void tls_transport_close(transport_t *transport) {
+	tls_destroy_client(transport->data);
+}
+
+static transport_protocol_t tls_transport_get_protocol(transport_t *transport) {
+	switch (tls_get_ap(transport->data)) {
+		case TLS_AP_HTTP11:
+			return TRANSPORT_PROTOCOL_HTTP1;
+		case TLS_AP_HTTP2:
+			return TRANSPORT_PROTOCOL_HTTP2;
+		default:
+			return TRANSPORT_PROTOCOL_UNKNOWN;
+	}
+}
+
+static int tls_transport_in_early_data(transport_t *transport) {
+	return tls_in_early_data(transport->data);
+}
+
+static int tls_transport_pending(transport_t *transport) {
+	return tls_pending(transport->data);
+}
+
+static const transport_ops_t tls_ops = {
+	"TLS",
+	tls_transport_read,
+	tls_transport_write,
+	tls_transport_close,
+	tls_transport_get_protocol,
+	tls_transport_in_early_data,
+	tls_transport_pending,
+	NULL,
+	NULL
+};
+
+/** Cleartext **/
+/* (boolean) waits until the socket is readable or writable */
+static int cleartext_wait(int socket, short events) {
+	struct pollfd poller;
+	poller.fd = socket;
+	poller.events = events;
+	poller.revents = 0;
+	int result;
+	while (((result = poll(&poller, 1, GLOBAL_SETTING_read_timeout)) == 0 || (result == -1 && errno == EINTR))
+		&& !GLOBAL_SETTINGS_cancel_requested) {
+		/* waiting */
+	}
+	return result > 0;
+}
+
+static int cleartext_read(transport_t *transport, char *buffer, size_t length) {
+	while (1) {
+		ssize_t result = recv(transport->socket, buffer, length, 0);
+		if (result > 0)
+			return result;
+		if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+			if (cleartext_wait(transport->socket, POLLIN))
+				continue;
+		}
+		return 0;
+	}
+}
+
+static int cleartext_write(transport_t *transport, const char *buffer, size_t length) {
+	size_t position = 0;
+	while (position < length) {
+		ssize_t result = send(transport->socket, buffer + position, length - position, MSG_NOSIGNAL);
+		if (result > 0) {
+			position += result;
+			continue;
+		}
+		if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+			if (cleartext_wait(transport->socket, POLLOUT))
+				continue;
+		}
+		return 0;
+	}
+	return 1;
+}
+
+static int cleartext_writev(transport_t *transport, const struct iovec *parts, int count) {
+	/* the parts that are (partly) written are adjusted in a copy */
+	struct iovec remaining[TRANSPORT_WRITEV_MAX];
+	if (count > TRANSPORT_WRITEV_MAX)
+		return 0;
+	memcpy(remaining, parts, count * sizeof(struct iovec));
+
+	struct msghdr message;
+	memset(&message, 0, sizeof(message));
+	message.msg_iov = remaining;
+	message.msg_iovlen = count;
+	while (message.msg_iovlen > 0) {
+		ssize_t result = sendmsg(transport->socket, &message, MSG_NOSIGNAL);
+		if (result >= 0) {
+			size_t written = result;
+			while (message.msg_iovlen > 0 && written >= message.msg_iov->iov_len) {
+				written -= message.msg_iov->iov_len;
+				message.msg_iov++;
+				message.msg_iovlen--;
+			}
+			if (message.msg_iovlen > 0) {
+				message.msg_iov->iov_base = (char *) message.msg_iov->iov_base + written;
+				message.msg_iov->iov_len -= written;
+			}
+			continue;
+		}
+		if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+			if (cleartext_wait(transport->socket, POLLOUT))
+				continue;
+		}
+		return 0;
+	}
+	return 1;
+}
+
+static void cleartext_close(transport_t *transport) {
+	/* nothing to destroy */
+}
+
+static transport_protocol_t cleartext_get_protocol(transport_t *transport) {
+	/* there is no ALPN, so the preface has to be used */
+	return TRANSPORT_PROTOCOL_UNKNOWN;
+}
+
+static int cleartext_sendfile(transport_t *transport, int file, off_t offset, size_t length) {
+	while (length > 0) {
+		ssize_t result = sendfile(transport->socket, file, &offset, length);
+		if (result > 0) {
+			length -= result;
+			continue;
+		}
+		if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+			if (cleartext_wait(transport->socket, POLLOUT))
+				continue;
+		}
+		/* result == 0: the file is shorter than expected */
+		return 0;
+	}
+	return 1;
+}
+
+static const transport_ops_t cleartext_ops = {
+	"Cleartext",
+	cleartext_read,
+	cleartext_write,
+	cleartext_close,
+	cleartext_get_protocol,
+	NULL,
+	NULL,
+	cleartext_sendfile,
+	cleartext_writev
+};
+
+/** Generic **/
+static transport_t *transport_create(int socket, const transport_ops_t *ops, void *data) {
+	transport_t *transport = calloc(1, sizeof(transport_t));
+	if (!transport)
+		return NULL;
+	transport->ops = ops;
+	transport->socket = socket;
+	transport->data = data;
+	return transport;
+}
+
+transport_t *transport_create_tls(int socket) {
+	TLS tls = tls_setup_client(socket);
+	if (!tls)
+		return NULL;
+
+	transport_t *transport = transport_create(socket, &tls_ops, tls);
+	if (!transport)
+		tls_destroy_client(tls);
+	return transport;
+}
+
+transport_t *transport_create_cleartext(int socket) {
+	return transport_create(socket, &cleartext_ops, NULL);
+}
+
+void transport_destroy(transport_t *transport) {
+	transport->ops->close(transport);
+	free(transport);
+}
+
+transport_protocol_t transport_get_protocol(transport_t *transport) {
+	transport_protocol_t protocol = transport->ops->get_protocol(transport);
+	if (protocol != TRANSPORT_PROTOCOL_UNKNOWN)
+		return protocol;
+
+	/* Read until the bytes don't match the preface, so nothing after the
+	 * preface (or after the mismatch) is read ahead. */
+	while (transport->peeked_length < TRANSPORT_PREFACE_LENGTH) {
+		int read = transport->ops->read(transport, transport->peeked + transport->peeked_length, TRANSPORT_PREFACE_LENGTH - transport->peeked_length);
+		if (read <= 0)
+			return TRANSPORT_PROTOCOL_UNKNOWN;
+
+		transport->peeked_length += read;
+		if (memcmp(transport->peeked, preface, transport->peeked_length))
+			return TRANSPORT_PROTOCOL_HTTP1;
+	}
+	return TRANSPORT_PROTOCOL_HTTP2;
+}
+
+int transport_read(transport_t *transport, char *buffer, size_t length) {
+	if (transport->peeked_position < transport->peeked_length) {
+		size_t available = transport->peeked_length - transport->peeked_position;
+		if (length > available)
+			length = available;
+		memcpy(buffer, transport->peeked + transport->peeked_position, length);
+		transport->peeked_position += length;
+		return length;
+	}
+	return transport->ops->read(transport, buffer, length);
+}
+
+int transport_read_complete(transport_t *transport, char *buffer, size_t length) {
+	size_t position = 0;
+	while (position < length) {
+		int read = transport_read(transport, buffer + position, length - position);
+		if (read <= 0)
+			return 0;
+		position += read;
+	}
+	return 1;
+}
+
+int transport_write(transport_t *transport, const char *buffer, size_t length) {
+	return transport->ops->write(transport, buffer, length);
+}
+
+int transport_writev(transport_t *transport, const struct iovec *parts, int count) {
+	if (transport->ops->writev)
+		return transport->ops->writev(transport, parts, count);
+
+	/* small parts are copied into the buffer, a large part fills it up and
+	 * the rest is written without copying */
+	char buffer[TRANSPORT_GATHER_SIZE];
+	size_t length = 0;
+	int i;
+	for (i = 0; i < count; i++) {
+		const char *data = parts[i].iov_base;
+		size_t left = parts[i].iov_len;
+		if (length > 0 || left < TRANSPORT_GATHER_SIZE) {
+			size_t copied = left < TRANSPORT_GATHER_SIZE - length ? left : TRANSPORT_GATHER_SIZE - length;
+			memcpy(buffer + length, data, copied);
+			length += copied;
+			data += copied;
+			left -= copied;
+			if (length == TRANSPORT_GATHER_SIZE) {
+				if (!transport->ops->write(transport, buffer, length))
+					return 0;
+				length = 0;
+			}
+		}
+
+		if (left >= TRANSPORT_GATHER_SIZE) {
+			if (!transport->ops->write(transport, data, left))
+				return 0;
+		} else if (left > 0) {
+			memcpy(buffer, data, left);
+			length = left;
+		}
+	}
+	return length == 0 || transport->ops->write(transport, buffer, length);
+}
+
+int transport_sendfile(transport_t *transport, int file, off_t offset, size_t length) {
+	if (transport->ops->sendfile)
+		return transport->ops->sendfile(transport, file, offset, length);
+
+	char *buffer = malloc(length < TRANSPORT_FILE_CHUNK_SIZE ? length : TRANSPORT_FILE_CHUNK_SIZE);
+	if (!buffer)
+		return 0;
+
+	while (length > 0) {
+		ssize_t result = pread(file, buffer, length < TRANSPORT_FILE_CHUNK_SIZE ? length : TRANSPORT_FILE_CHUNK_SIZE, offset);
+		if (result <= 0 || !transport->ops->write(transport, buffer, result)) {
+			if (result < 0)
+				perror("[Transport] pread");
+			free(buffer);
+			return 0;
+		}
+		offset += result;
+		length -= result;
+	}
+
+	free(buffer);
+	return 1;
+}
+
+int transport_in_early_data(transport_t *transport) {
+	return transport->ops->in_early_data && transport->ops->in_early_data(transport);
+}
+
+int transport_wait_readable(transport_t *transport, int timeout) {
+	if (transport->peeked_position < transport->peeked_length
+		|| (transport->ops->pending && transport->ops->pending(transport)))
+		return 1;
+
+	struct pollfd poller;
+	poller.fd = transport->socket;
+	poller.events = POLLIN;
+
+	/* wait in slices, so a cancellation request is noticed */
+	while (timeout > 0 && !GLOBAL_SETTINGS_cancel_requested) {
+		int slice = timeout < GLOBAL_SETTING_read_timeout ? timeout : GLOBAL_SETTING_read_timeout;
+		poller.revents = 0;
+		int result = poll(&poller, 1, slice);
+		if (result > 0)
+			return 1;
+		if (result < 0 && errno != EINTR)
+			return 0;
+		timeout -= slice;
+	}
+	return 0;
+}
+
+int transport_wait_readable_or(transport_t *transport, int other, int timeout) {
+	int buffered = transport->peeked_position < transport->peeked_length
+		|| (transport->ops->pending && transport->ops->pending(transport));
+	if (buffered)
+		timeout = 0;
+
+	struct pollfd pollers[2];
+	pollers[0].fd = transport->socket;
+	pollers[0].events = POLLIN;
+	pollers[0].revents = 0;
+	pollers[1].fd = other;
+	pollers[1].events = POLLIN;
+	pollers[1].revents = 0;
+
+	int result = poll(pollers, 2, timeout);
+	if (result < 0 && errno != EINTR)
+		return -1;
+
+	result = 0;
+	if (buffered || pollers[0].revents)
+		result |= TRANSPORT_WAIT_READABLE;
+	if (pollers[1].revents)
+		result |= TRANSPORT_WAIT_OTHER;
+	return result;
+}
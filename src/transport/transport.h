@@ -0,0 +1,203 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the transport abstraction. The HTTP code reads from and
+ * writes to a transport_t, which is either TLS (see secure/tlsutil.h) or a
+ * cleartext TCP connection, e.g. behind a TLS-terminating load balancer.
+ */
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+/* The length of the HTTP/2 connection preface (RFC 7540 Section 3.5). */
+#define TRANSPORT_PREFACE_LENGTH 24
+
+/* The maximum amount of parts transport_writev writes at once. */
+#define TRANSPORT_WRITEV_MAX 8
+
+typedef enum transport_protocol_t {
+	TRANSPORT_PROTOCOL_UNKNOWN,
+	TRANSPORT_PROTOCOL_HTTP1,
+	TRANSPORT_PROTOCOL_HTTP2
+} transport_protocol_t;
+
+typedef struct transport_t transport_t;
+
+typedef struct transport_ops_t {
+	/* for logging */
+	const char *name;
+	/* returns 0 on failure, otherwise the amount of bytes read */
+	int (*read)(transport_t *, char *, size_t);
+	/* (boolean) writes everything */
+	int (*write)(transport_t *, const char *, size_t);
+	/* destroys the data of the transport, the socket is closed by the caller */
+	void (*close)(transport_t *);
+	/* the protocol negotiated by the transport (ALPN), or TRANSPORT_PROTOCOL_UNKNOWN */
+	transport_protocol_t (*get_protocol)(transport_t *);
+	/* (nullable) see tls_in_early_data */
+	int (*in_early_data)(transport_t *);
+	/* (nullable) (boolean) data was received and buffered, but not read yet */
+	int (*pending)(transport_t *);
+	/* (nullable) (boolean) writes 'length' bytes of the file at 'offset' without copying them through userspace */
+	int (*sendfile)(transport_t *, int, off_t, size_t);
+	/* (nullable) (boolean) writes all the parts, in as few packets as possible */
+	int (*writev)(transport_t *, const struct iovec *, int);
+} transport_ops_t;
+
+struct transport_t {
+	const transport_ops_t *ops;
+	int socket;
+	/* the TLS handle for TLS transports */
+	void *data;
+	/* bytes that were read ahead to detect the protocol, returned first by transport_read */
+	char peeked[TRANSPORT_PREFACE_LENGTH];
+	size_t peeked_length;
+	size_t peeked_position;
+};
+
+/**
+ * Description:
+ *   Sets up a TLS connection on the socket, see tls_setup_client.
+ *
+ * Return Value:
+ *   NULL on failure, or a valid pointer
+ */
+transport_t *transport_create_tls(int);
+/**
+ * Description:
+ *   Creates a transport that reads from and writes to the socket as is.
+ *
+ * Return Value:
+ *   NULL on failure, or a valid pointer
+ */
+transport_t *transport_create_cleartext(int);
+/**
+ * Description:
+ *   Destroys the transport, but doesn't close the socket.
+ */
+void transport_destroy(transport_t *);
+
+/**
+ * Description:
+ *   Determines the HTTP version the client speaks. The protocol negotiated by
+ *   the transport (ALPN) is used if there is one, otherwise the first bytes
+ *   are compared to the HTTP/2 connection preface ("prior knowledge"). These
+ *   bytes are returned again by the next reads.
+ *
+ * Return Value:
+ *   The protocol, or TRANSPORT_PROTOCOL_UNKNOWN on I/O failure
+ */
+transport_protocol_t transport_get_protocol(transport_t *);
+
+/**
+ * Description:
+ *   Reads at most 'length' bytes.
+ *
+ * Return Value:
+ *   (int) 0 if failed, otherwise the amount of data read.
+ */
+int transport_read(transport_t *, char *, size_t);
+/**
+ * Description:
+ *   This function will ensure all the bytes requested are read.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int transport_read_complete(transport_t *, char *, size_t);
+/**
+ * Description:
+ *   Writes all the bytes.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int transport_write(transport_t *, const char *, size_t);
+/**
+ * Description:
+ *   Writes all the parts as if they were one buffer. The cleartext transport
+ *   uses one system call, others copy the parts into records of at most
+ *   16 KiB, so e.g. a response head and a small body are sent together.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport.
+ *   const struct iovec *
+ *     The parts.
+ *   int
+ *     The amount of parts, at most TRANSPORT_WRITEV_MAX.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int transport_writev(transport_t *, const struct iovec *, int);
+/**
+ * Description:
+ *   Writes 'length' bytes of the file descriptor, starting at 'offset'. The
+ *   cleartext transport uses sendfile(2), others read the file in chunks.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport.
+ *   int
+ *     The file descriptor.
+ *   off_t
+ *     The position in the file.
+ *   size_t
+ *     The amount of bytes to write.
+ *
+ * Return Value:
+ *   (boolean) success status
+ */
+int transport_sendfile(transport_t *, int, off_t, size_t);
+/**
+ * Description:
+ *   See tls_in_early_data, this is always false for cleartext transports.
+ */
+int transport_in_early_data(transport_t *);
+/**
+ * Description:
+ *   Waits until there is data to read, e.g. the next request on a persistent
+ *   connection. Data that is already buffered (TLS records, pipelined
+ *   requests) counts as well.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport.
+ *   int
+ *     The maximum time to wait, in milliseconds.
+ *
+ * Return Value:
+ *   (boolean) data can be read, false on timeout, error or cancellation
+ */
+int transport_wait_readable(transport_t *, int);
+
+/* The results of transport_wait_readable_or. */
+#define TRANSPORT_WAIT_READABLE 0x1
+#define TRANSPORT_WAIT_OTHER 0x2
+
+/**
+ * Description:
+ *   Waits until there is data to read, like transport_wait_readable, or until
+ *   another file descriptor (e.g. a pipe another thread wakes the reader with)
+ *   is readable. It polls once, without checking for cancellation.
+ *
+ * Parameters:
+ *   transport_t *
+ *     The transport.
+ *   int
+ *     The other file descriptor.
+ *   int
+ *     The maximum time to wait, in milliseconds, 0 doesn't wait.
+ *
+ * Return Value:
+ *   TRANSPORT_WAIT_READABLE and/or TRANSPORT_WAIT_OTHER, 0 on timeout, or -1
+ *   on error
+ */
+int transport_wait_readable_or(transport_t *, int, int);
+
+#endif /* TRANSPORT_H */
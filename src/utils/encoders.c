@@ -25,6 +25,22 @@
 #define windowBits 15
 #define GZIP_ENCODING 16
 
+/* the size of the output buffer of a stream */
+#define ENCODER_STREAM_BUFFER_SIZE 16384
+/* the compression levels of streams: a good ratio at a speed that can be
+ * afforded for every request */
+#define ENCODER_STREAM_GZIP_LEVEL 6
+#define ENCODER_STREAM_BROTLI_QUALITY 5
+
+struct encoder_stream_t {
+	encoder_stream_type_t type;
+	z_stream zlib;
+#ifdef ENCODERS_ENABLE_BROTLI
+	BrotliEncoderState *brotli;
+#endif /* ENCODERS_ENABLE_BROTLI */
+	char output[ENCODER_STREAM_BUFFER_SIZE];
+};
+
 /** Section: Variables */
 int ENCODER_STATUS_gzip,
 	ENCODER_STATUS_brotli;
@@ -140,3 +156,109 @@ encoded_data_t *encode_gzip(const char *input, size_t length) {
 	
 	return result;
 }
+
+encoded_data_t *encode_zlib(const char *input, size_t length) {
+	encoded_data_t *result = malloc(sizeof(encoded_data_t));
+	if (!result)
+		return NULL;
+
+	uLongf size = compressBound(length);
+	result->data = malloc(size);
+	if (!result->data) {
+		free(result);
+		return NULL;
+	}
+
+	if (compress2((Bytef *) result->data, &size, (const Bytef *) input, length, Z_BEST_COMPRESSION) != Z_OK) {
+		printf("[Encoder] (zlib) Compression error: length=%zu\n", length);
+		free(result->data);
+		free(result);
+		return NULL;
+	}
+
+	result->size = size;
+	return result;
+}
+
+encoder_stream_t *encoder_stream_create(encoder_stream_type_t type) {
+	encoder_stream_t *stream = malloc(sizeof(encoder_stream_t));
+	if (!stream)
+		return NULL;
+	stream->type = type;
+
+	if (type == ENCODER_STREAM_GZIP) {
+		stream->zlib.zalloc = Z_NULL;
+		stream->zlib.zfree = Z_NULL;
+		stream->zlib.opaque = Z_NULL;
+		if (deflateInit2(&stream->zlib, ENCODER_STREAM_GZIP_LEVEL, Z_DEFLATED, windowBits | GZIP_ENCODING, 8, Z_DEFAULT_STRATEGY) == Z_OK)
+			return stream;
+		puts("[Encoder] (GZip) Failed to initialize a stream!");
+	}
+#ifdef ENCODERS_ENABLE_BROTLI
+	else if (type == ENCODER_STREAM_BROTLI) {
+		if ((stream->brotli = BrotliEncoderCreateInstance(NULL, NULL, NULL))) {
+			BrotliEncoderSetParameter(stream->brotli, BROTLI_PARAM_QUALITY, ENCODER_STREAM_BROTLI_QUALITY);
+			return stream;
+		}
+		puts("[Encoder] (Brotli) Failed to initialize a stream!");
+	}
+#endif /* ENCODERS_ENABLE_BROTLI */
+
+	free(stream);
+	return NULL;
+}
+
+int encoder_stream_write(encoder_stream_t *stream, const char *input, size_t length, int finish, encoder_output_t output, void *user_data) {
+	if (stream->type == ENCODER_STREAM_GZIP) {
+		stream->zlib.next_in = (Bytef *) input;
+		stream->zlib.avail_in = length;
+		int status;
+		do {
+			stream->zlib.next_out = (Bytef *) stream->output;
+			stream->zlib.avail_out = ENCODER_STREAM_BUFFER_SIZE;
+			status = deflate(&stream->zlib, finish ? Z_FINISH : Z_NO_FLUSH);
+			if (status == Z_STREAM_ERROR) {
+				puts("[Encoder] (GZip) Stream compression error!");
+				return 0;
+			}
+
+			size_t size = ENCODER_STREAM_BUFFER_SIZE - stream->zlib.avail_out;
+			if (size > 0 && !output(user_data, stream->output, size))
+				return 0;
+		} while (stream->zlib.avail_out == 0 || (finish && status != Z_STREAM_END));
+		return 1;
+	}
+
+#ifdef ENCODERS_ENABLE_BROTLI
+	size_t available_in = length;
+	const uint8_t *next_in = (const uint8_t *) input;
+	BrotliEncoderOperation operation = finish ? BROTLI_OPERATION_FINISH : BROTLI_OPERATION_PROCESS;
+	while (available_in > 0 || BrotliEncoderHasMoreOutput(stream->brotli) || (finish && !BrotliEncoderIsFinished(stream->brotli))) {
+		size_t available_out = ENCODER_STREAM_BUFFER_SIZE;
+		uint8_t *next_out = (uint8_t *) stream->output;
+		if (!BrotliEncoderCompressStream(stream->brotli, operation, &available_in, &next_in, &available_out, &next_out, NULL)) {
+			puts("[Encoder] (Brotli) Stream compression error!");
+			return 0;
+		}
+
+		size_t size = ENCODER_STREAM_BUFFER_SIZE - available_out;
+		if (size > 0 && !output(user_data, stream->output, size))
+			return 0;
+	}
+	return 1;
+#else
+	return 0;
+#endif /* ENCODERS_ENABLE_BROTLI */
+}
+
+void encoder_stream_destroy(encoder_stream_t *stream) {
+	if (!stream)
+		return;
+	if (stream->type == ENCODER_STREAM_GZIP)
+		deflateEnd(&stream->zlib);
+#ifdef ENCODERS_ENABLE_BROTLI
+	else
+		BrotliEncoderDestroyInstance(stream->brotli);
+#endif /* ENCODERS_ENABLE_BROTLI */
+	free(stream);
+}
@@ -60,6 +60,27 @@ void encoder_destroy(void);
  */
 encoded_data_t *encode_gzip(const char *, size_t );
 
+/**
+ * Description:
+ *   Compress the message in the zlib format (RFC 1950) using zlib, with the
+ *   best compression level. This is meant for data that is compressed once,
+ *   like the certificate chain.
+ * 
+ * Parameters:
+ *   const char *
+ *     The data ("message") to compress.
+ *   size_t
+ *     The length of the message.
+ * 
+ * Notes:
+ *   The return value 'encoded_data_t *' and its member 'char *data' should both be 
+ *   freed, since these cannot and will not be cleaned by this function.
+ * 
+ * Return Value:
+ *   The encoded_data_t structure with its data and size, or NULL on failure.
+ */
+encoded_data_t *encode_zlib(const char *, size_t);
+
 /**
  * Description:
  *   Compress the message in the brotli format using Google's Library.
@@ -82,5 +103,63 @@ encoded_data_t *encode_gzip(const char *, size_t );
  */
 encoded_data_t *encode_brotli(const char *, size_t);
 
+/** Section: Streaming */
+typedef enum {
+	ENCODER_STREAM_GZIP,
+	ENCODER_STREAM_BROTLI
+} encoder_stream_type_t;
+
+typedef struct encoder_stream_t encoder_stream_t;
+
+/* Receives the compressed output of a stream: the user data, the output and
+ * its length. Returns (boolean) success. */
+typedef int (*encoder_output_t)(void *, const char *, size_t);
+
+/**
+ * Description:
+ *   Creates a compression stream, for data that is compressed while it is
+ *   sent, so it doesn't have to be in memory at once. The compression levels
+ *   are lower than those of the one-shot functions, since this happens for
+ *   every request.
+ *
+ * Warning(s):
+ *   Brotli streams can't be created if 'ENCODER_STATUS_brotli' is 0.
+ *
+ * Return Value:
+ *   The stream (destroy with encoder_stream_destroy), or NULL on failure.
+ */
+encoder_stream_t *encoder_stream_create(encoder_stream_type_t);
+
+/**
+ * Description:
+ *   Compresses the input, and passes the output that is ready to the output
+ *   function, in parts of at most 16 KiB.
+ *
+ * Parameters:
+ *   encoder_stream_t *
+ *     The stream.
+ *   const char *
+ *     The input.
+ *   size_t
+ *     The length of the input.
+ *   int
+ *     (boolean) this is the end of the input: the remaining output is flushed
+ *     and the stream is finished.
+ *   encoder_output_t
+ *     The output function.
+ *   void *
+ *     The user data for the output function.
+ *
+ * Return Value:
+ *   (boolean) success status, false if the output function failed.
+ */
+int encoder_stream_write(encoder_stream_t *, const char *, size_t, int, encoder_output_t, void *);
+
+/**
+ * Description:
+ *   Destroys the stream, finished or not.
+ */
+void encoder_stream_destroy(encoder_stream_t *);
+
 #endif /* ENCODERS_H */
  
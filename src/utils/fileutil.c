@@ -15,8 +15,11 @@
 #define DT_DIR 4
 
 int secure_config_others(config_t config, secure_config_t *sconfig) {
-	sconfig->cipher_list = config_get(config, "tls-cipher-list");
-	sconfig->cipher_suites = config_get(config, "tls-cipher-suites");
+	/* duplicated, since the configuration is kept for reloading the certificates */
+	const char *cipher_list = config_get(config, "tls-cipher-list");
+	const char *cipher_suites = config_get(config, "tls-cipher-suites");
+	sconfig->cipher_list = cipher_list ? strdup(cipher_list) : NULL;
+	sconfig->cipher_suites = cipher_suites ? strdup(cipher_suites) : NULL;
 	
 	/* parse minimum protocol */
 	const char *protocols[] = { "tlsv1", "tls1.1", "tlsv1.2", "tlsv1.3" };
@@ -56,10 +59,63 @@ int secure_config_others(config_t config, secure_config_t *sconfig) {
 			}
 		} break;
 	}
+
+	/* Dynamic record sizing. 1369 = 1500 (MTU) - 40 (IPv6) - 20 (TCP) - 40 (TCP options) - 29 (TLS overhead) */
+	sconfig->record_size_small = config_get_size(config, "tls-record-size", 1369);
+	sconfig->record_boost_threshold = config_get_size(config, "tls-record-boost-threshold", 65536);
+	sconfig->record_idle_timeout = config_get_size(config, "tls-record-idle-timeout", 1000);
+	if (sconfig->record_size_small == 0 || sconfig->record_size_small > 16384) {
+		printf("[Config] tls-record-size must be between 1 and 16384, using 16384\n");
+		sconfig->record_size_small = 16384;
+	}
+
+	/* TLS 1.3 early data (0-RTT), disabled by default */
+	sconfig->early_data_max = config_get_size(config, "tls-early-data", 0);
+	sconfig->early_data_window = config_get_size(config, "tls-early-data-window", 300);
+
+	sconfig->certificate_compression = config_get_bool(config, "tls-certificate-compression", 1);
 	
 	return 1;
 }
 
+/* appends a certificate to the list, returns the new entry or NULL on failure */
+static secure_cert_t *secure_config_add_cert(secure_config_t *sconfig, const char *cert, const char *key, const char *chain) {
+	if (strlen(cert) >= PATH_MAX || strlen(key) >= PATH_MAX || (chain && strlen(chain) >= PATH_MAX)) {
+		printf("[Config] Certificate path too long: '%s'\n", cert);
+		return NULL;
+	}
+
+	secure_cert_t *certs = realloc(sconfig->certs, (sconfig->cert_count + 1) * sizeof(secure_cert_t));
+	if (!certs)
+		return NULL;
+	sconfig->certs = certs;
+
+	secure_cert_t *entry = &certs[sconfig->cert_count++];
+	strcpy(entry->cert, cert);
+	strcpy(entry->key, key);
+	strcpy(entry->chain, chain ? chain : "");
+	return entry;
+}
+
+static secure_config_t *secure_config_create(void) {
+	secure_config_t *sconfig = calloc(1, sizeof(secure_config_t));
+	if (!sconfig)
+		return NULL;
+	sconfig->ocsp_file = NULL;
+	sconfig->min_protocol_version = PROTOCOL_NULL;
+	return sconfig;
+}
+
+void secure_config_destroy(secure_config_t *sconfig) {
+	if (!sconfig)
+		return;
+	free(sconfig->certs);
+	free(sconfig->cipher_list);
+	free(sconfig->cipher_suites);
+	free(sconfig->ocsp_file);
+	free(sconfig);
+}
+
 secure_config_t *secure_config_manual(config_t config) {
 	const char *cert = config_get(config, "tls-cert");
 	const char *key = config_get(config, "tls-key");
@@ -75,15 +131,42 @@ secure_config_t *secure_config_manual(config_t config) {
 		return NULL;
 	}
 	
-	secure_config_t *sconfig = malloc(sizeof(secure_config_t));
-	sconfig->ocsp_file = NULL;
-	strcpy(sconfig->cert, cert);
-	strcpy(sconfig->chain, chain);
-	strcpy(sconfig->key, key);
+	secure_config_t *sconfig = secure_config_create();
+	if (!sconfig || !secure_config_add_cert(sconfig, cert, key, chain)) {
+		secure_config_destroy(sconfig);
+		return NULL;
+	}
+
+	/* additional certificates: "tls-certificate=<cert> <key> [chain]" */
+	size_t i;
+	for (i = 0; i < config.count; i++) {
+		if (strcmp(config.keys[i], "tls-certificate") != 0)
+			continue;
+
+		char *value = strdup(config.values[i]);
+		char *extra_cert = strtok(value, " ");
+		char *extra_key = strtok(NULL, " ");
+		char *extra_chain = strtok(NULL, " ");
+		if (!extra_cert || !extra_key) {
+			printf("[Config] Invalid tls-certificate value: '%s' (expected: \"cert key [chain]\")\n", config.values[i]);
+			free(value);
+			secure_config_destroy(sconfig);
+			return NULL;
+		}
+
+		if (!secure_config_add_cert(sconfig, extra_cert, extra_key, extra_chain)) {
+			free(value);
+			secure_config_destroy(sconfig);
+			return NULL;
+		}
+		free(value);
+	}
+
 	return sconfig;
 }
 
-/* this should return the entry "/etc/letsencrypt/live/example.org/" */
+/* every entry "/etc/letsencrypt/live/<name>/" is added, so both the RSA and
+ * ECDSA lineages (and all other domains) are served. */
 secure_config_t *secure_config_letsencrypt() {
 	DIR *dir;
 
@@ -94,40 +177,51 @@ secure_config_t *secure_config_letsencrypt() {
 		return NULL;
 	}
 
-	long name_max = pathconf(dirname, _PC_NAME_MAX);
-	if (name_max == -1)
-		name_max = NAME_MAX;
+	secure_config_t *sconfig = secure_config_create();
+	if (!sconfig) {
+		closedir(dir);
+		return NULL;
+	}
+
+	/* we're using string literals as arrays and using sizeof() which includes the null terminator */
+	char key_suffix[] = "/privkey.pem";
+	char chain_suffix[] = "/chain.pem";
+	char cert_suffix[] = "/fullchain.pem";
+
+	char cert[PATH_MAX];
+	char key[PATH_MAX];
+	char chain[PATH_MAX];
 
 	struct dirent *ent;
 
 	while ((ent = readdir(dir))) {
 		if (ent->d_type == DT_DIR && strcmp(ent->d_name, ".") && strcmp(ent->d_name, "..")) {
-			secure_config_t *sconfig = malloc(sizeof(secure_config_t));
-			sconfig->ocsp_file = NULL;
-			
-			char prefix[256];
-			
-			strcpy(prefix, dirname);
-			strcpy(prefix + sizeof(dirname) - 1, ent->d_name);
-			
-			/* we're using string literals as arrays and using sizeof() which includes the null terminator */
-			char key_suffix[] = "/privkey.pem";
-			char chain_suffix[] = "/chain.pem";
-			char cert_suffix[] = "/fullchain.pem";
-			
 			size_t prefix_size = sizeof(dirname) + strlen(ent->d_name) - 1;
-			memcpy(sconfig->cert,	prefix, prefix_size);
-			memcpy(sconfig->key,		prefix, prefix_size);
-			memcpy(sconfig->chain, prefix, prefix_size);
-			memcpy(sconfig->cert		+ prefix_size, cert_suffix, sizeof(cert_suffix));
-			memcpy(sconfig->key		+ prefix_size, key_suffix, sizeof(key_suffix));
-			memcpy(sconfig->chain	+ prefix_size, chain_suffix, sizeof(chain_suffix));
-	
-			closedir(dir);
-			return sconfig;
+			if (prefix_size + sizeof(cert_suffix) > PATH_MAX)
+				continue;
+
+			memcpy(cert, dirname, sizeof(dirname) - 1);
+			memcpy(cert + sizeof(dirname) - 1, ent->d_name, prefix_size - sizeof(dirname) + 1);
+			memcpy(key, cert, prefix_size);
+			memcpy(chain, cert, prefix_size);
+			memcpy(cert		+ prefix_size, cert_suffix, sizeof(cert_suffix));
+			memcpy(key		+ prefix_size, key_suffix, sizeof(key_suffix));
+			memcpy(chain	+ prefix_size, chain_suffix, sizeof(chain_suffix));
+
+			if (!secure_config_add_cert(sconfig, cert, key, chain)) {
+				closedir(dir);
+				secure_config_destroy(sconfig);
+				return NULL;
+			}
 		}
 	}
 
 	closedir(dir);
-	return NULL;
-} 
+
+	if (sconfig->cert_count == 0) {
+		puts("[Config] No certificates found in the Letsencrypt directory!");
+		secure_config_destroy(sconfig);
+		return NULL;
+	}
+	return sconfig;
+}
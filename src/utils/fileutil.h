@@ -16,22 +16,50 @@ typedef enum protocol_t {
 	PROTOCOL_TLS1_3 = 3
 } protocol_t;
 
-typedef struct secure_config_t {
+typedef struct secure_cert_t {
 	/* (non-null) Path to the certificate. */
 	char cert[PATH_MAX];
-	/* (nullable) Path to the intermediates. */
+	/* (nullable) Path to the intermediates. An empty string means no chain file. */
 	char chain[PATH_MAX];
 	/* (non-null) Path to the private key. */
 	char key[PATH_MAX];
+} secure_cert_t;
+
+typedef struct secure_config_t {
+	/* The certificates to serve. The first one is used when the client doesn't
+	 * send a (known) SNI host name. Certificates with the same host names but
+	 * a different key type (e.g. ECDSA and RSA) are served from the same
+	 * context, so OpenSSL can pick the one the client supports. */
+	secure_cert_t *certs;
+	size_t cert_count;
 	
 	/* (nullable) List with enabled protocols. */
 	protocol_t min_protocol_version;
 	/* (nullable) List with enabled ciphers. (TLS 1.3 and below) */
-	const char *cipher_list;
+	char *cipher_list;
 	/* (nullable) List with enabled ciphers suites. (TLS 1.3 and above) */
-	const char *cipher_suites;
+	char *cipher_suites;
 	
 	char *ocsp_file;
+
+	/* Dynamic record sizing: a new or idle connection is sent records of
+	 * 'record_size_small' bytes (one record per TCP segment), until
+	 * 'record_boost_threshold' bytes are sent. After that, records are as big
+	 * as possible. An idle period of 'record_idle_timeout' milliseconds resets
+	 * this, since the congestion window shrinks when idle. */
+	size_t record_size_small;
+	size_t record_boost_threshold;
+	size_t record_idle_timeout;
+
+	/* The maximum amount of TLS 1.3 early data (0-RTT) accepted from a
+	 * resuming client, 0 disables early data. Only tickets issued less than
+	 * 'early_data_window' seconds ago can be used for early data. */
+	size_t early_data_max;
+	size_t early_data_window;
+
+	/* (boolean) Compress the certificate chains (RFC 8879) once at setup,
+	 * for clients that support it. */
+	int certificate_compression;
 } secure_config_t;
 
 /**
@@ -70,4 +98,15 @@ secure_config_t *secure_config_manual(config_t);
  */
 int secure_config_others(config_t, secure_config_t *);
 
+/**
+ * Description:
+ *   This function will destroy the configuration created by secure_config_manual
+ *   or secure_config_letsencrypt, including the data set by secure_config_others.
+ *
+ * Parameters:
+ *   secure_config_t *
+ *     The configuration to destroy. This can be NULL.
+ */
+void secure_config_destroy(secure_config_t *);
+
 #endif /* FILE_UTIL_H */
@@ -9,14 +9,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-int io_read_until(TLS source, char *dest, char until, size_t max) {
+int io_read_until(transport_t *source, char *dest, char until, size_t max) {
 	char *buffer = malloc(1);
 	buffer[0] = 0;
 
 	size_t pos = 0;
 	do {
-		if (!tls_read_client(source, buffer, 1)) {
-			puts("failed to read from tls_read");
+		if (!transport_read(source, buffer, 1)) {
+			puts("failed to read from transport_read");
 			return -2;
 		}
 
@@ -7,15 +7,15 @@
 
 #include <stddef.h>
 
-#include "secure/tlsutil.h"
+#include "transport/transport.h"
 /**
  * Description:
  *   This function will read from the source until a specific character 
  *   is encountered, OR the maximum size of bytes read has been reached.
  * 
  * Parameters:
- *   TLS
- *     The TLS source to be read from.
+ *   transport_t *
+ *     The transport to be read from.
  *   char *
  *     The destination buffer.
  *   char
@@ -28,6 +28,6 @@
  *   -1 maximum read-size reached
  *  >=0 success, the length of the string, excluding the NULL-terminator
  */
-int io_read_until(TLS, char *, char, size_t);
+int io_read_until(transport_t *, char *, char, size_t);
 
 #endif /* UTILS_IO_H */
@@ -7,8 +7,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 
+#include "mime_table.h"
+#include "perfect_hash.h"
 #include "util.h"
 
 static const char *const MIME_TYPE_javascript = "application/javascript";
@@ -21,183 +22,165 @@ static const char *scripting_media_types[] = {
 	"application/ecmascript"
 };
 
-static const char *ext[] = {
-	"aac",
-	"avi",
-	"bin",
-	"bz",
-	"bz2",
-	"c",
-	"cpp",
-	"css",
-	"csv",
-	"doc",
-	"docx",
-	"gif",
-	"gz",
-	"htm",
-	"html",
-	"ico",
-	"ics",
-	"jar",
-	"jfif",
-	"jpg",
-	"jpeg",
-	"js",
-	"json",
-	"mp3",
-	"mpeg",
-	"mpkg",
-	"odg",
-	"odp",
-	"odt",
-	"oga",
-	"ogg",
-	"ogv",
-	"ogx",
-	"opus",
-	"otf",
-	"png",
-	"pdf",
-	"ppt",
-	"pptx",
-	"rar",
-	"rtf",
-	"sh",
-	"so",
-	"svg",
-	"svgz",
-	"tar",
-	"tif",
-	"tiff",
-	"ttf",
-	"txt",
-	"wav",
-	"weba",
-	"webm",
-	"webp",
-	"webmanifest",
-	"woff",
-	"woff2",
-	"xhtml",
-	"xlsx",
-	"xml",
-	"zip",
-	"7z"
-};
+/* the size of a line of a mime.types file */
+#define MIME_LINE_MAX 1024
+/* the initial amount of slots of the loaded table, a power of two */
+#define MIME_LOADED_INITIAL_SIZE 256
 
-static const char *mimes[] = {
-	"audio/aac",
-	"video/x-msvideo",
-	"application/octet-stream",
-	"application/x-bzip",
-	"application/x-bzip2",
-	"text/plain", /* is there a better option? */
-	"text/plain", /* is there a better option? */
-	"text/css",
-	"text/csv",
-	"application/msword",
-	"application/vnd.openxmlformats-officedocument.wordprocessingml.document",
-	"image/gif",
-	"application/gzip",
-	"text/html",
-	"text/html",
-	"image/vnd.microsoft.icon",
-	"application/java-archive",
-	"text/calendar",
-	"image/jpeg",
-	"image/jpeg",
-	"image/jpeg",
-	MIME_TYPE_javascript,
-	"application/json",
-	"audio/mpeg",
-	"video/mpeg",
-	"application/vnd.apple.installer+xml",
-	"application/vnd.oasis.opendocument.graphics",
-	"application/vnd.oasis.opendocument.presentation",
-	"application/vnd.oasis.opendocument.text",
-	"audio/ogg",
-	"application/ogg",
-	"video/ogg",
-	"application/ogg",
-	"audio/opus",
-	"font/otf",
-	"image/png",
-	"application/vnd.ms-powerpoint",
-	"application/vnd.openxmlformats-officedocument.presentationml.presentation",
-	"application/pdf",
-	"application/vnd.rar",
-	"application/rtf",
-	"application/x-sh",
-	"application/octet-stream",
-	"image/svg+xml",
-	"image/svg+xml",
-	"application/x-tar",
-	"image/tiff",
-	"image/tiff",
-	"font/ttf",
-	"text/plain",
-	"audio/wav",
-	"audio/webm",
-	"video/webm",
-	"image/webp",
-	"application/manifest+json",
-	"font/woff",
-	"font/woff2",
-	"application/xhtml+xml",
-	"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",
-	"application/xml",
-	"application/zip",
-	"application/x-7z-compressed",
-};
+typedef struct {
+	/* lowercase, NULL for an empty slot */
+	char *extension;
+	size_t length;
+	char *type;
+} mime_entry_t;
+
+/* the types of the mime.types file, an open addressing hash table with
+ * linear probing that is at most half full */
+static mime_entry_t *loaded;
+static size_t loaded_size;
+static size_t loaded_count;
 
 void mime_test_print(void) {
 	size_t i;
-	for (i = 0; i < sizeof(ext)/sizeof(ext[0]); i++) {
+	for (i = 0; i < MIME_EXTENSION_COUNT; i++) {
 		printf("%zu ", i);
-		printf("%s > %s\n", ext[i], mimes[i]);
+		printf("%s > %s\n", mime_extension_words[i], mime_extension_values[i]);
 	}
 }
 
-static const char *strchrlast(const char *str, char occ) {
+static mime_entry_t *loaded_find(const char *extension, size_t length) {
+	size_t slot = perfect_hash(extension, length, 0, 1) & (loaded_size - 1);
+	while (loaded[slot].extension) {
+		if (loaded[slot].length == length && perfect_hash_equal_fold(extension, loaded[slot].extension, length))
+			return &loaded[slot];
+		slot = (slot + 1) & (loaded_size - 1);
+	}
+	return &loaded[slot];
+}
+
+/* (boolean) doubles the size of the loaded table */
+static int loaded_grow(void) {
+	mime_entry_t *old = loaded;
+	size_t old_size = loaded_size, i;
+	loaded_size = old_size ? old_size * 2 : MIME_LOADED_INITIAL_SIZE;
+	loaded = calloc(loaded_size, sizeof(mime_entry_t));
+	if (!loaded) {
+		loaded = old;
+		loaded_size = old_size;
+		return 0;
+	}
+	for (i = 0; i < old_size; i++)
+		if (old[i].extension)
+			*loaded_find(old[i].extension, old[i].length) = old[i];
+	free(old);
+	return 1;
+}
+
+/* (boolean) adds the extension, the first type of an extension is kept */
+static int loaded_add(const char *extension, size_t length, const char *type) {
+	if ((loaded_count + 1) * 2 > loaded_size && !loaded_grow())
+		return 0;
+
+	mime_entry_t *entry = loaded_find(extension, length);
+	if (entry->extension)
+		return 1;
+	entry->extension = malloc(length + 1);
+	entry->type = strdup(type);
+	if (!entry->extension || !entry->type) {
+		free(entry->extension);
+		free(entry->type);
+		entry->extension = NULL;
+		return 0;
+	}
 	size_t i;
-	for (i = strlen(str); i > 0; i--) {
-		if (str[i-1] == occ)
-			return str + i - 1;
+	for (i = 0; i < length; i++)
+		entry->extension[i] = extension[i] >= 'A' && extension[i] <= 'Z' ? extension[i] | 0x20 : extension[i];
+	entry->extension[length] = 0;
+	entry->length = length;
+	loaded_count += 1;
+	return 1;
+}
+
+int mime_setup(const char *file_name) {
+	if (!file_name)
+		return 1;
+
+	FILE *file = fopen(file_name, "r");
+	if (!file) {
+		printf("[Config] Failed to open mime-types file: %s\n", file_name);
+		return 0;
 	}
-	return NULL;
+
+	/* "type extension..." per line, see mime.types(5) */
+	char line[MIME_LINE_MAX];
+	const char *whitespace = " \t\r\n";
+	int success = 1;
+	while (success && fgets(line, sizeof(line), file)) {
+		char *type = line + strspn(line, whitespace);
+		if (*type == '#' || *type == 0)
+			continue;
+		char *extension = type + strcspn(type, whitespace);
+		if (*extension == 0)
+			continue;
+		*extension++ = 0;
+
+		while (success && *(extension += strspn(extension, whitespace))) {
+			size_t length = strcspn(extension, whitespace);
+			success = loaded_add(extension, length, type);
+			extension += length;
+		}
+	}
+	fclose(file);
+
+	if (!success) {
+		puts("[Config] Failed to load the mime-types file: out of memory");
+		mime_destroy();
+		return 0;
+	}
+	return 1;
 }
 
-const char *mime_from_path(const char *path, int *charset) {
-	const char *dot = strchrlast(path, '.');
-	if (!dot)
-		return NULL;
+void mime_destroy(void) {
+	size_t i;
+	for (i = 0; i < loaded_size; i++) {
+		free(loaded[i].extension);
+		free(loaded[i].type);
+	}
+	free(loaded);
+	loaded = NULL;
+	loaded_size = loaded_count = 0;
+}
 
-	size_t extlen = strlen(path) - (dot - path);
-	char *extdup = malloc(extlen);
+static int mime_has_charset(const char *type) {
 	size_t i;
-	for (i = 0; i < extlen-1; i++)
-		extdup[i] = tolower(dot[i+1]);
-	extdup[extlen-1] = 0;
+	if (!strncmp(type, "text/", 5))
+		return 1;
+	for (i = 0; i < sizeof(scripting_media_types) / sizeof(scripting_media_types[0]); i++)
+		if (!strcmp(type, scripting_media_types[i]))
+			return 1;
+	return 0;
+}
 
-	int pos = strswitch(extdup, ext, sizeof(ext)/sizeof(ext[0]), CASEFLAG_DONT_IGNORE);
-	free(extdup);
-	if (pos == -1)
+const char *mime_from_path(const char *path, int *charset) {
+	const char *dot = strrchr(path, '.');
+	if (!dot)
 		return NULL;
 
-	if (charset) {
-		if (strstartsw(mimes[pos], "text/"))
-			*charset = 1;
-		else {
-			*charset = 0;
-			for (i = 0; i < sizeof(scripting_media_types) / sizeof(scripting_media_types[0]); i++) {
-				/* we can use == on pointers because they are the same */
-				if (mimes[pos] == scripting_media_types[i]) {
-					*charset = 1;
-					break;
-				}
-			}
-		}
+	const char *extension = dot + 1;
+	size_t length = strlen(extension);
+	const char *type = NULL;
+	if (loaded_count) {
+		mime_entry_t *entry = loaded_find(extension, length);
+		type = entry->type;
 	}
-	return mimes[pos];
+	if (!type) {
+		int index = mime_extension_lookup(extension, length);
+		if (index < 0)
+			return NULL;
+		type = mime_extension_values[index];
+	}
+
+	if (charset)
+		*charset = mime_has_charset(type);
+	return type;
 }
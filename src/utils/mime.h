@@ -7,9 +7,31 @@
 
 void mime_test_print(void);
 
+/**
+ * Description:
+ *   Loads a mime.types file: every line is a MIME type followed by its
+ *   extensions. These types are used before the built-in ones
+ *   (mime_types.txt).
+ *
+ * Parameters:
+ *   const char *
+ *     (nullable) The path of the file, nothing is loaded if NULL.
+ *
+ * Return value:
+ *   (boolean) success status
+ */
+int mime_setup(const char *);
+
+/**
+ * Description:
+ *   Destroys the types loaded by mime_setup.
+ */
+void mime_destroy(void);
+
 /**
  * Description:
  *   This function will try to find the mime type based off the file path.
+ *   The extension is looked up case-insensitively, without copying it.
  * 
  * Parameters:
  *   char *
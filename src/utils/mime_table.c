@@ -0,0 +1,272 @@
+/**
+ * Generated by tools/perfect-hash.c from src/utils/mime_types.txt, don't edit.
+ * 62 words in 256 slots, seed 1386.
+ */
+#include "mime_table.h"
+
+#include <string.h>
+
+#include "utils/perfect_hash.h"
+
+const char *const mime_extension_words[MIME_EXTENSION_COUNT] = {
+	"aac",
+	"avi",
+	"bin",
+	"bz",
+	"bz2",
+	"c",
+	"cpp",
+	"css",
+	"csv",
+	"doc",
+	"docx",
+	"gif",
+	"gz",
+	"htm",
+	"html",
+	"ico",
+	"ics",
+	"jar",
+	"jfif",
+	"jpg",
+	"jpeg",
+	"js",
+	"json",
+	"mp3",
+	"mpeg",
+	"mpkg",
+	"odg",
+	"odp",
+	"odt",
+	"oga",
+	"ogg",
+	"ogv",
+	"ogx",
+	"opus",
+	"otf",
+	"png",
+	"pdf",
+	"ppt",
+	"pptx",
+	"rar",
+	"rtf",
+	"sh",
+	"so",
+	"svg",
+	"svgz",
+	"tar",
+	"tif",
+	"tiff",
+	"ttf",
+	"txt",
+	"wav",
+	"weba",
+	"webm",
+	"webp",
+	"webmanifest",
+	"woff",
+	"woff2",
+	"xhtml",
+	"xlsx",
+	"xml",
+	"zip",
+	"7z"
+};
+
+const char *const mime_extension_values[MIME_EXTENSION_COUNT] = {
+	"audio/aac",
+	"video/x-msvideo",
+	"application/octet-stream",
+	"application/x-bzip",
+	"application/x-bzip2",
+	"text/plain",
+	"text/plain",
+	"text/css",
+	"text/csv",
+	"application/msword",
+	"application/vnd.openxmlformats-officedocument.wordprocessingml.document",
+	"image/gif",
+	"application/gzip",
+	"text/html",
+	"text/html",
+	"image/vnd.microsoft.icon",
+	"text/calendar",
+	"application/java-archive",
+	"image/jpeg",
+	"image/jpeg",
+	"image/jpeg",
+	"application/javascript",
+	"application/json",
+	"audio/mpeg",
+	"video/mpeg",
+	"application/vnd.apple.installer+xml",
+	"application/vnd.oasis.opendocument.graphics",
+	"application/vnd.oasis.opendocument.presentation",
+	"application/vnd.oasis.opendocument.text",
+	"audio/ogg",
+	"application/ogg",
+	"video/ogg",
+	"application/ogg",
+	"audio/opus",
+	"font/otf",
+	"image/png",
+	"application/pdf",
+	"application/vnd.ms-powerpoint",
+	"application/vnd.openxmlformats-officedocument.presentationml.presentation",
+	"application/vnd.rar",
+	"application/rtf",
+	"application/x-sh",
+	"application/octet-stream",
+	"image/svg+xml",
+	"image/svg+xml",
+	"application/x-tar",
+	"image/tiff",
+	"image/tiff",
+	"font/ttf",
+	"text/plain",
+	"audio/wav",
+	"audio/webm",
+	"video/webm",
+	"image/webp",
+	"application/manifest+json",
+	"font/woff",
+	"font/woff2",
+	"application/xhtml+xml",
+	"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",
+	"application/xml",
+	"application/zip",
+	"application/x-7z-compressed"
+};
+
+int mime_extension_lookup(const char *word, size_t length) {
+	if (length < 1 || length > 11)
+		return -1;
+	switch (perfect_hash(word, length, 1386UL, 1) & 255UL) {
+		case 0:
+			return length == 3 && perfect_hash_equal_fold(word, "pdf", 3) ? 36 : -1;
+		case 1:
+			return length == 3 && perfect_hash_equal_fold(word, "txt", 3) ? 49 : -1;
+		case 2:
+			return length == 3 && perfect_hash_equal_fold(word, "png", 3) ? 35 : -1;
+		case 4:
+			return length == 3 && perfect_hash_equal_fold(word, "mp3", 3) ? 23 : -1;
+		case 10:
+			return length == 4 && perfect_hash_equal_fold(word, "webm", 4) ? 52 : -1;
+		case 22:
+			return length == 2 && perfect_hash_equal_fold(word, "7z", 2) ? 61 : -1;
+		case 23:
+			return length == 3 && perfect_hash_equal_fold(word, "ogv", 3) ? 31 : -1;
+		case 25:
+			return length == 3 && perfect_hash_equal_fold(word, "gif", 3) ? 11 : -1;
+		case 29:
+			return length == 3 && perfect_hash_equal_fold(word, "rar", 3) ? 39 : -1;
+		case 33:
+			return length == 3 && perfect_hash_equal_fold(word, "ttf", 3) ? 48 : -1;
+		case 36:
+			return length == 4 && perfect_hash_equal_fold(word, "jpeg", 4) ? 20 : -1;
+		case 37:
+			return length == 4 && perfect_hash_equal_fold(word, "docx", 4) ? 10 : -1;
+		case 39:
+			return length == 4 && perfect_hash_equal_fold(word, "weba", 4) ? 51 : -1;
+		case 46:
+			return length == 4 && perfect_hash_equal_fold(word, "pptx", 4) ? 38 : -1;
+		case 48:
+			return length == 3 && perfect_hash_equal_fold(word, "odt", 3) ? 28 : -1;
+		case 50:
+			return length == 4 && perfect_hash_equal_fold(word, "tiff", 4) ? 47 : -1;
+		case 54:
+			return length == 5 && perfect_hash_equal_fold(word, "xhtml", 5) ? 57 : -1;
+		case 61:
+			return length == 3 && perfect_hash_equal_fold(word, "ppt", 3) ? 37 : -1;
+		case 64:
+			return length == 2 && perfect_hash_equal_fold(word, "gz", 2) ? 12 : -1;
+		case 65:
+			return length == 3 && perfect_hash_equal_fold(word, "svg", 3) ? 43 : -1;
+		case 70:
+			return length == 4 && perfect_hash_equal_fold(word, "mpkg", 4) ? 25 : -1;
+		case 71:
+			return length == 4 && perfect_hash_equal_fold(word, "svgz", 4) ? 44 : -1;
+		case 76:
+			return length == 5 && perfect_hash_equal_fold(word, "woff2", 5) ? 56 : -1;
+		case 81:
+			return length == 4 && perfect_hash_equal_fold(word, "jfif", 4) ? 18 : -1;
+		case 92:
+			return length == 1 && perfect_hash_equal_fold(word, "c", 1) ? 5 : -1;
+		case 96:
+			return length == 3 && perfect_hash_equal_fold(word, "ics", 3) ? 16 : -1;
+		case 100:
+			return length == 3 && perfect_hash_equal_fold(word, "css", 3) ? 7 : -1;
+		case 115:
+			return length == 4 && perfect_hash_equal_fold(word, "webp", 4) ? 53 : -1;
+		case 120:
+			return length == 4 && perfect_hash_equal_fold(word, "opus", 4) ? 33 : -1;
+		case 126:
+			return length == 3 && perfect_hash_equal_fold(word, "odg", 3) ? 26 : -1;
+		case 129:
+			return length == 11 && perfect_hash_equal_fold(word, "webmanifest", 11) ? 54 : -1;
+		case 132:
+			return length == 3 && perfect_hash_equal_fold(word, "xml", 3) ? 59 : -1;
+		case 135:
+			return length == 3 && perfect_hash_equal_fold(word, "jar", 3) ? 17 : -1;
+		case 137:
+			return length == 4 && perfect_hash_equal_fold(word, "woff", 4) ? 55 : -1;
+		case 138:
+			return length == 3 && perfect_hash_equal_fold(word, "aac", 3) ? 0 : -1;
+		case 139:
+			return length == 3 && perfect_hash_equal_fold(word, "oga", 3) ? 29 : -1;
+		case 153:
+			return length == 4 && perfect_hash_equal_fold(word, "html", 4) ? 14 : -1;
+		case 156:
+			return length == 4 && perfect_hash_equal_fold(word, "xlsx", 4) ? 58 : -1;
+		case 165:
+			return length == 3 && perfect_hash_equal_fold(word, "ogx", 3) ? 32 : -1;
+		case 177:
+			return length == 3 && perfect_hash_equal_fold(word, "rtf", 3) ? 40 : -1;
+		case 180:
+			return length == 3 && perfect_hash_equal_fold(word, "cpp", 3) ? 6 : -1;
+		case 183:
+			return length == 3 && perfect_hash_equal_fold(word, "wav", 3) ? 50 : -1;
+		case 184:
+			return length == 3 && perfect_hash_equal_fold(word, "bz2", 3) ? 4 : -1;
+		case 187:
+			return length == 3 && perfect_hash_equal_fold(word, "jpg", 3) ? 19 : -1;
+		case 191:
+			return length == 2 && perfect_hash_equal_fold(word, "sh", 2) ? 41 : -1;
+		case 195:
+			return length == 3 && perfect_hash_equal_fold(word, "htm", 3) ? 13 : -1;
+		case 197:
+			return length == 3 && perfect_hash_equal_fold(word, "bin", 3) ? 2 : -1;
+		case 202:
+			return length == 4 && perfect_hash_equal_fold(word, "mpeg", 4) ? 24 : -1;
+		case 215:
+			return length == 2 && perfect_hash_equal_fold(word, "so", 2) ? 42 : -1;
+		case 218:
+			return length == 3 && perfect_hash_equal_fold(word, "doc", 3) ? 9 : -1;
+		case 219:
+			return length == 3 && perfect_hash_equal_fold(word, "tif", 3) ? 46 : -1;
+		case 224:
+			return length == 3 && perfect_hash_equal_fold(word, "ico", 3) ? 15 : -1;
+		case 231:
+			return length == 3 && perfect_hash_equal_fold(word, "zip", 3) ? 60 : -1;
+		case 232:
+			return length == 2 && perfect_hash_equal_fold(word, "js", 2) ? 21 : -1;
+		case 234:
+			return length == 3 && perfect_hash_equal_fold(word, "ogg", 3) ? 30 : -1;
+		case 235:
+			return length == 3 && perfect_hash_equal_fold(word, "csv", 3) ? 8 : -1;
+		case 237:
+			return length == 4 && perfect_hash_equal_fold(word, "json", 4) ? 22 : -1;
+		case 243:
+			return length == 3 && perfect_hash_equal_fold(word, "tar", 3) ? 45 : -1;
+		case 244:
+			return length == 2 && perfect_hash_equal_fold(word, "bz", 2) ? 3 : -1;
+		case 246:
+			return length == 3 && perfect_hash_equal_fold(word, "otf", 3) ? 34 : -1;
+		case 247:
+			return length == 3 && perfect_hash_equal_fold(word, "avi", 3) ? 1 : -1;
+		case 254:
+			return length == 3 && perfect_hash_equal_fold(word, "odp", 3) ? 27 : -1;
+		default:
+			return -1;
+	}
+}
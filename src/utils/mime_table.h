@@ -0,0 +1,96 @@
+/**
+ * Generated by tools/perfect-hash.c from src/utils/mime_types.txt, don't edit.
+ */
+#ifndef MIME_EXTENSION_TABLE_H
+#define MIME_EXTENSION_TABLE_H
+
+#include <stddef.h>
+
+#define MIME_EXTENSION_COUNT 62
+#define MIME_EXTENSION_LENGTH_MAX 11
+
+/* the indices of the words */
+#define MIME_EXTENSION_AAC 0
+#define MIME_EXTENSION_AVI 1
+#define MIME_EXTENSION_BIN 2
+#define MIME_EXTENSION_BZ 3
+#define MIME_EXTENSION_BZ2 4
+#define MIME_EXTENSION_C 5
+#define MIME_EXTENSION_CPP 6
+#define MIME_EXTENSION_CSS 7
+#define MIME_EXTENSION_CSV 8
+#define MIME_EXTENSION_DOC 9
+#define MIME_EXTENSION_DOCX 10
+#define MIME_EXTENSION_GIF 11
+#define MIME_EXTENSION_GZ 12
+#define MIME_EXTENSION_HTM 13
+#define MIME_EXTENSION_HTML 14
+#define MIME_EXTENSION_ICO 15
+#define MIME_EXTENSION_ICS 16
+#define MIME_EXTENSION_JAR 17
+#define MIME_EXTENSION_JFIF 18
+#define MIME_EXTENSION_JPG 19
+#define MIME_EXTENSION_JPEG 20
+#define MIME_EXTENSION_JS 21
+#define MIME_EXTENSION_JSON 22
+#define MIME_EXTENSION_MP3 23
+#define MIME_EXTENSION_MPEG 24
+#define MIME_EXTENSION_MPKG 25
+#define MIME_EXTENSION_ODG 26
+#define MIME_EXTENSION_ODP 27
+#define MIME_EXTENSION_ODT 28
+#define MIME_EXTENSION_OGA 29
+#define MIME_EXTENSION_OGG 30
+#define MIME_EXTENSION_OGV 31
+#define MIME_EXTENSION_OGX 32
+#define MIME_EXTENSION_OPUS 33
+#define MIME_EXTENSION_OTF 34
+#define MIME_EXTENSION_PNG 35
+#define MIME_EXTENSION_PDF 36
+#define MIME_EXTENSION_PPT 37
+#define MIME_EXTENSION_PPTX 38
+#define MIME_EXTENSION_RAR 39
+#define MIME_EXTENSION_RTF 40
+#define MIME_EXTENSION_SH 41
+#define MIME_EXTENSION_SO 42
+#define MIME_EXTENSION_SVG 43
+#define MIME_EXTENSION_SVGZ 44
+#define MIME_EXTENSION_TAR 45
+#define MIME_EXTENSION_TIF 46
+#define MIME_EXTENSION_TIFF 47
+#define MIME_EXTENSION_TTF 48
+#define MIME_EXTENSION_TXT 49
+#define MIME_EXTENSION_WAV 50
+#define MIME_EXTENSION_WEBA 51
+#define MIME_EXTENSION_WEBM 52
+#define MIME_EXTENSION_WEBP 53
+#define MIME_EXTENSION_WEBMANIFEST 54
+#define MIME_EXTENSION_WOFF 55
+#define MIME_EXTENSION_WOFF2 56
+#define MIME_EXTENSION_XHTML 57
+#define MIME_EXTENSION_XLSX 58
+#define MIME_EXTENSION_XML 59
+#define MIME_EXTENSION_ZIP 60
+#define MIME_EXTENSION_7Z 61
+
+/* the words, in the order of src/utils/mime_types.txt */
+extern const char *const mime_extension_words[MIME_EXTENSION_COUNT];
+/* the values of the words, or NULL */
+extern const char *const mime_extension_values[MIME_EXTENSION_COUNT];
+
+/**
+ * Description:
+ *   Finds the word, case-insensitively.
+ *
+ * Parameters:
+ *   const char *
+ *     The word, it doesn't have to be null-terminated.
+ *   size_t
+ *     The length of the word.
+ *
+ * Return Value:
+ *   The index of the word in mime_extension_words, or -1
+ */
+int mime_extension_lookup(const char *, size_t);
+
+#endif /* MIME_EXTENSION_TABLE_H */
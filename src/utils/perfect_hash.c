@@ -0,0 +1,33 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * For information about these functions/symbols, see perfect_hash.h
+ */
+#include "perfect_hash.h"
+
+unsigned long perfect_hash(const char *word, size_t length, unsigned long seed, int fold_case) {
+	unsigned long hash = (2166136261UL ^ seed) & 0xFFFFFFFFUL;
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned char character = word[i];
+		if (fold_case && character >= 'A' && character <= 'Z')
+			character |= 0x20;
+		hash = ((hash ^ character) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	hash ^= hash >> 15;
+	hash = (hash * 0x2C1B3C6DUL) & 0xFFFFFFFFUL;
+	return hash ^ (hash >> 12);
+}
+
+int perfect_hash_equal_fold(const char *word, const char *lowercase, size_t length) {
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned char character = word[i];
+		if (character >= 'A' && character <= 'Z')
+			character |= 0x20;
+		if (character != (unsigned char) lowercase[i])
+			return 0;
+	}
+	return 1;
+}
@@ -0,0 +1,45 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * This file contains the hash function of the lookup tables generated by
+ * tools/perfect-hash.c, for fixed vocabularies like the HTTP methods and the
+ * file extensions of the MIME types. The generator searches a seed for which
+ * every word gets its own slot, so a lookup hashes once and compares once.
+ */
+#ifndef UTILS_PERFECT_HASH_H
+#define UTILS_PERFECT_HASH_H
+
+#include <stddef.h>
+
+/**
+ * Description:
+ *   Hashes the word (FNV-1a, followed by a final mix so the low bits depend
+ *   on every byte).
+ *
+ * Parameters:
+ *   const char *
+ *     The word.
+ *   size_t
+ *     The length of the word.
+ *   unsigned long
+ *     The seed.
+ *   int
+ *     (boolean) ASCII uppercase letters are hashed as lowercase letters.
+ *
+ * Return Value:
+ *   The hash, 32 bits.
+ */
+unsigned long perfect_hash(const char *, size_t, unsigned long, int);
+
+/**
+ * Description:
+ *   Compares the word to a lowercase word of the same length, ignoring the
+ *   case of ASCII letters in the first.
+ *
+ * Return Value:
+ *   (boolean) the words are equal
+ */
+int perfect_hash_equal_fold(const char *, const char *, size_t);
+
+#endif /* UTILS_PERFECT_HASH_H */
@@ -0,0 +1,388 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the frame reader and compares it with readfr, which it replaced (see
+ * the history of frame.c). readfr allocated every frame and a scratch buffer,
+ * read the header with four reads and allocated the payload. The frames are
+ * read from a transport in memory, which returns at most a TLS record per
+ * read, so only the reading and parsing of the frames is measured. The
+ * frames are those of a browser that uploads a file: DATA frames, with the
+ * PINGs, WINDOW_UPDATEs, SETTINGS and HEADERS of other requests in between.
+ *
+ * Usage: ./testbin [-n frames]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http2/frame.h"
+#include "transport/transport.h"
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/** The transport **/
+/* the frames that are read, they are read again from the start when
+ * 'repeat' is set */
+static char stream[262144];
+static size_t stream_length;
+static size_t stream_position;
+static int repeat;
+/* the most a read returns, like a TLS record */
+static size_t record_size = 16384;
+static size_t read_calls;
+
+static int memory_read(transport_t *transport, char *buffer, size_t length) {
+	if (stream_position == stream_length) {
+		if (!repeat)
+			return 0;
+		stream_position = 0;
+	}
+	if (length > stream_length - stream_position)
+		length = stream_length - stream_position;
+	if (length > record_size)
+		length = record_size;
+	memcpy(buffer, stream + stream_position, length);
+	stream_position += length;
+	read_calls += 1;
+	return length;
+}
+
+static int memory_write(transport_t *transport, const char *buffer, size_t length) {
+	return 1;
+}
+
+static void memory_close(transport_t *transport) {
+	/* nothing to destroy */
+}
+
+static transport_protocol_t memory_get_protocol(transport_t *transport) {
+	return TRANSPORT_PROTOCOL_HTTP2;
+}
+
+static const transport_ops_t memory_ops = {
+	"memory",
+	memory_read,
+	memory_write,
+	memory_close,
+	memory_get_protocol,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+static void stream_reset(void) {
+	stream_length = 0;
+	stream_position = 0;
+	repeat = 0;
+}
+
+/* appends a frame, the payload is a pattern of its type and its length */
+static void stream_add(uint32_t length, char type, char flags, uint32_t stream_id) {
+	char *header = stream + stream_length;
+	header[0] = length >> 16;
+	header[1] = length >> 8;
+	header[2] = length;
+	header[3] = type;
+	header[4] = flags;
+	header[5] = stream_id >> 24;
+	header[6] = stream_id >> 16;
+	header[7] = stream_id >> 8;
+	header[8] = stream_id;
+	size_t i;
+	for (i = 0; i < length; i++)
+		header[FRAME_HEADER_SIZE + i] = type + length + i;
+	stream_length += FRAME_HEADER_SIZE + length;
+}
+
+static int payload_matches(const frame_t *frame) {
+	size_t i;
+	for (i = 0; i < frame->length; i++)
+		if (frame->data[i] != (char) (frame->type + frame->length + i))
+			return 0;
+	return 1;
+}
+
+/* the frames of a browser that uploads a file while it loads a page */
+static size_t stream_add_upload(void) {
+	size_t frames = 0;
+	size_t i;
+	for (i = 0; i < 8; i++) {
+		stream_add(16384, FRAME_DATA, 0, 1);
+		stream_add(4, FRAME_WINDOW_UPDATE, 0, 0);
+		stream_add(8, FRAME_PING, 0, 0);
+		stream_add(120 + i, FRAME_HEADERS, FLAG_END_HEADERS | FLAG_END_STREAM, 3 + 2 * i);
+		stream_add(4, FRAME_WINDOW_UPDATE, 0, 3 + 2 * i);
+		stream_add(0, FRAME_SETTINGS, FLAG_ACK, 0);
+		stream_add(5, FRAME_PRIORITY, 0, 3 + 2 * i);
+		stream_add(1000 + i, FRAME_DATA, 0, 1);
+		frames += 8;
+	}
+	return frames;
+}
+
+/** The old reader **/
+static frame_t *old_readfr(transport_t *transport, uint32_t max_size, H2_ERROR *error) {
+	frame_t *f = calloc(1, sizeof(frame_t));
+	if (!f)
+		return NULL;
+	char *parts = calloc(4, sizeof(char));
+
+	if (!transport_read_complete(transport, parts, 3)) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	f->length = ((parts[0] & 0xFF) << 16) | ((parts[1] & 0xFF)  << 8) | (parts[2] & 0xFF);
+	if (f->length > max_size)
+		*error = H2_FRAME_SIZE_ERROR;
+	if (!transport_read_complete(transport, (char *)&f->type, sizeof(f->type))) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	if (f->length > max_size) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	if (!transport_read_complete(transport, (char *)&f->flags, sizeof(f->flags))) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	if (!transport_read_complete(transport, parts, 4)) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	f->r_s_id = u32(parts);
+	if (!(f->data = malloc(sizeof(char) * f->length))) {
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	if (f->length && !transport_read_complete(transport, f->data, f->length)) {
+		free(f->data);
+		free(f);
+		free(parts);
+		return NULL;
+	}
+	free(parts);
+	return f;
+}
+
+/** The checks **/
+static void check_reader(transport_t *transport) {
+	frame_reader_t reader;
+	H2_ERROR error = H2_NO_ERROR;
+
+	stream_reset();
+	size_t frames = stream_add_upload();
+	frame_reader_init(&reader, transport);
+	size_t i;
+	int matches = 1;
+	for (i = 0; i < frames; i++) {
+		frame_t *frame = frame_reader_read(&reader, 16384, &error);
+		if (!frame) {
+			matches = 0;
+			break;
+		}
+		if (!payload_matches(frame))
+			matches = 0;
+		/* the control frames are read in place */
+		if (frame->type != FRAME_DATA && frame->data < reader.input)
+			matches = 0;
+		frame_reader_release(&reader, frame);
+	}
+	check(matches && i == frames, "the frames are read");
+	check(!frame_reader_ready(&reader) && !frame_reader_read(&reader, 16384, &error), "the end of the transport is reported");
+	check(error == H2_NO_ERROR, "the end of the transport isn't a frame error");
+	frame_reader_destroy(&reader);
+
+	/* a read of one octet at a time */
+	stream_reset();
+	stream_add(8, FRAME_PING, 0, 0);
+	stream_add(300, FRAME_DATA, FLAG_END_STREAM, 5);
+	stream_add(4, FRAME_RST_STREAM, 0, 5);
+	record_size = 1;
+	frame_reader_init(&reader, transport);
+	frame_t *ping = frame_reader_read(&reader, 16384, &error);
+	check(ping && ping->type == FRAME_PING && ping->length == 8 && payload_matches(ping), "a frame is read from single octets");
+	if (ping)
+		frame_reader_release(&reader, ping);
+	frame_t *data = frame_reader_read(&reader, 16384, &error);
+	check(data && data->type == FRAME_DATA && data->flags == FLAG_END_STREAM && data->r_s_id == 5 && payload_matches(data),
+		  "a DATA frame is read from single octets");
+	/* a DATA frame is kept while the next frames are read */
+	frame_t *rst = frame_reader_read(&reader, 16384, &error);
+	check(rst && rst->type == FRAME_RST_STREAM && rst->length == 4 && payload_matches(rst), "the frame after it is read");
+	check(data && payload_matches(data), "a DATA frame outlives the next frame");
+	if (rst)
+		frame_reader_release(&reader, rst);
+	if (data)
+		frame_reader_release(&reader, data);
+	check(reader.pool_count == 1, "a DATA frame is returned to the pool");
+	frame_reader_destroy(&reader);
+	record_size = 16384;
+
+	/* a frame that arrives in parts is completed by the receives, without
+	 * waiting for the transport in between */
+	stream_reset();
+	stream_add(40, FRAME_HEADERS, FLAG_END_HEADERS, 1);
+	stream_add(30, FRAME_DATA, FLAG_END_STREAM, 1);
+	record_size = 7;
+	frame_reader_init(&reader, transport);
+	size_t receives = 0;
+	frame_t *parts[2] = { NULL, NULL };
+	for (i = 0; i < 2; i++) {
+		while (!(parts[i] = frame_reader_next(&reader, 16384, &error)) && error == H2_NO_ERROR) {
+			check(!frame_reader_ready(&reader), "an incomplete frame isn't ready");
+			if (!frame_reader_receive(&reader))
+				break;
+			receives += 1;
+		}
+		check(parts[i] && payload_matches(parts[i]), "a frame is completed by the receives");
+		if (parts[i] && i == 0)
+			frame_reader_release(&reader, parts[i]);
+	}
+	check(receives == (FRAME_HEADER_SIZE * 2 + 40 + 30 + 6) / 7, "every receive reads once");
+	if (parts[1])
+		frame_reader_release(&reader, parts[1]);
+	frame_reader_destroy(&reader);
+	record_size = 16384;
+
+	/* the payloads of the pool are reused */
+	stream_reset();
+	stream_add(10, FRAME_DATA, 0, 1);
+	stream_add(20, FRAME_DATA, 0, 1);
+	frame_reader_init(&reader, transport);
+	data = frame_reader_read(&reader, 16384, &error);
+	char *payload = data ? data->data : NULL;
+	if (data)
+		frame_reader_release(&reader, data);
+	data = frame_reader_read(&reader, 16384, &error);
+	check(data && data->data == payload && payload_matches(data), "a payload of the pool is reused");
+	if (data)
+		frame_reader_release(&reader, data);
+	frame_reader_destroy(&reader);
+
+	/* frames larger than the input, when the client allows it */
+	stream_reset();
+	stream_add(100000, FRAME_DATA, 0, 1);
+	stream_add(20000, FRAME_HEADERS, FLAG_END_HEADERS, 3);
+	frame_reader_init(&reader, transport);
+	data = frame_reader_read(&reader, 1 << 20, &error);
+	check(data && data->length == 100000 && payload_matches(data), "a large DATA frame is read");
+	if (data)
+		frame_reader_release(&reader, data);
+	frame_t *headers = frame_reader_read(&reader, 1 << 20, &error);
+	check(headers && headers->length == 20000 && payload_matches(headers), "a large HEADERS frame is read");
+	if (headers)
+		frame_reader_release(&reader, headers);
+	check(reader.pool_count == 0, "the large payloads aren't kept");
+	frame_reader_destroy(&reader);
+
+	/* errors */
+	stream_reset();
+	stream_add(16385, FRAME_DATA, 0, 1);
+	frame_reader_init(&reader, transport);
+	check(!frame_reader_read(&reader, 16384, &error) && error == H2_FRAME_SIZE_ERROR, "a frame that is too large is an error");
+	frame_reader_destroy(&reader);
+
+	error = H2_NO_ERROR;
+	stream_reset();
+	stream_add(100, FRAME_HEADERS, 0, 1);
+	stream_length -= 1;
+	frame_reader_init(&reader, transport);
+	check(!frame_reader_read(&reader, 16384, &error) && error == H2_NO_ERROR, "a truncated frame isn't read");
+	frame_reader_destroy(&reader);
+
+	stream_reset();
+	stream_add(100, FRAME_DATA, 0, 1);
+	stream_length -= 1;
+	frame_reader_init(&reader, transport);
+	check(!frame_reader_read(&reader, 16384, &error) && error == H2_NO_ERROR, "a truncated DATA frame isn't read");
+	frame_reader_destroy(&reader);
+}
+
+int main(int argc, char **argv) {
+	size_t count = 1000000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n frames]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		count = strtoul(optarg, NULL, 10);
+	}
+
+	transport_t transport;
+	memset(&transport, 0, sizeof(transport_t));
+	transport.ops = &memory_ops;
+	transport.socket = -1;
+
+	check_reader(&transport);
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+
+	stream_reset();
+	stream_add_upload();
+	repeat = 1;
+	H2_ERROR error = H2_NO_ERROR;
+	size_t octets = 0;
+	size_t i;
+
+	read_calls = 0;
+	double start = time_now();
+	for (i = 0; i < count; i++) {
+		frame_t *frame = old_readfr(&transport, 16384, &error);
+		octets += frame->length;
+		free(frame->data);
+		free(frame);
+	}
+	double old_time = time_now() - start;
+	size_t old_reads = read_calls;
+
+	frame_reader_t reader;
+	frame_reader_init(&reader, &transport);
+	stream_position = 0;
+	read_calls = 0;
+	start = time_now();
+	for (i = 0; i < count; i++) {
+		frame_t *frame = frame_reader_read(&reader, 16384, &error);
+		octets += frame->length;
+		frame_reader_release(&reader, frame);
+	}
+	double new_time = time_now() - start;
+	size_t new_reads = read_calls;
+	frame_reader_destroy(&reader);
+
+	printf("%zu frames (%zu octets of payload per reader):\n", count, octets / 2);
+	printf("  readfr        %6.0f ns/frame   %5.2f M frames/s   %4.2f reads/frame\n",
+		   old_time / count, count / old_time * 1e3, (double) old_reads / count);
+	printf("  frame reader  %6.0f ns/frame   %5.2f M frames/s   %4.2f reads/frame\n",
+		   new_time / count, count / new_time * 1e3, (double) new_reads / count);
+	return EXIT_SUCCESS;
+}
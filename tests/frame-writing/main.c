@@ -0,0 +1,297 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the frame writer and compares it with the old send_frame (see the
+ * history of frame.c), which allocated the header and the payload together
+ * and copied the payload into it. Two connections are measured: a response
+ * of 1 MB in DATA frames of 16 KB, and a page of small responses where the
+ * client acknowledges SETTINGS and PINGs and the server sends WINDOW_UPDATEs
+ * for request bodies between the HEADERS and DATA frames. The transport
+ * counts the writes and the octets, it doesn't copy them unless a check
+ * looks at them, so only the work of the writer is measured.
+ *
+ * Usage: ./testbin [-n rounds]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http2/frame.h"
+#include "transport/transport.h"
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/** The transport **/
+/* the octets are copied into 'sink' when 'capture' is set */
+static char sink[65536];
+static size_t sink_length;
+static int capture;
+static size_t write_calls;
+static size_t written;
+
+static void sink_add(const char *buffer, size_t length) {
+	if (capture) {
+		memcpy(sink + sink_length, buffer, length);
+		sink_length += length;
+	}
+	written += length;
+}
+
+static int memory_read(transport_t *transport, char *buffer, size_t length) {
+	return 0;
+}
+
+static int memory_write(transport_t *transport, const char *buffer, size_t length) {
+	sink_add(buffer, length);
+	write_calls += 1;
+	return 1;
+}
+
+static int memory_writev(transport_t *transport, const struct iovec *parts, int count) {
+	int i;
+	for (i = 0; i < count; i++)
+		sink_add(parts[i].iov_base, parts[i].iov_len);
+	write_calls += 1;
+	return 1;
+}
+
+static void memory_close(transport_t *transport) {
+	/* nothing to destroy */
+}
+
+static transport_protocol_t memory_get_protocol(transport_t *transport) {
+	return TRANSPORT_PROTOCOL_HTTP2;
+}
+
+static const transport_ops_t memory_ops = {
+	"memory",
+	memory_read,
+	memory_write,
+	memory_close,
+	memory_get_protocol,
+	NULL,
+	NULL,
+	NULL,
+	memory_writev
+};
+
+static void sink_reset(void) {
+	sink_length = 0;
+	write_calls = 0;
+	written = 0;
+}
+
+/* (boolean) the frame at 'offset' of the sink, 'offset' is moved after it */
+static int sink_has_frame(size_t *offset, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	const char *header = sink + *offset;
+	if (*offset + FRAME_HEADER_SIZE + length > sink_length)
+		return 0;
+	*offset += FRAME_HEADER_SIZE + length;
+	return (uint32_t) (((header[0] & 0xFF) << 16) | ((header[1] & 0xFF) << 8) | (header[2] & 0xFF)) == length
+		&& header[3] == type && header[4] == flags && u32(header + 5) == stream
+		&& (length == 0 || !memcmp(header + FRAME_HEADER_SIZE, data, length));
+}
+
+/** The old writer **/
+static int old_send_frame(transport_t *transport, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	char *buf = malloc(9 + length);
+	if (!buf) return 0;
+	buf[0] = length >> 16;
+	buf[1] = length >> 8;
+	buf[2] = length & 0x000000FF;
+	buf[3] = type;
+	buf[4] = flags;
+	buf[5] = stream >> 24;
+	buf[6] = stream >> 16;
+	buf[7] = stream >> 8;
+	buf[8] = stream & 0x000000FF;
+	if (data && length)
+		memcpy(buf+9, data, length);
+	int res = transport_write(transport, buf, 9 + length);
+	free(buf);
+	return res;
+}
+
+/** The checks **/
+static void check_writer(transport_t *transport) {
+	frame_writer_t writer;
+	frame_writer_init(&writer, transport);
+	capture = 1;
+
+	sink_reset();
+	static const char data[] = "<!DOCTYPE html><html><body>hello</body></html>";
+	check(send_frame(transport, sizeof(data), FRAME_DATA, FLAG_END_STREAM, 3, data) && write_calls == 1, "a frame is written at once");
+	size_t offset = 0;
+	check(sink_has_frame(&offset, sizeof(data), FRAME_DATA, FLAG_END_STREAM, 3, data) && offset == sink_length, "the frame is written");
+
+	/* the control frames are sent with the next frame */
+	sink_reset();
+	check(frame_writer_queue(&writer, 0, FRAME_SETTINGS, FLAG_ACK, 0, NULL), "a SETTINGS ACK is queued");
+	check(frame_writer_queue(&writer, 8, FRAME_PING, FLAG_ACK, 0, "abcdefgh"), "a PING ACK is queued");
+	check(frame_writer_queue(&writer, 4, FRAME_WINDOW_UPDATE, 0, 5, "\x00\x00\x40\x00"), "a WINDOW_UPDATE is queued");
+	check(write_calls == 0, "the queued frames aren't written");
+	check(frame_writer_send(&writer, sizeof(data), FRAME_DATA, 0, 3, data) && write_calls == 1, "the frames are sent in one write");
+	offset = 0;
+	check(sink_has_frame(&offset, 0, FRAME_SETTINGS, FLAG_ACK, 0, NULL)
+		  && sink_has_frame(&offset, 8, FRAME_PING, FLAG_ACK, 0, "abcdefgh")
+		  && sink_has_frame(&offset, 4, FRAME_WINDOW_UPDATE, 0, 5, "\x00\x00\x40\x00")
+		  && sink_has_frame(&offset, sizeof(data), FRAME_DATA, 0, 3, data)
+		  && offset == sink_length, "the frames are sent in order");
+	check(frame_writer_flush(&writer) && write_calls == 1, "an empty batch isn't written");
+
+	/* a full batch is written before the frame that doesn't fit */
+	sink_reset();
+	size_t i;
+	for (i = 0; i < FRAME_BATCH_SIZE / 13 + 1; i++)
+		frame_writer_queue(&writer, 4, FRAME_RST_STREAM, 0, 2 * i + 1, "\x00\x00\x00\x08");
+	check(write_calls == 1 && sink_length == (FRAME_BATCH_SIZE / 13) * 13, "a full batch is written");
+	check(frame_writer_flush(&writer) && write_calls == 2 && sink_length == (FRAME_BATCH_SIZE / 13 + 1) * 13, "the batch is flushed");
+	offset = 0;
+	int matches = 1;
+	for (i = 0; i < FRAME_BATCH_SIZE / 13 + 1; i++)
+		matches &= sink_has_frame(&offset, 4, FRAME_RST_STREAM, 0, 2 * i + 1, "\x00\x00\x00\x08");
+	check(matches, "the batched frames are written in order");
+
+	/* a frame larger than the batch is sent with it */
+	sink_reset();
+	static char origin[FRAME_BATCH_SIZE];
+	memset(origin, 'o', sizeof(origin));
+	frame_writer_queue(&writer, 0, FRAME_SETTINGS, FLAG_ACK, 0, NULL);
+	check(frame_writer_queue(&writer, sizeof(origin), FRAME_ORIGIN, 0, 0, origin) && write_calls == 1, "a large control frame is sent");
+	offset = 0;
+	check(sink_has_frame(&offset, 0, FRAME_SETTINGS, FLAG_ACK, 0, NULL)
+		  && sink_has_frame(&offset, sizeof(origin), FRAME_ORIGIN, 0, 0, origin) && offset == sink_length,
+		  "a large control frame is sent after the batch");
+	capture = 0;
+}
+
+/** The connections **/
+#define RESPONSE_SIZE (1 << 20)
+#define FRAME_SIZE 16384
+
+typedef int (*send_t)(void *, uint32_t, char, char, uint32_t, const char *);
+
+static int old_send(void *transport, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	return old_send_frame(transport, length, type, flags, stream, data);
+}
+
+static int new_send(void *writer, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	return frame_writer_send(writer, length, type, flags, stream, data);
+}
+
+static int new_queue(void *writer, uint32_t length, char type, char flags, uint32_t stream, const char *data) {
+	return frame_writer_queue(writer, length, type, flags, stream, data);
+}
+
+static void send_large(send_t send, void *destination, const char *response) {
+	size_t position;
+	for (position = 0; position < RESPONSE_SIZE; position += FRAME_SIZE)
+		send(destination, FRAME_SIZE, FRAME_DATA, position + FRAME_SIZE == RESPONSE_SIZE ? FLAG_END_STREAM : 0, 1, response + position);
+}
+
+/* 'queue' sends the control frames, the writer is flushed when the
+ * connection would wait for the client */
+static void send_page(send_t send, send_t queue, void *destination, const char *response) {
+	static const char block[40] = { (char) 0x88 };
+	uint32_t stream;
+	queue(destination, 0, FRAME_SETTINGS, FLAG_ACK, 0, NULL);
+	for (stream = 1; stream < 64; stream += 2) {
+		if (stream % 8 == 1)
+			queue(destination, 8, FRAME_PING, FLAG_ACK, 0, "abcdefgh");
+		if (stream % 4 == 3) {
+			queue(destination, 4, FRAME_WINDOW_UPDATE, 0, stream, "\x00\x00\x80\x00");
+			queue(destination, 4, FRAME_WINDOW_UPDATE, 0, 0, "\x00\x00\x80\x00");
+		}
+		send(destination, sizeof(block), FRAME_HEADERS, FLAG_END_HEADERS, stream, block);
+		send(destination, 2000, FRAME_DATA, FLAG_END_STREAM, stream, response);
+	}
+}
+
+int main(int argc, char **argv) {
+	size_t rounds = 2000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n rounds]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		rounds = strtoul(optarg, NULL, 10);
+	}
+
+	transport_t transport;
+	memset(&transport, 0, sizeof(transport_t));
+	transport.ops = &memory_ops;
+	transport.socket = -1;
+
+	check_writer(&transport);
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+
+	char *response = malloc(RESPONSE_SIZE);
+	memset(response, 'r', RESPONSE_SIZE);
+	frame_writer_t writer;
+	frame_writer_init(&writer, &transport);
+	size_t round;
+
+	sink_reset();
+	double start = time_now();
+	for (round = 0; round < rounds; round++)
+		send_large(old_send, &transport, response);
+	double old_time = time_now() - start;
+	size_t old_calls = write_calls;
+
+	sink_reset();
+	start = time_now();
+	for (round = 0; round < rounds; round++)
+		send_large(new_send, &writer, response);
+	double new_time = time_now() - start;
+	size_t new_calls = write_calls;
+
+	printf("%zu responses of %d octets in DATA frames of %d:\n", rounds, RESPONSE_SIZE, FRAME_SIZE);
+	printf("  send_frame (copy)  %8.0f ns/response   %5.1f writes/response\n", old_time / rounds, (double) old_calls / rounds);
+	printf("  frame writer       %8.0f ns/response   %5.1f writes/response\n", new_time / rounds, (double) new_calls / rounds);
+
+	sink_reset();
+	start = time_now();
+	for (round = 0; round < rounds; round++)
+		send_page(old_send, old_send, &transport, response);
+	old_time = time_now() - start;
+	old_calls = write_calls;
+
+	sink_reset();
+	start = time_now();
+	for (round = 0; round < rounds; round++) {
+		send_page(new_send, new_queue, &writer, response);
+		frame_writer_flush(&writer);
+	}
+	new_time = time_now() - start;
+	new_calls = write_calls;
+
+	printf("%zu pages of 32 small responses, with control frames in between:\n", rounds);
+	printf("  send_frame (copy)  %8.0f ns/page       %5.1f writes/page\n", old_time / rounds, (double) old_calls / rounds);
+	printf("  frame writer       %8.0f ns/page       %5.1f writes/page\n", new_time / rounds, (double) new_calls / rounds);
+
+	free(response);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the HTTP/2 scheduler: the priority field values are parsed, and a few
+ * streams with queued DATA frames are sent the way a connection sends them,
+ * the order of the frames is compared with the expected interleaving.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "http2/scheduler.h"
+
+#define STREAMS_MAX 8
+#define ORDER_MAX 64
+
+typedef struct {
+	h2_scheduler_node_t node;
+	/* the DATA frames that are queued */
+	size_t frames;
+	/* (boolean) the stream has no window left */
+	int blocked;
+} stream_t;
+
+static stream_t streams[STREAMS_MAX];
+static size_t stream_count;
+static h2_scheduler_t scheduler;
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static void check_parse(const char *value, unsigned urgency, unsigned incremental) {
+	h2_priority_t priority = h2_priority_default();
+	h2_priority_parse(&priority, value, strlen(value));
+	if (priority.urgency != urgency || priority.incremental != incremental) {
+		printf("\x1B[31mFailed: \"%s\" is u=%u i=%u, expected u=%u i=%u\x1B[0m\n",
+			   value, priority.urgency, priority.incremental, urgency, incremental);
+		failures += 1;
+	}
+}
+
+static stream_t *add_stream(uint32_t id, const char *priority, size_t frames) {
+	stream_t *stream = &streams[stream_count++];
+	memset(stream, 0, sizeof(stream_t));
+	stream->node.stream = id;
+	stream->node.data = stream;
+	stream->node.priority = h2_priority_default();
+	if (priority)
+		h2_priority_parse(&stream->node.priority, priority, strlen(priority));
+	stream->frames = frames;
+	h2_scheduler_add(&scheduler, &stream->node);
+	return stream;
+}
+
+static int can_send(h2_scheduler_node_t *node, void *data) {
+	stream_t *stream = (stream_t *) node->data;
+	return stream->frames > 0 && !stream->blocked;
+}
+
+/* sends 'count' frames (or all of them for 0), the identifiers are appended to 'order' */
+static void send_frames(char *order, size_t count) {
+	h2_scheduler_node_t *node;
+	size_t sent = 0;
+	while ((count == 0 || sent < count) && (node = h2_scheduler_next(&scheduler, can_send, NULL))) {
+		stream_t *stream = (stream_t *) node->data;
+		sprintf(order + strlen(order), "%s%u", order[0] ? " " : "", node->stream);
+		h2_scheduler_sent(&scheduler, node);
+		/* a stream that has sent its response is removed, like a finished task */
+		if (--stream->frames == 0)
+			h2_scheduler_remove(&scheduler, node);
+		sent += 1;
+	}
+}
+
+static void check_order(const char *name, const char *order, const char *expected) {
+	if (strcmp(order, expected) != 0) {
+		printf("\x1B[31mFailed: %s\n  order:    %s\n  expected: %s\x1B[0m\n", name, order, expected);
+		failures += 1;
+	}
+}
+
+static void reset(char *order) {
+	h2_scheduler_init(&scheduler);
+	stream_count = 0;
+	order[0] = '\0';
+}
+
+int main(void) {
+	char order[ORDER_MAX * 4];
+
+	check_parse("", 3, 0);
+	check_parse("u=1", 1, 0);
+	check_parse("u=1, i", 1, 1);
+	check_parse("i, u=7", 7, 1);
+	check_parse("u=0,i=?1", 0, 1);
+	check_parse("i=?0", 3, 0);
+	check_parse("u=2;foo=1, i;bar", 2, 1);
+	check_parse("x=5, u=4, y", 4, 0);
+	check_parse("u=8", 3, 0);
+	check_parse("u=-1", 3, 0);
+	check_parse("u=1, u=6", 6, 0);
+	check_parse("i=1", 3, 0);
+
+	check(h2_priority_from_weight(256).urgency == 0, "the heaviest weight is the most urgent");
+	check(h2_priority_from_weight(128).urgency == 0, "weight 128 has urgency 0");
+	check(h2_priority_from_weight(127).urgency == 1, "weight 127 has urgency 1");
+	check(h2_priority_from_weight(H2_PRIORITY_WEIGHT_DEFAULT).urgency == H2_PRIORITY_URGENCY_DEFAULT, "the default weight has the default urgency");
+	check(h2_priority_from_weight(8).urgency == 4, "weight 8 has urgency 4");
+	check(h2_priority_from_weight(1).urgency == 7, "the lightest weight is the least urgent");
+	check(h2_priority_from_weight(16).incremental, "RFC 7540 streams are incremental");
+
+	/* a page: the document, then the style sheet and the script one after the
+	 * other, then the images in turns */
+	reset(order);
+	add_stream(9, "u=5, i", 3);
+	add_stream(1, "u=0", 2);
+	add_stream(7, "u=5, i", 3);
+	add_stream(5, "u=1", 2);
+	add_stream(3, "u=1", 2);
+	send_frames(order, 0);
+	check_order("urgency, then identifier, then turns", order, "1 1 3 3 5 5 9 7 9 7 9 7");
+
+	/* a stream without window is skipped, it continues after a WINDOW_UPDATE */
+	reset(order);
+	add_stream(1, "u=1", 2);
+	stream_t *blocked = add_stream(3, "u=1", 2);
+	add_stream(5, "u=3, i", 2);
+	add_stream(7, "u=3, i", 2);
+	blocked->blocked = 1;
+	send_frames(order, 4);
+	blocked->blocked = 0;
+	send_frames(order, 0);
+	check_order("a blocked stream is parked", order, "1 1 5 7 3 3 5 7");
+
+	/* a PRIORITY_UPDATE moves a stream ahead of the others */
+	reset(order);
+	add_stream(1, "u=3, i", 3);
+	add_stream(3, "u=3, i", 3);
+	stream_t *update = add_stream(5, "u=3, i", 3);
+	send_frames(order, 2);
+	h2_priority_t priority = h2_priority_default();
+	h2_priority_parse(&priority, "u=0", 3);
+	h2_scheduler_set_priority(&scheduler, &update->node, priority);
+	send_frames(order, 0);
+	check_order("reprioritization", order, "1 3 5 5 5 1 3 1 3");
+
+	/* streams without priority have urgency 3, RFC 7540 weights are mapped */
+	reset(order);
+	add_stream(1, NULL, 2);
+	stream_t *light = add_stream(3, NULL, 2);
+	stream_t *heavy = add_stream(5, NULL, 2);
+	h2_scheduler_set_priority(&scheduler, &light->node, h2_priority_from_weight(1));
+	h2_scheduler_set_priority(&scheduler, &heavy->node, h2_priority_from_weight(256));
+	send_frames(order, 0);
+	check_order("RFC 7540 weights", order, "5 5 1 1 3 3");
+
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the HTTP/2 stream table, and compares the cost of the stream state
+ * lookups of a frame with the list it replaced (see the history of stream.c),
+ * on connections that have handled a number of requests before: the old list
+ * kept every stream that was ever opened, so a frame got slower the longer the
+ * connection was used.
+ *
+ * A request is simulated by the state changes the connection makes for it: the
+ * HEADERS frame opens the stream and ends the request, a WINDOW_UPDATE is
+ * received and the response closes the stream. A few requests are kept open
+ * at the same time, like a browser does.
+ *
+ * Usage: ./testbin [-n requests]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http2/stream.h"
+
+/* the streams that are open at the same time */
+#define CONCURRENT 8
+/* the state lookups and changes per request, see simulate */
+#define OPERATIONS 5
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/** The old list **/
+typedef struct {
+	uint32_t id;
+	h2stream_state_t state;
+} old_stream_t;
+
+typedef struct {
+	size_t count;
+	size_t size;
+	old_stream_t **streams;
+} old_list_t;
+
+static old_stream_t *old_get(old_list_t *list, uint32_t id) {
+	size_t i;
+	for (i = 0; i < list->count; i++) {
+		if (list->streams[i] && list->streams[i]->id == id)
+			return list->streams[i];
+	}
+
+	if (list->count == list->size) {
+		old_stream_t **streams = realloc(list->streams, (list->size + 30) * sizeof(old_stream_t *));
+		if (!streams)
+			return NULL;
+		list->size += 30;
+		list->streams = streams;
+	}
+
+	old_stream_t *stream = malloc(sizeof(old_stream_t));
+	stream->id = id;
+	stream->state = H2_STREAM_IDLE;
+	list->streams[list->count++] = stream;
+	return stream;
+}
+
+static h2stream_state_t old_get_state(old_list_t *list, uint32_t id) {
+	size_t i;
+	for (i = 0; i < list->count; i++) {
+		if (list->streams[i] && list->streams[i]->id == id)
+			return list->streams[i]->state;
+	}
+	return H2_STREAM_IDLE;
+}
+
+static int old_set_state(old_list_t *list, uint32_t id, h2stream_state_t state) {
+	old_stream_t *stream = old_get(list, id);
+	if (!stream)
+		return 0;
+	stream->state = state;
+	return 1;
+}
+
+static void old_destroy(old_list_t *list) {
+	size_t i;
+	for (i = 0; i < list->count; i++)
+		free(list->streams[i]);
+	free(list->streams);
+}
+
+/* the list after 'age' requests, built directly since the old list takes
+ * quadratic time to get there */
+static void old_create(old_list_t *list, size_t age) {
+	list->count = 0;
+	list->size = 0;
+	list->streams = NULL;
+	old_set_state(list, 0, H2_STREAM_OPEN);
+	list->streams = realloc(list->streams, (age + 1 + 30) * sizeof(old_stream_t *));
+	list->size = age + 1 + 30;
+	size_t i;
+	for (i = 0; i < age; i++) {
+		old_stream_t *stream = malloc(sizeof(old_stream_t));
+		stream->id = 2 * i + 1;
+		stream->state = H2_STREAM_CLOSED_STATE;
+		list->streams[list->count++] = stream;
+	}
+}
+
+/** The simulation, once for each implementation **/
+#define SIMULATE(name, list_t, get_state, set_state) \
+static void name(list_t *list, uint32_t first, size_t requests) { \
+	size_t i; \
+	for (i = 0; i < requests + CONCURRENT; i++) { \
+		if (i < requests) { \
+			uint32_t id = first + 2 * i; \
+			if (get_state(list, id) == H2_STREAM_IDLE) \
+				set_state(list, id, H2_STREAM_OPEN); \
+			set_state(list, id, H2_STREAM_HALF_CLOSED_REMOTE); \
+		} \
+		if (i >= CONCURRENT) { \
+			uint32_t id = first + 2 * (i - CONCURRENT); \
+			if (get_state(list, id) != H2_STREAM_CLOSED_STATE) \
+				set_state(list, id, H2_STREAM_CLOSED_STATE); \
+		} \
+	} \
+}
+
+SIMULATE(old_simulate, old_list_t, old_get_state, old_set_state)
+SIMULATE(new_simulate, h2stream_list_t, h2stream_get_state, h2stream_set_state)
+
+static void check_table(void) {
+	h2stream_list_t *list = h2stream_list_create(1000);
+	check(list != NULL, "the list is created");
+	if (!list)
+		return;
+	check(h2stream_get_state(list, 0) == H2_STREAM_OPEN, "stream 0 is open");
+	check(h2stream_get_state(list, 1) == H2_STREAM_IDLE, "stream 1 is idle");
+
+	/* many open streams that are closed out of order, so the table grows and
+	 * streams are moved when others are removed */
+	uint32_t i;
+	for (i = 1; i < 1200; i += 2)
+		check(h2stream_set_state(list, i, H2_STREAM_OPEN), "a stream is opened");
+	check(list->count == 601, "the streams are counted");
+	for (i = 1; i < 1200; i += 6)
+		h2stream_set_state(list, i, H2_STREAM_CLOSED_STATE);
+	for (i = 1; i < 1200; i += 2)
+		if (h2stream_get_state(list, i) != ((i - 1) % 6 == 0 ? H2_STREAM_CLOSED_STATE : H2_STREAM_OPEN)) {
+			printf("\x1B[31mFailed: stream %u has the wrong state\x1B[0m\n", i);
+			failures += 1;
+		}
+	check(h2stream_get_state(list, 1201) == H2_STREAM_IDLE, "a new stream is idle");
+	check(h2stream_get_state(list, 1100) == H2_STREAM_IDLE, "the even streams are counted apart");
+	check(h2stream_get(list, 7) == NULL, "a closed stream isn't reopened");
+	check(h2stream_recently_closed(list, 1195), "a stream that was closed last is recent");
+	check(!h2stream_recently_closed(list, 1), "a stream that was closed long ago isn't recent");
+	check(!h2stream_recently_closed(list, 3), "an open stream isn't recent");
+
+	for (i = 1; i < 1200; i += 2)
+		h2stream_set_state(list, i, H2_STREAM_CLOSED_STATE);
+	check(list->count == 1, "only stream 0 is left");
+	size_t blocks = list->block_count;
+	new_simulate(list, 1201, 10000);
+	check(list->block_count == blocks, "closed streams are reused");
+	check(h2stream_get_state(list, 1201 + 2 * 9999) == H2_STREAM_CLOSED_STATE, "the last stream is closed");
+
+	/* the maximum counts the streams that are open */
+	for (i = 0; i < 999; i++)
+		h2stream_set_state(list, 30001 + 2 * i, H2_STREAM_OPEN);
+	check(h2stream_get(list, 40001) == NULL, "the maximum is respected");
+	h2stream_set_state(list, 30001, H2_STREAM_CLOSED_STATE);
+	check(h2stream_get(list, 40001) != NULL, "a closed stream makes room");
+	h2stream_list_destroy(list);
+}
+
+int main(int argc, char **argv) {
+	size_t requests = 1000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n requests]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		requests = strtoul(optarg, NULL, 10);
+	}
+
+	check_table();
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+
+	static const size_t ages[] = { 100, 1000, 10000, 100000 };
+	printf("%zu requests of %d operations, after:\n", requests, OPERATIONS);
+	size_t i;
+	for (i = 0; i < sizeof(ages) / sizeof(ages[0]); i++) {
+		old_list_t old;
+		old_create(&old, ages[i]);
+		double start = time_now();
+		old_simulate(&old, 2 * ages[i] + 1, requests);
+		double old_time = time_now() - start;
+		old_destroy(&old);
+
+		h2stream_list_t *list = h2stream_list_create(1000);
+		new_simulate(list, 1, ages[i]);
+		start = time_now();
+		new_simulate(list, 2 * ages[i] + 1, requests);
+		double new_time = time_now() - start;
+		h2stream_list_destroy(list);
+
+		printf("  %6zu requests   old %9.1f ns/request   new %6.1f ns/request\n",
+			   ages[i], old_time / requests, new_time / requests);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,303 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * A TLS handshake benchmark: the server side is set up with tls_setup and
+ * tls_setup_client, exactly like the server does, and a client performs
+ * handshakes over socketpairs. Every combination of key type, protocol
+ * version, key exchange group and full/resumed handshake is measured.
+ *
+ * Usage: ./testbin [-n handshakes] [-l tls-cipher-list] [-s tls-cipher-suites]
+ *
+ * "server/s" is the amount of handshakes per second of server CPU time (so per
+ * core), the client isn't included. "bytes" are the bytes on the wire per
+ * handshake (client -> server / server -> client), including the session
+ * tickets and one application data record of one byte.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+
+#include "base/global_settings.h"
+#include "secure/tlsutil.h"
+
+typedef struct {
+	const char *name;
+	/* the EC curve, or NULL for RSA-2048 */
+	const char *curve;
+} key_type_t;
+
+typedef struct {
+	const char *name;
+	int version;
+} version_t;
+
+static const key_type_t key_types[] = {
+	{ "RSA-2048", NULL },
+	{ "ECDSA P-256", "P-256" }
+};
+
+static const version_t versions[] = {
+	{ "TLSv1.2", TLS1_2_VERSION },
+	{ "TLSv1.3", TLS1_3_VERSION }
+};
+
+static const char *groups[] = { "X25519", "P-256", "P-384" };
+
+static char cert_file[] = "/tmp/handshake-bench-cert-XXXXXX";
+static char key_file[] = "/tmp/handshake-bench-key-XXXXXX";
+
+/* the server thread reads the sockets to do a handshake on from this pipe,
+ * and writes to done_pipe when it has finished a handshake */
+static int server_pipe[2];
+static int done_pipe[2];
+/* the server CPU time of all handshakes, in nanoseconds */
+static double server_time;
+
+static double time_thread_cpu(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static int write_key_and_cert(const key_type_t *type) {
+	EVP_PKEY *key = type->curve ? EVP_EC_gen(type->curve) : EVP_RSA_gen(2048);
+	X509 *cert = X509_new();
+	if (!key || !cert)
+		return 0;
+
+	X509_set_version(cert, 2);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+	X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+	X509_set_pubkey(cert, key);
+	X509_NAME_add_entry_by_txt(X509_get_subject_name(cert), "CN", MBSTRING_ASC, (const unsigned char *) "localhost", -1, -1, 0);
+	X509_set_issuer_name(cert, X509_get_subject_name(cert));
+	if (!X509_sign(cert, key, EVP_sha256()))
+		return 0;
+
+	strcpy(cert_file + strlen(cert_file) - 6, "XXXXXX");
+	strcpy(key_file + strlen(key_file) - 6, "XXXXXX");
+	int cert_fd = mkstemp(cert_file);
+	int key_fd = mkstemp(key_file);
+	FILE *cert_stream = fdopen(cert_fd, "w");
+	FILE *key_stream = fdopen(key_fd, "w");
+	int result = cert_stream && key_stream
+		&& PEM_write_X509(cert_stream, cert)
+		&& PEM_write_PrivateKey(key_stream, key, NULL, NULL, 0, NULL, NULL);
+	fclose(cert_stream);
+	fclose(key_stream);
+
+	X509_free(cert);
+	EVP_PKEY_free(key);
+	return result;
+}
+
+/* does a handshake on every socket written to the pipe, until -1 is written */
+static void *server_thread(void *arg) {
+	int socket;
+	while (read(server_pipe[0], &socket, sizeof(socket)) == sizeof(socket) && socket != -1) {
+		double start = time_thread_cpu();
+		TLS tls = tls_setup_client(socket);
+		if (tls) {
+			tls_write_client(tls, "x", 1);
+			tls_destroy_client(tls);
+		}
+		server_time += time_thread_cpu() - start;
+		close(socket);
+		write(done_pipe[1], "", 1);
+	}
+	return NULL;
+}
+
+/* (boolean) does one handshake, 'session' is used for resumption and replaced by the new session */
+static int handshake(SSL_CTX *ctx, SSL_SESSION **session, int *resumed, unsigned long *bytes_written, unsigned long *bytes_read) {
+	int sockets[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == -1) {
+		perror("socketpair");
+		return 0;
+	}
+
+	/* like src/client.c does */
+	fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+	if (write(server_pipe[1], &sockets[0], sizeof(sockets[0])) != sizeof(sockets[0])) {
+		close(sockets[0]);
+		close(sockets[1]);
+		return 0;
+	}
+
+	SSL *ssl = SSL_new(ctx);
+	SSL_set_fd(ssl, sockets[1]);
+	if (*session)
+		SSL_set_session(ssl, *session);
+
+	char byte;
+	int success = SSL_connect(ssl) == 1 && SSL_read(ssl, &byte, 1) == 1;
+	if (success) {
+		*resumed = SSL_session_reused(ssl);
+		*bytes_written += BIO_number_written(SSL_get_wbio(ssl));
+		*bytes_read += BIO_number_read(SSL_get_rbio(ssl));
+		if (*session)
+			SSL_SESSION_free(*session);
+		*session = SSL_get1_session(ssl);
+		/* without a close_notify, OpenSSL marks the session as not resumable */
+		SSL_shutdown(ssl);
+	} else {
+		ERR_print_errors_fp(stderr);
+	}
+
+	SSL_free(ssl);
+	close(sockets[1]);
+
+	/* wait for the server, so its CPU time is complete */
+	success &= read(done_pipe[0], &byte, 1) == 1;
+	return success;
+}
+
+static int benchmark(const key_type_t *key_type, const version_t *version, const char *group, int resume, size_t count) {
+	/* TLS 1.2 (RFC 4492) only allows ECDSA certificates on curves the client supports */
+	if (key_type->curve && version->version == TLS1_2_VERSION && strcmp(key_type->curve, group)) {
+		printf("  %-8s %-7s %-8s skipped: the certificate's curve is required\n", version->name, group, resume ? "resumed" : "full");
+		return 1;
+	}
+
+	SSL_CTX *ctx = SSL_CTX_new(TLS_client_method());
+	SSL_CTX_set_min_proto_version(ctx, version->version);
+	SSL_CTX_set_max_proto_version(ctx, version->version);
+	if (!SSL_CTX_set1_groups_list(ctx, group)) {
+		ERR_print_errors_fp(stderr);
+		SSL_CTX_free(ctx);
+		return 0;
+	}
+
+	SSL_SESSION *session = NULL;
+	unsigned long written = 0, read = 0;
+	size_t i, reused = 0;
+	int resumed = 0;
+
+	/* the first handshake is never resumed, it provides the session */
+	if (resume && !handshake(ctx, &session, &resumed, &written, &read)) {
+		SSL_CTX_free(ctx);
+		return 0;
+	}
+
+	written = read = 0;
+	server_time = 0;
+	for (i = 0; i < count; i++) {
+		/* a full handshake gets a new session every time */
+		SSL_SESSION *fresh = NULL;
+		int success = handshake(ctx, resume ? &session : &fresh, &resumed, &written, &read);
+		if (fresh)
+			SSL_SESSION_free(fresh);
+		if (!success) {
+			printf("\x1B[31mHandshake %zu failed\x1B[0m\n", i);
+			break;
+		}
+		reused += resumed;
+	}
+
+	printf("  %-8s %-7s %-8s %9.0f server/s %8lu / %-5lu bytes",
+		version->name, group, resume ? "resumed" : "full",
+		i / (server_time / 1e9), written / (i ? i : 1), read / (i ? i : 1));
+	if (resume && reused != i)
+		printf(" \x1B[33m(only %zu resumed)\x1B[0m", reused);
+	putchar('\n');
+
+	if (session)
+		SSL_SESSION_free(session);
+	SSL_CTX_free(ctx);
+	return i == count;
+}
+
+int main(int argc, char **argv) {
+	size_t count = 1000;
+	char *cipher_list = NULL, *cipher_suites = NULL;
+	int option;
+	while ((option = getopt(argc, argv, "n:l:s:")) != -1) {
+		switch (option) {
+			case 'n':
+				count = strtoul(optarg, NULL, 10);
+				break;
+			case 'l':
+				cipher_list = optarg;
+				break;
+			case 's':
+				cipher_suites = optarg;
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-n handshakes] [-l tls-cipher-list] [-s tls-cipher-suites]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+
+	/* the client closes the socket before the server's close_notify, like src/main.c */
+	signal(SIGPIPE, SIG_IGN);
+	GLOBAL_SETTING_read_timeout = 1000;
+	GLOBAL_SETTINGS_log_tls_errors = 1;
+
+	if (pipe(server_pipe) == -1 || pipe(done_pipe) == -1) {
+		perror("pipe");
+		return EXIT_FAILURE;
+	}
+
+	int success = 1;
+	size_t key, version, group;
+	for (key = 0; key < sizeof(key_types) / sizeof(key_types[0]) && success; key++) {
+		if (!write_key_and_cert(&key_types[key])) {
+			fputs("\x1B[31mError: Failed to generate the certificate\x1B[0m\n", stderr);
+			return EXIT_FAILURE;
+		}
+
+		secure_cert_t cert;
+		memset(&cert, 0, sizeof(cert));
+		strcpy(cert.cert, cert_file);
+		strcpy(cert.key, key_file);
+
+		secure_config_t sconfig;
+		memset(&sconfig, 0, sizeof(sconfig));
+		sconfig.certs = &cert;
+		sconfig.cert_count = 1;
+		sconfig.min_protocol_version = PROTOCOL_NULL;
+		sconfig.cipher_list = cipher_list;
+		sconfig.cipher_suites = cipher_suites;
+		sconfig.record_size_small = 16384;
+
+		int result = tls_setup(&sconfig);
+		unlink(cert_file);
+		unlink(key_file);
+		if (!result) {
+			fputs("\x1B[31mError: tls_setup failed\x1B[0m\n", stderr);
+			return EXIT_FAILURE;
+		}
+
+		pthread_t thread;
+		pthread_create(&thread, NULL, server_thread, NULL);
+
+		printf("%s (%zu handshakes each)\n", key_types[key].name, count);
+		for (version = 0; version < sizeof(versions) / sizeof(versions[0]); version++)
+			for (group = 0; group < sizeof(groups) / sizeof(groups[0]); group++)
+				success &= benchmark(&key_types[key], &versions[version], groups[group], 0, count)
+					& benchmark(&key_types[key], &versions[version], groups[group], 1, count);
+
+		int stop = -1;
+		write(server_pipe[1], &stop, sizeof(stop));
+		pthread_join(thread, NULL);
+		tls_destroy();
+	}
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
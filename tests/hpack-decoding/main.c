@@ -0,0 +1,524 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the HPACK decoder and its dynamic table with the examples of RFC 7541
+ * Appendix C, the Dynamic Table Size Updates and many entries of random
+ * lengths, so the arena of the table wraps around often. Then compares the
+ * cost of adding the entries of a request with the table it replaced (see
+ * the history of dynamic_table.c), which allocated three times per entry and
+ * kept up to 4096 entries, because the size of the table was used as a count.
+ * Last, the decoding of the header blocks of two browser requests is compared
+ * with the decoder before the strings were decoded into the header list, which
+ * copied the payload and allocated every name and value.
+ *
+ * Usage: ./testbin [-n requests]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http2/dynamic_table.h"
+#include "http2/hpack.h"
+#include "http2/huffman.h"
+#include "http2/static_table.h"
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* (boolean) decodes the block, checks the headers ("name: value") and the size of the table */
+static size_t from_hex(char *destination, const char *hex) {
+	size_t length = strlen(hex) / 2;
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned int octet;
+		sscanf(hex + i * 2, "%2x", &octet);
+		destination[i] = octet;
+	}
+	return length;
+}
+
+static int check_frame(dynamic_table_t *table, uint8_t flags, const char *hex, const char *const *expected, size_t table_size, const char *name) {
+	char data[512];
+	frame_t frame = { 0 };
+	frame.length = from_hex(data, hex);
+	frame.type = FRAME_HEADERS;
+	frame.flags = FLAG_END_HEADERS | flags;
+	frame.r_s_id = 1;
+	frame.data = data;
+	size_t i;
+
+	http_header_list_t *list = http_create_header_list();
+	int success = handle_headers(&frame, table, list);
+	if (expected) {
+		int matches = success;
+		for (i = 0; matches && expected[i]; i++) {
+			char header[256];
+			if (i < list->count)
+				sprintf(header, "%s: %s", list->headers[i]->key, list->headers[i]->value);
+			matches = i < list->count && !strcmp(header, expected[i]);
+		}
+		check(matches && i == list->count, name);
+		check(table->size == table_size, "the table has the size of the example");
+	} else {
+		check(!success, name);
+	}
+	http_destroy_header_list(list);
+	return success;
+}
+
+static int check_block(dynamic_table_t *table, const char *hex, const char *const *expected, size_t table_size, const char *name) {
+	return check_frame(table, 0, hex, expected, table_size, name);
+}
+
+static void check_examples(void) {
+	/* RFC 7541 Appendix C.3, requests without Huffman coding */
+	static const char *const c31[] = { ":method: GET", ":scheme: http", ":path: /", ":authority: www.example.com", NULL };
+	static const char *const c32[] = { ":method: GET", ":scheme: http", ":path: /", ":authority: www.example.com", "cache-control: no-cache", NULL };
+	static const char *const c33[] = { ":method: GET", ":scheme: https", ":path: /index.html", ":authority: www.example.com", "custom-key: custom-value", NULL };
+	dynamic_table_t *table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+	check_block(table, "828684410f7777772e6578616d706c652e636f6d", c31, 57, "C.3.1 is decoded");
+	check_block(table, "828684be58086e6f2d6361636865", c32, 110, "C.3.2 is decoded");
+	check_block(table, "828785bf400a637573746f6d2d6b65790c637573746f6d2d76616c7565", c33, 164, "C.3.3 is decoded");
+	check(table->count == 3, "C.3 has three entries");
+	dynamic_table_destroy(table);
+
+	/* RFC 7541 Appendix C.4, the same requests with Huffman coding */
+	table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+	check_block(table, "828684418cf1e3c2e5f23a6ba0ab90f4ff", c31, 57, "C.4.1 is decoded");
+	check_block(table, "828684be5886a8eb10649cbf", c32, 110, "C.4.2 is decoded");
+	check_block(table, "828785bf408825a849e95ba97d7f8925a849e95bb8e8b4bf", c33, 164, "C.4.3 is decoded");
+	dynamic_table_destroy(table);
+
+	/* RFC 7541 Appendix C.5, responses that evict entries from a table of 256 */
+	static const char *const c51[] = { ":status: 302", "cache-control: private", "date: Mon, 21 Oct 2013 20:13:21 GMT", "location: https://www.example.com", NULL };
+	static const char *const c52[] = { ":status: 307", "cache-control: private", "date: Mon, 21 Oct 2013 20:13:21 GMT", "location: https://www.example.com", NULL };
+	static const char *const c53[] = { ":status: 200", "cache-control: private", "date: Mon, 21 Oct 2013 20:13:22 GMT", "location: https://www.example.com",
+									   "content-encoding: gzip", "set-cookie: foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1", NULL };
+	table = dynamic_table_create(256);
+	check_block(table, "4803333032580770726976617465611d4d6f6e2c203231204f637420323031332032303a31333a323120474d54"
+				"6e1768747470733a2f2f7777772e6578616d706c652e636f6d", c51, 222, "C.5.1 is decoded");
+	check_block(table, "4803333037c1c0bf", c52, 222, "C.5.2 is decoded");
+	check_block(table, "88c1611d4d6f6e2c203231204f637420323031332032303a31333a323220474d54c05a04677a69707738666f6f3d"
+				"4153444a4b48514b425a584f5157454f50495541585157454f49553b206d61782d6167653d333630303b2076657273696f6e3d31",
+				c53, 215, "C.5.3 is decoded");
+	check(table->count == 3, "C.5.3 has three entries");
+
+	/* Dynamic Table Size Updates (RFC 7541 Section 6.3) */
+	static const char *const status[] = { ":status: 200", NULL };
+	check_block(table, "3f45" "88", status, 98, "a smaller table evicts entries");
+	check(table->count == 1, "only the newest entry is left");
+	check_block(table, "20" "3fe11f" "88", status, 0, "an update to 0 empties the table");
+	check_block(table, "3fe21f" "88", NULL, 0, "an update over the limit is a decoding error");
+	check_block(table, "be", NULL, 0, "an index after the table is a decoding error");
+
+	/* malformed literals and integers, the strings aren't read past the block */
+	check_block(table, "0f", NULL, 0, "an integer without its continuation is a decoding error");
+	check_block(table, "ffffffffff7f", NULL, 0, "an integer that is too large is a decoding error");
+	check_block(table, "4003616263", NULL, 0, "a literal without its value is a decoding error");
+	check_block(table, "0485ffff", NULL, 0, "a string longer than the block is a decoding error");
+
+	/* the padding and the priority of the frame aren't part of the block */
+	static const char *const get[] = { ":method: GET", ":path: /", NULL };
+	check_frame(table, FLAG_PADDED, "03" "8284" "000000", get, 0, "the padding is skipped");
+	check_frame(table, FLAG_PRIORITY, "0000000010" "8284", get, 0, "the priority is skipped");
+	check_frame(table, FLAG_PADDED | FLAG_PRIORITY, "02" "00000000ff" "8284" "0000", get, 0, "the padding and the priority are skipped");
+	check_frame(table, FLAG_PADDED, "05" "8284", NULL, 0, "padding longer than the frame is a decoding error");
+	check_frame(table, FLAG_PADDED, "", NULL, 0, "a padded frame without the pad length is a decoding error");
+	dynamic_table_destroy(table);
+}
+
+/* the names and values of the static table are used as they are, the others
+ * are in the strings of the list */
+static void check_strings(void) {
+	char data[64];
+	frame_t frame = { 0 };
+	frame.length = from_hex(data, "82" "4488606c46c1179d34d1" "be" "0f1003616263");
+	frame.type = FRAME_HEADERS;
+	frame.flags = FLAG_END_HEADERS;
+	frame.data = data;
+
+	dynamic_table_t *table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+	http_header_list_t *list = http_create_header_list();
+	check(handle_headers(&frame, table, list) && list->count == 4, "the block is decoded");
+	if (list->count == 4) {
+		check(list->headers[0]->key == static_table[2].name && list->headers[0]->value == static_table[2].value,
+			  "an indexed field of the static table isn't copied");
+		check(list->headers[1]->key == static_table[4].name && !strcmp(list->headers[1]->value, "/a/b/c.html"),
+			  "a name of the static table isn't copied");
+		check(list->headers[2]->key != table->entries[0].key && !strcmp(list->headers[2]->value, "/a/b/c.html"),
+			  "an indexed field of the dynamic table is copied");
+		check(!strcmp(list->headers[3]->key, "content-type") && !strcmp(list->headers[3]->value, "abc"),
+			  "a literal without indexing is decoded");
+	}
+	/* the entries of the dynamic table can be evicted while the request is
+	 * handled, the copies are kept */
+	dynamic_table_set_max_size(table, 0);
+	dynamic_table_set_max_size(table, DYNAMIC_TABLE_SIZE);
+	dynamic_table_add(table, "xxxxx", 5, "xxxxxxxxxxx", 11);
+	check(list->count == 4 && !strcmp(list->headers[2]->key, ":path") && !strcmp(list->headers[2]->value, "/a/b/c.html"),
+		  "the copies of the dynamic table outlive its entries");
+	http_destroy_header_list(list);
+	dynamic_table_destroy(table);
+}
+
+/* adds entries of random lengths and compares the table with the entries
+ * that should be in it */
+static void check_arena(void) {
+	enum { ADDS = 100000, MAX_LENGTH = 1500 };
+	static char keys[DYNAMIC_TABLE_SIZE][MAX_LENGTH + 1];
+	static char values[DYNAMIC_TABLE_SIZE][MAX_LENGTH + 1];
+	static size_t key_lengths[DYNAMIC_TABLE_SIZE];
+	static size_t value_lengths[DYNAMIC_TABLE_SIZE];
+	/* the model is a ring of the newest entries, 'newest' is the next one */
+	size_t newest = 0;
+	size_t count = 0;
+	size_t size = 0;
+	dynamic_table_t *table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+	srand(7);
+
+	size_t add;
+	for (add = 0; add < ADDS; add++) {
+		/* mostly small entries, like headers, and a few large ones */
+		size_t key_length = rand() % 30;
+		size_t value_length = rand() % 8 == 0 ? rand() % MAX_LENGTH : rand() % 100;
+		size_t slot = newest % DYNAMIC_TABLE_SIZE;
+		size_t i;
+		for (i = 0; i < key_length; i++)
+			keys[slot][i] = 'a' + (add + i) % 26;
+		for (i = 0; i < value_length; i++)
+			values[slot][i] = 'A' + (add * 7 + i) % 26;
+		key_lengths[slot] = key_length;
+		value_lengths[slot] = value_length;
+
+		if (add % 1000 == 999) {
+			/* a change of the maximum size evicts like an entry does */
+			size_t max_size = add % 2000 == 999 ? 1000 : DYNAMIC_TABLE_SIZE;
+			dynamic_table_set_max_size(table, max_size);
+			while (count > 0 && size > max_size) {
+				size_t oldest = (newest - count) % DYNAMIC_TABLE_SIZE;
+				size -= key_lengths[oldest] + value_lengths[oldest] + 32;
+				count -= 1;
+			}
+		}
+
+		dynamic_table_add(table, keys[slot], key_length, values[slot], value_length);
+		while (count > 0 && size + key_length + value_length + 32 > table->max_size) {
+			size_t oldest = (newest - count) % DYNAMIC_TABLE_SIZE;
+			size -= key_lengths[oldest] + value_lengths[oldest] + 32;
+			count -= 1;
+		}
+		if (key_length + value_length + 32 <= table->max_size) {
+			size += key_length + value_length + 32;
+			count += 1;
+			newest += 1;
+		}
+
+		if (table->count != count || table->size != size) {
+			printf("\x1B[31mFailed: the table has %zu entries of %zu instead of %zu of %zu\x1B[0m\n",
+				   table->count, table->size, count, size);
+			failures += 1;
+			break;
+		}
+		/* the entries are checked after each large one, they move the arena the most */
+		if (value_length < 100 && add % 97 != 0)
+			continue;
+		for (i = 0; i < count; i++) {
+			size_t model = (newest - 1 - i) % DYNAMIC_TABLE_SIZE;
+			dyn_entry_t *entry = dynamic_table_get(table, HTTP2_STATIC_TABLE_SIZE + i).dynamic;
+			if (!entry || entry->key_length != key_lengths[model] || entry->value_length != value_lengths[model]
+				|| memcmp(entry->key, keys[model], key_lengths[model]) || memcmp(entry->value, values[model], value_lengths[model])
+				|| entry->key[entry->key_length] != 0 || entry->value[entry->value_length] != 0
+				|| entry->value + entry->value_length >= table->arena + DYNAMIC_TABLE_ARENA_SIZE) {
+				printf("\x1B[31mFailed: entry %zu is wrong after %zu entries were added\x1B[0m\n", i, add + 1);
+				failures += 1;
+				add = ADDS;
+				break;
+			}
+		}
+	}
+	check(dynamic_table_get(table, HTTP2_STATIC_TABLE_SIZE + table->count).dynamic == NULL, "the index after the table is empty");
+	dynamic_table_destroy(table);
+}
+
+/** The old table **/
+typedef struct {
+	char *key;
+	char *value;
+} old_entry_t;
+
+typedef struct {
+	old_entry_t **entries;
+	size_t size;
+	size_t index_last;
+	size_t client_max_size;
+} old_table_t;
+
+static old_table_t *old_create(size_t client_max_size) {
+	old_table_t *table = malloc(sizeof(old_table_t));
+	table->size = 8;
+	table->entries = malloc(table->size * sizeof(old_entry_t *));
+	table->index_last = client_max_size;
+	table->client_max_size = client_max_size;
+	return table;
+}
+
+/* the callers passed strings they had allocated */
+static void old_add(old_table_t *table, char *key, char *value) {
+	if (table->index_last == table->client_max_size)
+		table->index_last = 0;
+	else
+		table->index_last++;
+	if (table->size <= table->index_last) {
+		table->size += 2;
+		table->entries = realloc(table->entries, table->size * sizeof(old_entry_t *));
+	}
+
+	old_entry_t *entry = malloc(sizeof(old_entry_t));
+	entry->key = key;
+	entry->value = value;
+	/* an entry that was overwritten after the wrap around was lost */
+	table->entries[table->index_last] = entry;
+}
+
+static void old_destroy(old_table_t *table) {
+	size_t i;
+	for (i = 0; table->index_last != table->client_max_size && i < table->index_last + 1; i++) {
+		free(table->entries[i]->key);
+		free(table->entries[i]->value);
+		free(table->entries[i]);
+	}
+	free(table->entries);
+	free(table);
+}
+
+/** The old decoder **/
+/* the entries of the old static table, as "name$value" */
+static char old_static_table[HTTP2_STATIC_TABLE_SIZE][128];
+
+static void old_setup(void) {
+	size_t i;
+	for (i = 1; i < HTTP2_STATIC_TABLE_SIZE; i++)
+		sprintf(old_static_table[i], "%s$%s", static_table[i].name, static_table[i].value);
+}
+
+static char *old_parse_string(const char *data, size_t available, size_t *octets_used, size_t *length) {
+	size_t prefix;
+	size_t encoded_length = parse_int(data, &prefix, 7);
+	if (encoded_length > available - prefix)
+		return NULL;
+	*octets_used = prefix + encoded_length;
+	if (data[0] & 0x80)
+		return huff_decode(data + prefix, encoded_length, length);
+	char *string = malloc(encoded_length + 1);
+	memcpy(string, data + prefix, encoded_length);
+	string[encoded_length] = 0;
+	*length = encoded_length;
+	return string;
+}
+
+static char *old_copy(const char *string, size_t length) {
+	char *copy = malloc(length + 1);
+	memcpy(copy, string, length);
+	copy[length] = 0;
+	return copy;
+}
+
+/* the old lookup of a name, which split the entry of the static table */
+static char *old_name(dynamic_table_t *table, size_t index) {
+	if (index > 0 && index < HTTP2_STATIC_TABLE_SIZE)
+		return old_copy(old_static_table[index], strchr(old_static_table[index], '$') - old_static_table[index]);
+	lookup_t result = dynamic_table_get(table, index);
+	return result.dynamic ? old_copy(result.dynamic->key, result.dynamic->key_length) : NULL;
+}
+
+/* handle_headers without the checks of the literals that aren't in the
+ * requests below, every string is allocated and added as HTTP_HEADER_NOT_CACHED */
+static int old_handle_headers(frame_t *frame, dynamic_table_t *table, http_header_list_t *list) {
+	size_t length = frame->length;
+	char *data = dup_str(frame->data, length);
+	size_t octets_used;
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned char c = data[i];
+		char *key, *value;
+		size_t index, key_length, value_length;
+		if (c > 127) {
+			index = parse_int(data + i, &octets_used, 7);
+			i += octets_used - 1;
+			if (index < HTTP2_STATIC_TABLE_SIZE) {
+				key = old_name(table, index);
+				value = strdup(strchr(old_static_table[index], '$') + 1);
+			} else {
+				lookup_t result = dynamic_table_get(table, index);
+				if (!result.dynamic)
+					goto error_label;
+				key = old_copy(result.dynamic->key, result.dynamic->key_length);
+				value = old_copy(result.dynamic->value, result.dynamic->value_length);
+			}
+		} else if (c >= 64) {
+			index = parse_int(data + i, &octets_used, 6);
+			i += octets_used;
+			if (index == 0) {
+				key = old_parse_string(data + i, length - i, &octets_used, &key_length);
+				i += octets_used;
+			} else {
+				key = old_name(table, index);
+			}
+			value = old_parse_string(data + i, length - i, &octets_used, &value_length);
+			if (!key || !value)
+				goto error_label;
+			i += octets_used - 1;
+			dynamic_table_add(table, key, strlen(key), value, value_length);
+		} else {
+			goto error_label;
+		}
+		http_header_list_add(list, key, value, HTTP_HEADER_NOT_CACHED, index);
+	}
+	free(data);
+	return 1;
+
+error_label:
+	free(data);
+	return 0;
+}
+
+/* the first request of a browser, which adds most of its headers to the
+ * table, and the next request on the connection, which indexes most of them */
+static const char *const request_blocks[] = {
+	"8287418cf1e3c2e5f23a6ba0ab90f4ff4498606841528608843148cd52f49aa5c8847f9de066510df0937ab4d07f66a281b0dae053fafc087ed4ce6aadf"
+	"2a7979c89c6bed4b3bdc75e5c1fda988a4ea76040080010054c26b0b29fcb0ebcb83f538e497ca582211f5f2c7cfdf6800b87518b2d4b70ddf45abefb"
+	"4005db508d9bd9abfa5242cb40d25fa523b373929d29ad171863c78f0b97c8e9ae82ae43d2c760af8a61c18a10ae25c2dba2640db6112e16df74420b2"
+	"d03ed48a6349062842b897081e009d71f0b2b85b7de081b6c2cff4082497f864d833505b11f",
+	"8287c6449961091a4c463a218ee5aa43d8bbb233180a11ae49edabaafd11c55383f963e7c4c3c2c1c0"
+};
+
+#define REQUEST_COUNT (sizeof(request_blocks) / sizeof(request_blocks[0]))
+
+/* decodes the requests with a new table 'rounds' times, returns the headers */
+static size_t decode_requests(int (*decode)(frame_t *, dynamic_table_t *, http_header_list_t *), frame_t *frames, size_t rounds) {
+	size_t headers = 0;
+	size_t round, i;
+	for (round = 0; round < rounds; round++) {
+		dynamic_table_t *table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+		for (i = 0; i < REQUEST_COUNT; i++) {
+			http_header_list_t *list = http_create_header_list();
+			if (decode(&frames[i], table, list))
+				headers += list->count;
+			http_destroy_header_list(list);
+		}
+		dynamic_table_destroy(table);
+	}
+	return headers;
+}
+
+/* a request of a browser adds a few entries that change, like the path and
+ * a referer, the others are indexed */
+#define ADDS_PER_REQUEST 3
+
+static char *duplicate(const char *string) {
+	size_t length = strlen(string) + 1;
+	char *copy = malloc(length);
+	memcpy(copy, string, length);
+	return copy;
+}
+
+int main(int argc, char **argv) {
+	size_t requests = 100000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n requests]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		requests = strtoul(optarg, NULL, 10);
+	}
+
+	check_examples();
+	check_arena();
+	check_strings();
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+
+	static const char *const names[ADDS_PER_REQUEST] = { ":path", "referer", "if-none-match" };
+	char value[64];
+	size_t i, j;
+
+	double start = time_now();
+	old_table_t *old = old_create(DYNAMIC_TABLE_SIZE);
+	for (i = 0; i < requests; i++) {
+		for (j = 0; j < ADDS_PER_REQUEST; j++) {
+			sprintf(value, "/assets/images/photo-%zu.jpg", i * ADDS_PER_REQUEST + j);
+			/* the old decoder allocated the strings and added them */
+			old_add(old, duplicate(names[j]), duplicate(value));
+		}
+	}
+	/* the entries up to 'client_max_size' were kept, after that they were leaked */
+	size_t old_count = requests * ADDS_PER_REQUEST < old->client_max_size + 1 ? requests * ADDS_PER_REQUEST : old->client_max_size + 1;
+	old_destroy(old);
+	double old_time = time_now() - start;
+
+	start = time_now();
+	dynamic_table_t *table = dynamic_table_create(DYNAMIC_TABLE_SIZE);
+	for (i = 0; i < requests; i++) {
+		for (j = 0; j < ADDS_PER_REQUEST; j++) {
+			sprintf(value, "/assets/images/photo-%zu.jpg", i * ADDS_PER_REQUEST + j);
+			dynamic_table_add(table, names[j], strlen(names[j]), value, strlen(value));
+		}
+	}
+	size_t new_count = table->count;
+	dynamic_table_destroy(table);
+	double new_time = time_now() - start;
+
+	printf("%zu requests that add %d entries:\n", requests, ADDS_PER_REQUEST);
+	printf("  old %6.1f ns/request   %4zu entries kept\n", old_time / requests, old_count);
+	printf("  new %6.1f ns/request   %4zu entries kept (%zu octets)\n", new_time / requests, new_count, sizeof(dynamic_table_t));
+
+	old_setup();
+	static char blocks[REQUEST_COUNT][512];
+	frame_t frames[REQUEST_COUNT];
+	memset(frames, 0, sizeof(frames));
+	for (i = 0; i < REQUEST_COUNT; i++) {
+		frames[i].length = from_hex(blocks[i], request_blocks[i]);
+		frames[i].type = FRAME_HEADERS;
+		frames[i].flags = FLAG_END_HEADERS;
+		frames[i].data = blocks[i];
+	}
+	size_t rounds = requests / REQUEST_COUNT;
+
+	start = time_now();
+	size_t old_headers = decode_requests(old_handle_headers, frames, rounds);
+	old_time = time_now() - start;
+
+	start = time_now();
+	size_t new_headers = decode_requests(handle_headers, frames, rounds);
+	new_time = time_now() - start;
+
+	if (old_headers != new_headers || new_headers != rounds * 22) {
+		printf("\x1B[31mThe requests weren't decoded (%zu and %zu headers)\x1B[0m\n", old_headers, new_headers);
+		return EXIT_FAILURE;
+	}
+	printf("%zu requests of 11 headers:\n", rounds * REQUEST_COUNT);
+	printf("  old %6.1f ns/request\n", old_time / (rounds * REQUEST_COUNT));
+	printf("  new %6.1f ns/request\n", new_time / (rounds * REQUEST_COUNT));
+	return EXIT_SUCCESS;
+}
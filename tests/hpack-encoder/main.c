@@ -0,0 +1,168 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the HPACK encoder: the Huffman code and the integers are compared
+ * with the examples of RFC 7541 Appendix C, and a few responses are encoded
+ * on one connection, so the dynamic table, its size limit and the Dynamic
+ * Table Size Updates are checked. The literals of a PUSH_PROMISE are checked
+ * too.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "base/global_settings.h"
+#include "http/response_headers.h"
+#include "http2/hpack.h"
+#include "http2/hpack_encoder.h"
+#include "http2/huffman.h"
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static void check_bytes(const char *name, const char *data, size_t length, const char *expected) {
+	char hex[1024] = { 0 };
+	size_t i;
+	for (i = 0; i < length && i * 2 + 2 < sizeof(hex); i++)
+		sprintf(hex + i * 2, "%02x", data[i] & 0xFF);
+	if (strcmp(hex, expected) != 0) {
+		printf("\x1B[31mFailed: %s\n  result:   %s\n  expected: %s\x1B[0m\n", name, hex, expected);
+		failures += 1;
+	}
+}
+
+static void check_huffman(const char *string, const char *expected) {
+	char encoded[64];
+	size_t length = huff_encoded_length(string, strlen(string));
+	huff_encode(encoded, string, strlen(string));
+	check_bytes(string, encoded, length, expected);
+}
+
+/* a response of the file server, the Server header has the configured value */
+static http_response_headers_t *create_response(const char *type, const char *date) {
+	http_response_headers_t *headers = http_create_response_headers(8);
+	http_response_headers_add(headers, HTTP_RH_STATUS_200, NULL);
+	http_response_headers_add(headers, HTTP_RH_CONTENT_TYPE, type);
+	http_response_headers_add(headers, HTTP_RH_DATE, date);
+	http_response_headers_add(headers, HTTP_RH_SERVER, NULL);
+	return headers;
+}
+
+int main(void) {
+	GLOBAL_SETTING_server_name = "wss";
+	if (!hpack_encoder_setup()) {
+		puts("\x1B[31mFailed to setup the encoder\x1B[0m");
+		return EXIT_FAILURE;
+	}
+
+	/* RFC 7541 Appendix C.4.1 to C.4.3 */
+	check_huffman("www.example.com", "f1e3c2e5f23a6ba0ab90f4ff");
+	check_huffman("no-cache", "a8eb10649cbf");
+	check_huffman("custom-key", "25a849e95ba97d7f");
+	check_huffman("custom-value", "25a849e95bb8e8b4bf");
+
+	const char *date = "Mon, 21 Oct 2013 20:13:21 GMT";
+	http_response_headers_t *html = create_response("text/html", date);
+	http_response_headers_t *css = create_response("text/css", date);
+
+	hpack_encoder_t encoder;
+	hpack_encoder_init(&encoder, HPACK_ENCODER_TABLE_SIZE);
+	check(hpack_encode(&encoder, html), "the first response is encoded");
+	/* ":status: 200", then literals with incremental indexing of the static
+	 * names, "Mon, 21 Oct 2013 20:13:21 GMT" is C.6.1 */
+	check_bytes("the first response", encoder.block, encoder.block_length,
+		"885f87497ca589d34d1f"
+		"6196d07abe941054d444a8200595040b8166e082a62d1bff"
+		"7603777373");
+	check(encoder.count == 3, "three headers are in the table");
+
+	/* the entries are the server (62), the date (63) and the type (64) */
+	check(hpack_encode(&encoder, html), "the repeated response is encoded");
+	check_bytes("the repeated response", encoder.block, encoder.block_length, "88c0bfbe");
+	check(hpack_encode(&encoder, css), "the other response is encoded");
+	/* the new type is 62, the server 63 and the date 64 */
+	check_bytes("another type", encoder.block, encoder.block_length, "885f86497ca582211fc0bf");
+
+	/* the client lowers its table: the oldest entries are evicted, and the
+	 * next block starts with the update (RFC 7541 Section 6.3) */
+	hpack_encoder_set_max_size(&encoder, 80);
+	check(encoder.size <= 80, "the table is smaller than the maximum");
+	hpack_encoder_set_max_size(&encoder, 0);
+	hpack_encoder_set_max_size(&encoder, 100);
+	check(hpack_encode(&encoder, html), "the response after the updates is encoded");
+	check(encoder.block_length > 2 && (encoder.block[0] & 0xFF) == 0x20 && (encoder.block[1] & 0xFF) == 0x3F,
+		  "the smallest and the last size are sent");
+	check(encoder.size <= 100, "the entries fit in the new maximum");
+	check(hpack_encode(&encoder, html), "the response after the update is encoded");
+	check((encoder.block[0] & 0xE0) != 0x20, "the update is only sent once");
+
+	hpack_encoder_set_max_size(&encoder, 65536);
+	check(encoder.max_size == HPACK_ENCODER_TABLE_SIZE, "the table is limited");
+	hpack_encoder_destroy(&encoder);
+
+	/* a '103 Early Hints' isn't in the static table, the Link of a page is
+	 * indexed, so the hints of the next page are two octets */
+	http_response_headers_t *hints = http_create_response_headers(3);
+	http_response_headers_add(hints, HTTP_RH_STATUS_103, NULL);
+	http_response_headers_add(hints, HTTP_RH_LINK, "</a.css>; rel=preload; as=style");
+	hpack_encoder_init(&encoder, HPACK_ENCODER_TABLE_SIZE);
+	check(hpack_encode(&encoder, hints), "the early hints are encoded");
+	check_bytes("the early hints", encoder.block, encoder.block_length,
+		"488208196d99fff8c0d72211ff7f6a585a20aec2d071c9f6a0d10213ea82ff");
+	check(hpack_encode(&encoder, hints), "the repeated early hints are encoded");
+	check_bytes("the repeated early hints", encoder.block, encoder.block_length, "bfbe");
+	hpack_encoder_destroy(&encoder);
+	http_response_headers_destroy(hints);
+
+	/* the headers of a PUSH_PROMISE don't change the dynamic table */
+	char literal[10 + HPACK_LITERAL_OVERHEAD];
+	size_t literal_length = hpack_encode_literal(literal, 4, "/style.css", 10);
+	check_bytes("the literal path", literal, literal_length, "04876109f541572211");
+	/* "br" isn't shorter with Huffman */
+	literal_length = hpack_encode_literal(literal, 16, "br", 2);
+	check_bytes("the literal with a name index of two octets", literal, literal_length, "0f01026272");
+
+	/* a value with a length of more than one octet: 300 'a's are 188 octets
+	 * with Huffman, 188 is 127 + 61 */
+	char long_value[301];
+	memset(long_value, 'a', 300);
+	long_value[300] = 0;
+	http_response_headers_t *vary = http_create_response_headers(2);
+	http_response_headers_add(vary, HTTP_RH_VARY, long_value);
+	hpack_encoder_init(&encoder, HPACK_ENCODER_TABLE_SIZE);
+	check(hpack_encode(&encoder, vary), "the long value is encoded");
+	check(encoder.block_length == 3 + 188, "the long value has a length of two octets");
+	check_bytes("the long value", encoder.block, 3, "7bff3d");
+	hpack_encoder_destroy(&encoder);
+
+	/* the blocks of prebuilt responses don't use the dynamic table and have a
+	 * plain date */
+	size_t size;
+	char *block = write_headers(html, &size);
+	check(block != NULL, "write_headers encodes the response");
+	if (block) {
+		check((block[1] & 0xF0) == 0x00, "write_headers doesn't index");
+		check(size > strlen(date) && memcmp(block + size - 6 - strlen(date), date, strlen(date)) == 0,
+			  "write_headers has a plain date");
+	}
+	free(block);
+
+	http_response_headers_destroy(html);
+	http_response_headers_destroy(css);
+	http_response_headers_destroy(vary);
+	hpack_encoder_cleanup();
+
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+	return EXIT_SUCCESS;
+}
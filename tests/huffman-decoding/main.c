@@ -0,0 +1,283 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the HPACK Huffman decoder, and compares its speed with the tree it
+ * replaced (see the history of huffman.c), which read one bit at a time. The
+ * strings are the kind of header values browsers send: cookies, user agents,
+ * paths and accept headers. The old decoder is copied here without its bugs
+ * (its tree was built from a table with wrong codes), it still has the same
+ * work per bit.
+ *
+ * Usage: ./testbin [-n rounds]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http2/huffman.h"
+
+/* see huffman_table.h, which is compiled into huffman.so */
+extern const uint32_t http2_huffman_codes[257];
+extern const uint8_t http2_huffman_code_lengths[257];
+
+static size_t failures = 0;
+
+static void check(int condition, const char *name) {
+	if (!condition) {
+		printf("\x1B[31mFailed: %s\x1B[0m\n", name);
+		failures += 1;
+	}
+}
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static size_t from_hex(char *destination, const char *hex) {
+	size_t length = strlen(hex) / 2;
+	size_t i;
+	for (i = 0; i < length; i++) {
+		unsigned int octet;
+		sscanf(hex + i * 2, "%2x", &octet);
+		destination[i] = octet;
+	}
+	return length;
+}
+
+/** The old decoder **/
+typedef struct hnode_t {
+	struct hnode_t *left;
+	struct hnode_t *right;
+	size_t value;
+} hnode_t;
+
+static hnode_t *tree = NULL;
+
+static void old_setup(void) {
+	tree = calloc(1, sizeof(hnode_t));
+	size_t symbol;
+	for (symbol = 0; symbol < 256; symbol++) {
+		hnode_t *current = tree;
+		int i;
+		for (i = http2_huffman_code_lengths[symbol] - 1; i >= 0; i--) {
+			hnode_t **child = (http2_huffman_codes[symbol] >> i) & 1 ? &current->right : &current->left;
+			if (!*child)
+				*child = calloc(1, sizeof(hnode_t));
+			current = *child;
+		}
+		current->value = symbol;
+	}
+}
+
+static void destroy_node(hnode_t *node) {
+	if (node->left)
+		destroy_node(node->left);
+	if (node->right)
+		destroy_node(node->right);
+	free(node);
+}
+
+static char *old_decode(const char *stream, const size_t len) {
+	size_t bp = 0;
+	char *out = malloc(256);
+	out[255] = 0;
+
+	size_t i = 0;
+	while (bp/8 < len && i < 255) {
+		hnode_t *cur = tree;
+		while (cur->left && cur->right && bp/8 < len) {
+			size_t p = 7 - (bp % 8);
+			size_t bs = (stream[bp/8] & (1<<p)) >>p;
+			if (bs)
+				cur = cur->right;
+			else
+				cur = cur->left;
+			bp+=1;
+		}
+
+		if (cur->left && cur->right)
+			break;
+		out[i++] = cur->value;
+	}
+	out[i] = 0;
+	return out;
+}
+
+/** The checks **/
+static void check_round_trip(const char *string, size_t length, const char *name) {
+	char encoded[1024];
+	size_t encoded_length = huff_encoded_length(string, length);
+	huff_encode(encoded, string, length);
+	size_t decoded_length = 0;
+	char *decoded = huff_decode(encoded, encoded_length, &decoded_length);
+	check(decoded && decoded_length == length && !memcmp(decoded, string, length) && decoded[length] == 0, name);
+	check(huff_decoded_length_max(encoded_length) >= length, "the maximum decoded length isn't too small");
+	free(decoded);
+}
+
+static void check_decode(const char *hex, const char *expected, const char *name) {
+	char encoded[256];
+	size_t length = from_hex(encoded, hex);
+	size_t decoded_length = 12345;
+	char *decoded = huff_decode(encoded, length, &decoded_length);
+	if (expected)
+		check(decoded && decoded_length == strlen(expected) && !strcmp(decoded, expected), name);
+	else
+		check(!decoded && decoded_length == 12345, name);
+	free(decoded);
+}
+
+static void check_decoder(void) {
+	/* RFC 7541 Appendix C.4 and C.6 */
+	check_decode("f1e3c2e5f23a6ba0ab90f4ff", "www.example.com", "www.example.com is decoded");
+	check_decode("a8eb10649cbf", "no-cache", "no-cache is decoded");
+	check_decode("6402", "302", "302 is decoded");
+	check_decode("d07abe941054d444a8200595040b8166e082a62d1bff", "Mon, 21 Oct 2013 20:13:21 GMT", "a date is decoded");
+	check_decode("9d29ad171863c78f0b97c8e9ae82ae43d3", "https://www.example.com", "a URL is decoded");
+	check_decode("", "", "the empty string is decoded");
+	check_decode("5551ff", "%%a", "7 bits of padding are accepted");
+
+	/* RFC 7541 Section 5.2 */
+	check_decode("ff", NULL, "8 bits of padding are rejected");
+	check_decode("1fff", NULL, "padding after a full octet is rejected");
+	check_decode("18", NULL, "padding of zeros is rejected");
+	check_decode("1c", NULL, "padding that isn't the start of EOS is rejected");
+	check_decode("fffffffc", NULL, "EOS is rejected");
+	check_decode("fffffffc1f", NULL, "EOS before a symbol is rejected");
+	check_decode("1ffffffff8", NULL, "EOS after a symbol is rejected");
+
+	char all[256];
+	size_t i;
+	for (i = 0; i < 256; i++) {
+		all[i] = i;
+		check_round_trip(all + i, 1, "every symbol is decoded");
+	}
+	check_round_trip(all, 256, "all the symbols are decoded");
+	check_round_trip("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 40, "the shortest codes fill the maximum length");
+
+	/* a string that decodes to exactly the maximum length */
+	char encoded[5];
+	size_t length = from_hex(encoded, "0842108421");
+	char decoded[8];
+	size_t decoded_length;
+	check(huff_decoded_length_max(length) == 8, "five octets decode to at most eight");
+	check(huff_decode_to(decoded, encoded, length, &decoded_length) && decoded_length == 8 && !memcmp(decoded, "11111111", 8),
+		  "the maximum length is reached");
+}
+
+/** The benchmark **/
+static const char *const values[] = {
+	/* paths */
+	"/",
+	"/index.html",
+	"/assets/css/main.min.css?v=3f2a91c",
+	"/static/js/vendor.7d3b0e1a.chunk.js",
+	"/images/products/2020/summer-collection/thumbnail-480x320.webp",
+	"/api/v2/users/1274/notifications?unread=true&limit=25&cursor=eyJpZCI6MTI3NH0",
+	/* user agents */
+	"Mozilla/5.0 (X11; Linux x86_64; rv:78.0) Gecko/20100101 Firefox/78.0",
+	"Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/85.0.4183.83 Safari/537.36",
+	"Mozilla/5.0 (iPhone; CPU iPhone OS 13_6 like Mac OS X) AppleWebKit/605.1.15 (KHTML, like Gecko) Version/13.1.2 Mobile/15E148 Safari/604.1",
+	/* accept headers */
+	"text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,*/*;q=0.8",
+	"image/webp,image/apng,image/*,*/*;q=0.8",
+	"gzip, deflate, br",
+	"en-US,en;q=0.9,nl;q=0.8",
+	/* cookies */
+	"_ga=GA1.2.1572305512.1597221340; _gid=GA1.2.1080276913.1598105513",
+	"session=6f1c2b9e4a7d4e0f8b3a5c2d1e9f7a6b; theme=dark; lang=en",
+	"csrftoken=Kd8F2jLq9ZxV0bN3mT7yR1wU5sA4eH6gC8iO2pQ; sessionid=x9v2k7m4n1b8c5z3"
+};
+
+#define VALUE_COUNT (sizeof(values) / sizeof(values[0]))
+
+int main(int argc, char **argv) {
+	size_t rounds = 100000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n rounds]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		rounds = strtoul(optarg, NULL, 10);
+	}
+
+	check_decoder();
+
+	old_setup();
+	char encoded[VALUE_COUNT][256];
+	size_t lengths[VALUE_COUNT];
+	size_t octets = 0;
+	size_t i;
+	for (i = 0; i < VALUE_COUNT; i++) {
+		lengths[i] = huff_encoded_length(values[i], strlen(values[i]));
+		huff_encode(encoded[i], values[i], strlen(values[i]));
+		octets += strlen(values[i]);
+
+		char *old = old_decode(encoded[i], lengths[i]);
+		check(!strcmp(old, values[i]), "the old decoder decodes the values");
+		free(old);
+	}
+
+	if (failures > 0) {
+		printf("\x1B[31m%zu check(s) failed\x1B[0m\n", failures);
+		destroy_node(tree);
+		return EXIT_FAILURE;
+	}
+	puts("\x1B[32mAll checks passed\x1B[0m");
+
+	/* the sum of the first octets, so the decoding isn't optimized away */
+	size_t sum = 0;
+	double start = time_now();
+	size_t round;
+	for (round = 0; round < rounds; round++) {
+		for (i = 0; i < VALUE_COUNT; i++) {
+			char *string = old_decode(encoded[i], lengths[i]);
+			sum += string[0];
+			free(string);
+		}
+	}
+	double old_time = time_now() - start;
+
+	start = time_now();
+	for (round = 0; round < rounds; round++) {
+		for (i = 0; i < VALUE_COUNT; i++) {
+			size_t length;
+			char *string = huff_decode(encoded[i], lengths[i], &length);
+			sum += string[0];
+			free(string);
+		}
+	}
+	double new_time = time_now() - start;
+
+	char buffer[256];
+	start = time_now();
+	for (round = 0; round < rounds; round++) {
+		for (i = 0; i < VALUE_COUNT; i++) {
+			size_t length;
+			huff_decode_to(buffer, encoded[i], lengths[i], &length);
+			sum += buffer[0];
+		}
+	}
+	double into_time = time_now() - start;
+
+	printf("%zu rounds of %zu header values (%zu octets decoded), checksum %zu:\n",
+		   rounds, VALUE_COUNT, octets, sum % 10);
+	printf("  old tree       %7.1f ns/value   %7.1f MB/s\n",
+		   old_time / (rounds * VALUE_COUNT), octets * rounds / old_time * 1e3);
+	printf("  huff_decode    %7.1f ns/value   %7.1f MB/s\n",
+		   new_time / (rounds * VALUE_COUNT), octets * rounds / new_time * 1e3);
+	printf("  huff_decode_to %7.1f ns/value   %7.1f MB/s\n",
+		   into_time / (rounds * VALUE_COUNT), octets * rounds / into_time * 1e3);
+
+	destroy_node(tree);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,314 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * A benchmark of the lookups that use the tables generated by
+ * tools/perfect-hash.c, compared to the linear scans they replaced (see the
+ * history of parser.c, mime.c, header_list.c and reader.c):
+ *
+ *   method     http_method_is_registered, for a few common methods
+ *   mime       mime_from_path, for a few common file names
+ *   header     http_header_list_gets, for the headers a request is asked for
+ *   getn       http_header_list_getn, for the same headers by their index
+ *   config     config_get, for every key of a typical config.ini
+ *
+ * Before the benchmark, every word of the tables is checked to be found by
+ * both the old and the new lookup.
+ *
+ * Usage: ./testbin [-n iterations]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "configuration/config.h"
+#include "configuration/key_table.h"
+#include "http/header_list.h"
+#include "http/header_name_table.h"
+#include "http/method_table.h"
+#include "http/parser.h"
+#include "utils/mime.h"
+#include "utils/mime_table.h"
+#include "utils/util.h"
+
+static const char *methods[] = { "GET", "GET", "POST", "HEAD", "OPTIONS", "PUT", "DELETE", "BREW" };
+static const char *paths[] = { "/index.html", "/assets/css/main.css", "/assets/js/app.min.js", "/img/logo.PNG", "/favicon.ico", "/fonts/inter.woff2", "/robots.txt", "/README" };
+/* the headers the server asks for while handling a request */
+static const char *header_keys[] = { ":method", ":path", "content-length", "transfer-encoding", "expect", "connection", "accept-encoding", "cache-control", "pragma", "if-modified-since" };
+static const int header_names[] = {
+	HTTP_HEADER_NAME_METHOD, HTTP_HEADER_NAME_PATH, HTTP_HEADER_NAME_CONTENT_LENGTH, HTTP_HEADER_NAME_TRANSFER_ENCODING,
+	HTTP_HEADER_NAME_EXPECT, HTTP_HEADER_NAME_CONNECTION, HTTP_HEADER_NAME_ACCEPT_ENCODING, HTTP_HEADER_NAME_CACHE_CONTROL,
+	HTTP_HEADER_NAME_PRAGMA, HTTP_HEADER_NAME_IF_MODIFIED_SINCE
+};
+
+static const char *request_headers[][2] = {
+	{ ":method", "GET" },
+	{ ":path", "/assets/css/main.css?v=20200612" },
+	{ "host", "sub.thewoosh.me" },
+	{ "user-agent", "Mozilla/5.0 (X11; Linux x86_64; rv:78.0) Gecko/20100101 Firefox/78.0" },
+	{ "accept", "text/css,*/*;q=0.1" },
+	{ "accept-language", "en-US,en;q=0.5" },
+	{ "accept-encoding", "gzip, deflate, br" },
+	{ "connection", "keep-alive" },
+	{ "referer", "https://sub.thewoosh.me/" },
+	{ "cookie", "session=4f6a2c9e1b7d4e03a8c1f2e5d6b7a890; theme=dark" },
+	{ "if-modified-since", "Fri, 12 Jun 2020 10:32:01 GMT" },
+	{ "cache-control", "max-age=0" },
+	{ "te", "Trailers" }
+};
+
+static const char config_file[] =
+	"port=443\n"
+	"server-name=wss\n"
+	"headers-strict=true\n"
+	"hostname=sub.thewoosh.me\n"
+	"hostname-strict=true\n"
+	"origin=https://sub.thewoosh.me\n"
+	"compression=br gzip\n"
+	"strict-transport-security=max-age=63072000\\; includeSubDomains\\; preload\n"
+	"header-tk=N\n"
+	"log-h2-receive-goaway=yes\n"
+	"log-tls-errors=yes\n"
+	"log-request=minimal\n"
+	"tls-mode=Letsencrypt\n"
+	"tls-min-version=TLSv1.2\n"
+	"tls-cipher-list=ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-RSA-AES128-GCM-SHA256\n"
+	"tls-cipher-suites=TLS_AES_256_GCM_SHA384:TLS_AES_128_GCM_SHA256\n"
+	"handlers=fs.ini\n";
+
+#define COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/** The old lookups **/
+static int old_method_is_registered(const char *method, size_t length) {
+	size_t i;
+	for (i = 0; i < HTTP_METHOD_COUNT; i++) {
+		if (strlen(http_method_words[i]) == length && !memcmp(method, http_method_words[i], length)) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static const char *strchrlast(const char *str, char occ) {
+	size_t i;
+	for (i = strlen(str); i > 0; i--) {
+		if (str[i-1] == occ)
+			return str + i - 1;
+	}
+	return NULL;
+}
+
+static const char *old_mime_from_path(const char *path) {
+	const char *dot = strchrlast(path, '.');
+	if (!dot)
+		return NULL;
+
+	size_t extlen = strlen(path) - (dot - path);
+	char *extdup = malloc(extlen);
+	size_t i;
+	for (i = 0; i < extlen-1; i++)
+		extdup[i] = tolower(dot[i+1]);
+	extdup[extlen-1] = 0;
+
+	int pos = strswitch(extdup, (const char **) mime_extension_words, MIME_EXTENSION_COUNT, CASEFLAG_DONT_IGNORE);
+	free(extdup);
+	return pos == -1 ? NULL : mime_extension_values[pos];
+}
+
+static const char *old_header_list_gets(http_header_list_t *list, const char *key) {
+	size_t i;
+	for (i = 0; i < list->count; i++) {
+		if (strcasecmp(list->headers[i]->key, key) == 0) {
+			return list->headers[i]->value;
+		}
+	}
+	return NULL;
+}
+
+static const char *old_config_get(config_t config, const char *key) {
+	size_t i;
+	for (i = 0; i < config.count; i++) {
+		if (!strcmp(key, config.keys[i])) {
+			return config.values[i];
+		}
+	}
+	return NULL;
+}
+
+/* (boolean) every word of the generated tables is found at its own index */
+static int check_tables(void) {
+	size_t i;
+	for (i = 0; i < HTTP_METHOD_COUNT; i++)
+		if (http_method_lookup(http_method_words[i], strlen(http_method_words[i])) != (int) i)
+			return 0;
+	for (i = 0; i < MIME_EXTENSION_COUNT; i++)
+		if (mime_extension_lookup(mime_extension_words[i], strlen(mime_extension_words[i])) != (int) i)
+			return 0;
+	for (i = 0; i < HTTP_HEADER_NAME_COUNT; i++)
+		if (http_header_name_lookup(http_header_name_words[i], strlen(http_header_name_words[i])) != (int) i)
+			return 0;
+	for (i = 0; i < CONFIG_KEY_COUNT; i++)
+		if (config_key_lookup(config_key_words[i], strlen(config_key_words[i])) != (int) i)
+			return 0;
+	/* a word that differs in one byte isn't found */
+	return http_method_lookup("GEt", 3) == -1 && http_header_name_lookup("Content-Length", 14) >= 0
+		&& config_key_lookup("Port", 4) == -1 && mime_extension_lookup("HTMl", 4) >= 0;
+}
+
+/* (boolean) the old and the new lookups find the same */
+static int check(http_header_list_t *headers, config_t config) {
+	size_t i;
+	char path[64];
+	if (!check_tables()) {
+		puts("\x1B[31mA generated table doesn't find its words\x1B[0m");
+		return 0;
+	}
+	for (i = 0; i < HTTP_METHOD_COUNT; i++) {
+		const char *method = http_method_words[i];
+		if (!http_method_is_registered(method, strlen(method)) || http_method_is_registered(method, strlen(method) - 1)) {
+			printf("\x1B[31mThe method '%s' isn't found\x1B[0m\n", method);
+			return 0;
+		}
+	}
+	for (i = 0; i < MIME_EXTENSION_COUNT; i++) {
+		sprintf(path, "/file.%s", mime_extension_words[i]);
+		if (mime_from_path(path, NULL) != old_mime_from_path(path)) {
+			printf("\x1B[31mThe extension of '%s' isn't found\x1B[0m\n", path);
+			return 0;
+		}
+	}
+	for (i = 0; i < COUNT(paths); i++) {
+		const char *type = mime_from_path(paths[i], NULL);
+		const char *old = old_mime_from_path(paths[i]);
+		if (type != old && (!type || !old || strcmp(type, old))) {
+			printf("\x1B[31mThe type of '%s' differs\x1B[0m\n", paths[i]);
+			return 0;
+		}
+	}
+	for (i = 0; i < HTTP_HEADER_NAME_COUNT; i++) {
+		if (http_header_list_gets(headers, http_header_name_words[i]) != old_header_list_gets(headers, http_header_name_words[i])) {
+			printf("\x1B[31mThe header '%s' isn't found\x1B[0m\n", http_header_name_words[i]);
+			return 0;
+		}
+	}
+	for (i = 0; i < COUNT(header_keys); i++) {
+		if (http_header_list_getn(headers, header_names[i]) != old_header_list_gets(headers, header_keys[i])) {
+			printf("\x1B[31mThe header '%s' isn't found by its index\x1B[0m\n", header_keys[i]);
+			return 0;
+		}
+	}
+	for (i = 0; i < CONFIG_KEY_COUNT; i++) {
+		if (config_get(config, config_key_words[i]) != old_config_get(config, config_key_words[i])) {
+			printf("\x1B[31mThe config key '%s' isn't found\x1B[0m\n", config_key_words[i]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void print(const char *name, size_t lookups, double old_time, double new_time) {
+	printf("  %-8s old %7.1f ns/lookup   new %7.1f ns/lookup   (%zu lookups)\n", name, old_time / lookups, new_time / lookups, lookups);
+}
+
+int main(int argc, char **argv) {
+	size_t count = 200000, i, j;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		count = strtoul(optarg, NULL, 10);
+	}
+
+	http_header_list_t *headers = http_create_header_list();
+	for (i = 0; headers && i < COUNT(request_headers); i++)
+		if (!http_header_list_add(headers, request_headers[i][0], (char *) request_headers[i][1], HTTP_HEADER_CACHED, 0))
+			return EXIT_FAILURE;
+
+	FILE *file = fmemopen((void *) config_file, sizeof(config_file) - 1, "r");
+	if (!headers || !file)
+		return EXIT_FAILURE;
+	config_t config = config_readf(file);
+
+	if (!check(headers, config))
+		return EXIT_FAILURE;
+	puts("Check: \x1B[32mpassed\x1B[0m");
+
+	/* the results are summed, so the lookups aren't optimized away */
+	size_t found = 0;
+	double start, old_time, new_time;
+	printf("%zu iterations\n", count);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(methods); j++)
+			found += old_method_is_registered(methods[j], strlen(methods[j]));
+	old_time = time_now() - start;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(methods); j++)
+			found += http_method_is_registered(methods[j], strlen(methods[j]));
+	new_time = time_now() - start;
+	print("method", count * COUNT(methods), old_time, new_time);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(paths); j++)
+			found += old_mime_from_path(paths[j]) != NULL;
+	old_time = time_now() - start;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(paths); j++)
+			found += mime_from_path(paths[j], NULL) != NULL;
+	new_time = time_now() - start;
+	print("mime", count * COUNT(paths), old_time, new_time);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(header_keys); j++)
+			found += old_header_list_gets(headers, header_keys[j]) != NULL;
+	old_time = time_now() - start;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(header_keys); j++)
+			found += http_header_list_gets(headers, header_keys[j]) != NULL;
+	new_time = time_now() - start;
+	print("header", count * COUNT(header_keys), old_time, new_time);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < COUNT(header_names); j++)
+			found += http_header_list_getn(headers, header_names[j]) != NULL;
+	new_time = time_now() - start;
+	print("getn", count * COUNT(header_names), old_time, new_time);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < CONFIG_KEY_COUNT; j++)
+			found += old_config_get(config, config_key_words[j]) != NULL;
+	old_time = time_now() - start;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		for (j = 0; j < CONFIG_KEY_COUNT; j++)
+			found += config_get(config, config_key_words[j]) != NULL;
+	new_time = time_now() - start;
+	print("config", count * CONFIG_KEY_COUNT, old_time, new_time);
+
+	printf("(found %zu)\n", found);
+	config_destroy(config);
+	http_destroy_header_list(headers);
+	return EXIT_SUCCESS;
+}
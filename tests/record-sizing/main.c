@@ -0,0 +1,215 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Checks the dynamic record sizing of tls_write_client: a server thread writes
+ * to a client over a socketpair, and the client records the size of every
+ * application data record it receives.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/socket.h>
+
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+
+#include "base/global_settings.h"
+#include "secure/tlsutil.h"
+
+#define RECORD_SMALL     1000
+#define RECORD_THRESHOLD 10000
+#define RECORD_IDLE      200
+
+#define WRITE_FIRST  30000
+#define WRITE_SECOND 5000
+
+/* TLS 1.2 AES-GCM: explicit nonce (8) + tag (16) */
+#define RECORD_OVERHEAD 24
+
+#define RECORDS_MAX 64
+
+static size_t records[RECORDS_MAX];
+static size_t record_count = 0;
+
+static char cert_file[] = "/tmp/record-sizing-cert-XXXXXX";
+static char key_file[] = "/tmp/record-sizing-key-XXXXXX";
+
+static void msg_callback(int write_p, int version, int content_type, const void *buf, size_t len, SSL *ssl, void *arg) {
+	const unsigned char *header = buf;
+	if (write_p || content_type != SSL3_RT_HEADER || len < 5 || header[0] != SSL3_RT_APPLICATION_DATA)
+		return;
+	if (record_count < RECORDS_MAX)
+		records[record_count] = ((header[3] << 8) | header[4]) - RECORD_OVERHEAD;
+	record_count += 1;
+}
+
+static int write_key_and_cert(void) {
+	EVP_PKEY *key = EVP_RSA_gen(2048);
+	X509 *cert = X509_new();
+	if (!key || !cert)
+		return 0;
+
+	X509_set_version(cert, 2);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+	X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+	X509_set_pubkey(cert, key);
+	X509_NAME_add_entry_by_txt(X509_get_subject_name(cert), "CN", MBSTRING_ASC, (const unsigned char *) "localhost", -1, -1, 0);
+	X509_set_issuer_name(cert, X509_get_subject_name(cert));
+	if (!X509_sign(cert, key, EVP_sha256()))
+		return 0;
+
+	int cert_fd = mkstemp(cert_file);
+	int key_fd = mkstemp(key_file);
+	FILE *cert_stream = fdopen(cert_fd, "w");
+	FILE *key_stream = fdopen(key_fd, "w");
+	int result = cert_stream && key_stream
+		&& PEM_write_X509(cert_stream, cert)
+		&& PEM_write_PrivateKey(key_stream, key, NULL, NULL, 0, NULL, NULL);
+	fclose(cert_stream);
+	fclose(key_stream);
+
+	X509_free(cert);
+	EVP_PKEY_free(key);
+	return result;
+}
+
+static void *server_thread(void *arg) {
+	static char data[WRITE_FIRST];
+	int socket = *(int *) arg;
+	struct timespec idle = { 0, RECORD_IDLE * 2 * 1000000L };
+
+	memset(data, 'A', sizeof(data));
+	TLS tls = tls_setup_client(socket);
+	if (!tls) {
+		fputs("\x1B[31mError: Server handshake failed\x1B[0m\n", stderr);
+		close(socket);
+		return NULL;
+	}
+
+	tls_write_client(tls, data, WRITE_FIRST);
+	nanosleep(&idle, NULL);
+	tls_write_client(tls, data, WRITE_SECOND);
+
+	tls_destroy_client(tls);
+	close(socket);
+	return NULL;
+}
+
+static int read_all(SSL *ssl, size_t length) {
+	char buffer[4096];
+	while (length > 0) {
+		int ret = SSL_read(ssl, buffer, length < sizeof(buffer) ? length : sizeof(buffer));
+		if (ret <= 0)
+			return 0;
+		length -= ret;
+	}
+	return 1;
+}
+
+/* compares the records received from 'start' with the expected sizes for writing 'length' bytes */
+static int check_records(size_t *start, size_t length, size_t sent, const char *name) {
+	int success = 1;
+	while (length > 0) {
+		size_t expected = sent < RECORD_THRESHOLD ? RECORD_SMALL : 16384;
+		if (expected > length)
+			expected = length;
+
+		if (*start >= record_count || records[*start] != expected) {
+			printf("\x1B[31m%s: record %zu should be %zu bytes, but is %zu bytes\x1B[0m\n", name, *start, expected, *start < record_count ? records[*start] : 0);
+			success = 0;
+		}
+
+		*start += 1;
+		sent += expected;
+		length -= expected;
+	}
+	return success;
+}
+
+int main(void) {
+	GLOBAL_SETTING_read_timeout = 200;
+	GLOBAL_SETTINGS_log_tls_errors = 1;
+
+	if (!write_key_and_cert()) {
+		fputs("\x1B[31mError: Failed to generate the certificate\x1B[0m\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	secure_cert_t cert;
+	memset(&cert, 0, sizeof(cert));
+	strcpy(cert.cert, cert_file);
+	strcpy(cert.key, key_file);
+
+	secure_config_t sconfig;
+	memset(&sconfig, 0, sizeof(sconfig));
+	sconfig.certs = &cert;
+	sconfig.cert_count = 1;
+	sconfig.min_protocol_version = PROTOCOL_NULL;
+	sconfig.record_size_small = RECORD_SMALL;
+	sconfig.record_boost_threshold = RECORD_THRESHOLD;
+	sconfig.record_idle_timeout = RECORD_IDLE;
+
+	int result = tls_setup(&sconfig);
+	unlink(cert_file);
+	unlink(key_file);
+	if (!result) {
+		fputs("\x1B[31mError: tls_setup failed\x1B[0m\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	int sockets[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == -1) {
+		perror("socketpair");
+		return EXIT_FAILURE;
+	}
+
+	/* like src/client.c does */
+	fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, server_thread, &sockets[0]);
+
+	SSL_CTX *ctx = SSL_CTX_new(TLS_client_method());
+	SSL_CTX_set_max_proto_version(ctx, TLS1_2_VERSION);
+	SSL_CTX_set_cipher_list(ctx, "ECDHE-RSA-AES128-GCM-SHA256");
+	SSL_CTX_set_msg_callback(ctx, msg_callback);
+	SSL *ssl = SSL_new(ctx);
+	SSL_set_fd(ssl, sockets[1]);
+
+	int success = SSL_connect(ssl) == 1
+		&& read_all(ssl, WRITE_FIRST)
+		&& read_all(ssl, WRITE_SECOND);
+	if (!success) {
+		ERR_print_errors_fp(stderr);
+		fputs("\x1B[31mError: Client failed to read the data\x1B[0m\n", stderr);
+	}
+
+	pthread_join(thread, NULL);
+	SSL_free(ssl);
+	SSL_CTX_free(ctx);
+	close(sockets[1]);
+	tls_destroy();
+
+	size_t position = 0;
+	success = success
+		& check_records(&position, WRITE_FIRST, 0, "New connection")
+		& check_records(&position, WRITE_SECOND, 0, "After idle");
+	if (position != record_count) {
+		printf("\x1B[31mReceived %zu records, expected %zu\x1B[0m\n", record_count, position);
+		success = 0;
+	}
+
+	printf("%s\x1B[0m (%zu records)\n", success ? "\x1B[32mPassed" : "\x1B[31mFailed", record_count);
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
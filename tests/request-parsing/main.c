@@ -0,0 +1,230 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * A benchmark of HTTP/1.1 request parsing: the old parser, which reads the
+ * request byte by byte from the transport (http_parse_method, io_read_until
+ * and http_parse_headers), is compared to the incremental parser in
+ * http/request_parser.h. Both get a typical browser request from a transport
+ * that reads from memory, so only the parsing is measured.
+ *
+ * Before the benchmark, the incremental parser is checked with the request
+ * split at every offset, as if it arrived in two reads.
+ *
+ * Usage: ./testbin [-n iterations]
+ * Build with 'make AVX2=1' to scan with AVX2 instead of SSE2.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "http/header_list.h"
+#include "http/parser.h"
+#include "http/request_parser.h"
+#include "transport/transport.h"
+#include "utils/io.h"
+
+static const char request[] =
+	"GET /assets/css/main.css?v=20200612 HTTP/1.1\r\n"
+	"Host: sub.thewoosh.me\r\n"
+	"User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:78.0) Gecko/20100101 Firefox/78.0\r\n"
+	"Accept: text/css,*/*;q=0.1\r\n"
+	"Accept-Language: en-US,en;q=0.5\r\n"
+	"Accept-Encoding: gzip, deflate, br\r\n"
+	"Connection: keep-alive\r\n"
+	"Referer: https://sub.thewoosh.me/\r\n"
+	"Cookie: session=4f6a2c9e1b7d4e03a8c1f2e5d6b7a890; theme=dark\r\n"
+	"If-Modified-Since: Fri, 12 Jun 2020 10:32:01 GMT\r\n"
+	"Cache-Control: max-age=0\r\n"
+	"TE: Trailers\r\n"
+	"\r\n";
+
+#define REQUEST_LENGTH (sizeof(request) - 1)
+
+/* the transport reads from 'request' */
+static size_t memory_position;
+
+static int memory_read(transport_t *transport, char *buffer, size_t length) {
+	if (memory_position == REQUEST_LENGTH)
+		return 0;
+	if (length > REQUEST_LENGTH - memory_position)
+		length = REQUEST_LENGTH - memory_position;
+	memcpy(buffer, request + memory_position, length);
+	memory_position += length;
+	return length;
+}
+
+static int memory_write(transport_t *transport, const char *buffer, size_t length) {
+	return 1;
+}
+
+static void memory_close(transport_t *transport) {
+	/* nothing to destroy */
+}
+
+static transport_protocol_t memory_get_protocol(transport_t *transport) {
+	return TRANSPORT_PROTOCOL_HTTP1;
+}
+
+static const transport_ops_t memory_ops = {
+	"memory",
+	memory_read,
+	memory_write,
+	memory_close,
+	memory_get_protocol,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* (boolean) the old way, see the history of http1_handle */
+static int parse_old(transport_t *transport) {
+	char method[HTTP1_LONGEST_METHOD];
+	char path[HTTP_PATH_MAX];
+	char version[HTTP_VERSION_MAX];
+
+	memory_position = 0;
+	if (!http_parse_method(transport, method, HTTP1_LONGEST_METHOD)
+		|| io_read_until(transport, path, ' ', HTTP_PATH_MAX) < 0
+		|| io_read_until(transport, version, '\n', HTTP_VERSION_MAX) < 0)
+		return 0;
+
+	http_header_list_t *headers = http_create_header_list();
+	int success = headers && http_parse_headers(transport, headers) == HTTP_PARSER_ERROR_NONE;
+	if (headers)
+		http_destroy_header_list(headers);
+	return success;
+}
+
+/* (boolean) the parser itself, without the header list */
+static int parse_only(http1_parser_t *parser, char *buffer) {
+	memcpy(buffer, request, REQUEST_LENGTH);
+	http1_parser_reset(parser);
+	if (http1_parser_parse(parser, buffer, REQUEST_LENGTH) != HTTP1_PARSE_COMPLETE)
+		return 0;
+	http1_parser_terminate(parser, buffer);
+	return 1;
+}
+
+/* (boolean) the way http1_handle parses, with the request in one read */
+static int parse_new(char *buffer) {
+	http1_parser_t parser;
+	if (!parse_only(&parser, buffer))
+		return 0;
+
+	http_header_list_t *headers = http_create_header_list();
+	int success = headers
+		&& http_header_list_add(headers, ":method", buffer + parser.method.start, HTTP_HEADER_CACHED, 0)
+		&& http_header_list_add(headers, ":path", buffer + parser.path.start, HTTP_HEADER_CACHED, 0);
+	size_t i;
+	for (i = 0; i < parser.header_count && success; i++)
+		success = http_header_list_add(headers, buffer + parser.headers[i].name.start,
+			buffer + parser.headers[i].value.start, HTTP_HEADER_CACHED, 0);
+	if (headers)
+		http_destroy_header_list(headers);
+	return success;
+}
+
+static int slice_equals(const http1_slice_t *a, const http1_slice_t *b) {
+	return a->start == b->start && a->length == b->length;
+}
+
+/* (boolean) the result must be the same wherever the request is split */
+static int check_split(void) {
+	http1_parser_t expected, parser;
+	http1_parser_reset(&expected);
+	if (http1_parser_parse(&expected, request, REQUEST_LENGTH) != HTTP1_PARSE_COMPLETE
+		|| expected.length != REQUEST_LENGTH || expected.header_count != 11) {
+		puts("\x1B[31mThe request isn't parsed correctly in one read\x1B[0m");
+		return 0;
+	}
+
+	size_t split, i;
+	for (split = 0; split < REQUEST_LENGTH; split++) {
+		http1_parser_reset(&parser);
+		int success = http1_parser_parse(&parser, request, split) == HTTP1_PARSE_INCOMPLETE
+			&& http1_parser_parse(&parser, request, REQUEST_LENGTH) == HTTP1_PARSE_COMPLETE
+			&& parser.length == expected.length
+			&& parser.header_count == expected.header_count
+			&& slice_equals(&parser.method, &expected.method)
+			&& slice_equals(&parser.path, &expected.path)
+			&& slice_equals(&parser.version, &expected.version);
+		for (i = 0; i < parser.header_count && success; i++)
+			success = slice_equals(&parser.headers[i].name, &expected.headers[i].name)
+				&& slice_equals(&parser.headers[i].value, &expected.headers[i].value);
+		if (!success) {
+			printf("\x1B[31mThe request is parsed differently when split at %zu\x1B[0m\n", split);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int main(int argc, char **argv) {
+	size_t count = 200000, i;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		count = strtoul(optarg, NULL, 10);
+	}
+
+	http_parser_setup();
+	if (!check_split())
+		return EXIT_FAILURE;
+	printf("Split check: \x1B[32mpassed\x1B[0m (%zu offsets)\n", REQUEST_LENGTH);
+
+	transport_t transport;
+	memset(&transport, 0, sizeof(transport));
+	transport.ops = &memory_ops;
+	char buffer[HTTP1_REQUEST_HEAD_MAX];
+
+	/* io_read_until prints when it fails, so a failure is detected once */
+	if (!parse_old(&transport) || !parse_new(buffer)) {
+		puts("\x1B[31mFailed to parse the request\x1B[0m");
+		return EXIT_FAILURE;
+	}
+
+	double start = time_now();
+	for (i = 0; i < count; i++)
+		parse_old(&transport);
+	double old_time = (time_now() - start) / count;
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		parse_new(buffer);
+	double new_time = (time_now() - start) / count;
+
+	http1_parser_t parser;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		parse_only(&parser, buffer);
+	double parser_time = (time_now() - start) / count;
+
+	printf("Request: %zu bytes, %zu iterations\n", REQUEST_LENGTH, count);
+	printf("  old (byte-wise reads)     %8.1f ns/request  %6.2f bytes/ns\n", old_time, REQUEST_LENGTH / old_time);
+	printf("  incremental (%-6s)      %8.1f ns/request  %6.2f bytes/ns\n",
+#if defined(__AVX2__)
+		"AVX2",
+#elif defined(__SSE2__)
+		"SSE2",
+#else
+		"scalar",
+#endif
+		new_time, REQUEST_LENGTH / new_time);
+	printf("    of which the parser     %8.1f ns/request  %6.2f bytes/ns\n", parser_time, REQUEST_LENGTH / parser_time);
+	return EXIT_SUCCESS;
+}
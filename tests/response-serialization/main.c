@@ -0,0 +1,377 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * A benchmark of HTTP/1.1 response serialization: the old way, which
+ * allocates and writes every header line separately (see the history of
+ * http1_write_response), is compared to http1_serialize_head followed by one
+ * transport_writev of the head and the body. The response is a typical
+ * response of the file server.
+ *
+ * Both are measured with a transport that copies into memory, so only the
+ * serialization is measured, and with a cleartext transport over a socket
+ * pair, so the cost of the system calls is included.
+ *
+ * The fixed responses are measured too: an error response the old way of
+ * http_handle_error_gracefully (formatted on every use), and the 404 of the
+ * file server serialized for HTTP/1.1 and HPACK-encoded for HTTP/2, against
+ * the prebuilt images of prebuilt_response.h.
+ *
+ * Usage: ./testbin [-n iterations]
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+
+#include "base/global_settings.h"
+#include "http/response_headers.h"
+#include "http/prebuilt_response.h"
+#include "http/response_serializer.h"
+#include "http2/hpack.h"
+#include "transport/transport.h"
+
+static const char body[] = "<!DOCTYPE html><html><head><title>wss</title></head><body><h1>hello</h1></body></html>\n";
+
+/* the transport copies into 'sink' */
+static char sink[65536];
+static size_t sink_length;
+static size_t write_calls;
+
+static int memory_read(transport_t *transport, char *buffer, size_t length) {
+	return 0;
+}
+
+static int memory_write(transport_t *transport, const char *buffer, size_t length) {
+	if (sink_length + length > sizeof(sink))
+		sink_length = 0;
+	memcpy(sink + sink_length, buffer, length);
+	sink_length += length;
+	write_calls += 1;
+	return 1;
+}
+
+static int memory_writev(transport_t *transport, const struct iovec *parts, int count) {
+	int i;
+	for (i = 0; i < count; i++) {
+		if (sink_length + parts[i].iov_len > sizeof(sink))
+			sink_length = 0;
+		memcpy(sink + sink_length, parts[i].iov_base, parts[i].iov_len);
+		sink_length += parts[i].iov_len;
+	}
+	write_calls += 1;
+	return 1;
+}
+
+static void memory_close(transport_t *transport) {
+	/* nothing to destroy */
+}
+
+static transport_protocol_t memory_get_protocol(transport_t *transport) {
+	return TRANSPORT_PROTOCOL_HTTP1;
+}
+
+static const transport_ops_t memory_ops = {
+	"memory",
+	memory_read,
+	memory_write,
+	memory_close,
+	memory_get_protocol,
+	NULL,
+	NULL,
+	NULL,
+	memory_writev
+};
+
+static double time_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* (boolean) the headers of the file server, the configured ones with or without their values */
+static int add_headers(http_response_headers_t *headers, int configured_values) {
+	return http_response_headers_add(headers, HTTP_RH_STATUS_200, NULL)
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_LENGTH, "88")
+		&& http_response_headers_add(headers, HTTP_RH_LAST_MODIFIED, "Fri, 12 Jun 2020 10:32:01 +0000")
+		&& http_response_headers_add(headers, HTTP_RH_DATE, "Sat, 13 Jun 2020 14:02:45 +0000")
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_TYPE, "text/html;charset=utf-8")
+		&& http_response_headers_add(headers, HTTP_RH_SERVER, configured_values ? GLOBAL_SETTING_server_name : NULL)
+		&& http_response_headers_add(headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, configured_values ? GLOBAL_SETTING_HEADER_sts : NULL)
+		&& http_response_headers_add(headers, HTTP_RH_TK, configured_values ? GLOBAL_SETTING_HEADER_tk : NULL);
+}
+
+static char *compose_header_line(size_t *sbuffer, unsigned name, const char *value) {
+	const char *key = http_rhnames[name];
+	size_t skey = strlen(key);
+	size_t svalue = strlen(value);
+	*sbuffer = skey + svalue + 2;
+	char *buffer = malloc(*sbuffer * sizeof(char));
+	memcpy(buffer, key, skey);
+	memcpy(buffer + skey, value, svalue);
+	buffer[skey + svalue] = '\r';
+	buffer[skey + svalue+1] = '\n';
+	return buffer;
+}
+
+/* (boolean) the old way: a line at a time */
+static int write_old(transport_t *transport, http_response_headers_t *headers) {
+	size_t i;
+	for (i = 0; i < headers->count; i++) {
+		http_response_header_t *header = headers->headers[i];
+		if (header->name >= HTTP_RH_STATUSES) {
+			size_t sbuffer;
+			char *buffer = compose_header_line(&sbuffer, header->name, header->value);
+			transport_write(transport, buffer, sbuffer);
+			free(buffer);
+		} else {
+			const char *line = http_rhnames[header->name];
+			transport_write(transport, line, strlen(line));
+		}
+	}
+	return transport_write(transport, "\r\n", 2)
+		&& transport_write(transport, body, sizeof(body) - 1);
+}
+
+/* (boolean) the way http1_write_response writes */
+static int write_new(transport_t *transport, http_response_headers_t *headers) {
+	char buffer[HTTP1_RESPONSE_HEAD_SIZE];
+	size_t length = http1_serialize_head(buffer, sizeof(buffer), headers, 0, 0);
+	if (length > sizeof(buffer))
+		return 0;
+
+	struct iovec parts[2];
+	parts[0].iov_base = buffer;
+	parts[0].iov_len = length;
+	parts[1].iov_base = (char *) body;
+	parts[1].iov_len = sizeof(body) - 1;
+	return transport_writev(transport, parts, 2);
+}
+
+static const char error_body[] = "<h1>Your browser has sent a malformed request.</h1><hr><p>We can't understand the <b>headers</b> your browser sent us.</p>";
+
+/* (boolean) the old http_handle_error_gracefully */
+static int write_old_error(transport_t *transport) {
+	const char *format = "HTTP/1.1 %s\r\nStrict-Transport-Security: max-age=31536000; includeSubDomains; preload\r\nConnection: %s\r\nDate: %s\r\nAllow: %s\r\nServer: %s\r\nContent-Length: %s\r\n\r\n";
+	size_t argument_chars = 10;
+
+	/* like the old get_date, the date is allocated */
+	char *date = malloc(HTTP_DATE_LENGTH + 1);
+	http_date_write(date, time(NULL));
+	date[HTTP_DATE_LENGTH] = 0;
+
+	size_t body_size = strlen(error_body);
+	FILE *null_fp = fopen("/dev/null", "w");
+	char *content_length = malloc(fprintf(null_fp, "%zi", body_size) + 1);
+	fclose(null_fp);
+	sprintf(content_length, "%zi", body_size);
+
+	size_t response_size = strlen(format) - argument_chars + strlen("400 Bad Request") + strlen("close")
+		+ strlen(date) + strlen(GLOBAL_SETTING_server_name) + strlen("GET") + strlen(content_length);
+	char *buffer = malloc(response_size + body_size + 1);
+	snprintf(buffer, response_size + 1, format, "400 Bad Request", "close", date, "GET", GLOBAL_SETTING_server_name, content_length);
+	memcpy(buffer + response_size, error_body, body_size);
+	int success = transport_write(transport, buffer, response_size + body_size);
+	free(buffer);
+	free(content_length);
+	free(date);
+	return success;
+}
+
+/* (boolean) the headers of a fixed response, without a Date */
+static int add_fixed_headers(http_response_headers_t *headers, http_response_header_name status, const char *length) {
+	return http_response_headers_add(headers, status, NULL)
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_TYPE, "text/html; charset=UTF-8")
+		&& http_response_headers_add(headers, HTTP_RH_CONTENT_LENGTH, length)
+		&& http_response_headers_add(headers, HTTP_RH_SERVER, NULL)
+		&& http_response_headers_add(headers, HTTP_RH_STRICT_TRANSPORT_SECURITY, NULL)
+		&& http_response_headers_add(headers, HTTP_RH_TK, NULL);
+}
+
+/* the time per response in nanoseconds of the fixed responses, see the description */
+static void benchmark_fixed(transport_t *transport, size_t count) {
+	size_t i, sum = 0;
+	double start, old_time, new_time;
+	char length[32];
+	http_response_headers_t *error_headers = http_create_response_headers(10);
+	http_response_headers_t *prebuilt_headers = http_create_response_headers(10);
+	http_response_headers_t *headers = http_create_response_headers(10);
+	http_prebuilt_response_t *error = NULL, *prebuilt = NULL;
+	sprintf(length, "%zu", sizeof(error_body) - 1);
+	if (!error_headers || !prebuilt_headers || !headers || !add_fixed_headers(error_headers, HTTP_RH_STATUS_400, length)
+		|| !(error = http_prebuilt_response_create(error_headers, error_body, sizeof(error_body) - 1))) {
+		puts("\x1B[31mFailed to set up the fixed responses\x1B[0m");
+		goto end;
+	}
+	sprintf(length, "%zu", sizeof(body) - 1);
+	if (!add_fixed_headers(prebuilt_headers, HTTP_RH_STATUS_404, length) || !add_fixed_headers(headers, HTTP_RH_STATUS_404, length)
+		|| !http_response_headers_add(headers, HTTP_RH_DATE, "Sat, 13 Jun 2020 14:02:45 GMT")
+		|| !(prebuilt = http_prebuilt_response_create(prebuilt_headers, body, sizeof(body) - 1))) {
+		puts("\x1B[31mFailed to set up the fixed responses\x1B[0m");
+		goto end;
+	}
+
+	printf("  fixed responses (memory transport)\n");
+	start = time_now();
+	for (i = 0; i < count; i++)
+		write_old_error(transport);
+	old_time = (time_now() - start) / count;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		http1_write_prebuilt(transport, error, 0, 1);
+	new_time = (time_now() - start) / count;
+	printf("    error, formatted        %8.1f ns/response\n", old_time);
+	printf("    error, prebuilt         %8.1f ns/response\n", new_time);
+
+	start = time_now();
+	for (i = 0; i < count; i++)
+		write_new(transport, headers);
+	old_time = (time_now() - start) / count;
+	start = time_now();
+	for (i = 0; i < count; i++)
+		http1_write_prebuilt(transport, prebuilt, 0, 0);
+	new_time = (time_now() - start) / count;
+	printf("    404 HTTP/1.1, serialized%8.1f ns/response\n", old_time);
+	printf("    404 HTTP/1.1, prebuilt  %8.1f ns/response\n", new_time);
+
+	char block[1024];
+	start = time_now();
+	for (i = 0; i < count; i++) {
+		size_t size;
+		char *encoded = write_headers(headers, &size);
+		sum += encoded[size - 1];
+		free(encoded);
+	}
+	old_time = (time_now() - start) / count;
+	start = time_now();
+	for (i = 0; i < count; i++) {
+		http2_copy_prebuilt(block, prebuilt);
+		sum += block[prebuilt->hpack_length - 1];
+	}
+	new_time = (time_now() - start) / count;
+	printf("    404 HPACK, encoded      %8.1f ns/response\n", old_time);
+	printf("    404 HPACK, prebuilt     %8.1f ns/response   (%zu)\n", new_time, sum & 1);
+
+	end:
+	http_prebuilt_response_destroy(error);
+	http_prebuilt_response_destroy(prebuilt);
+	if (error_headers)
+		http_response_headers_destroy(error_headers);
+	if (prebuilt_headers)
+		http_response_headers_destroy(prebuilt_headers);
+	if (headers)
+		http_response_headers_destroy(headers);
+}
+
+/* reads the other end of the socket pair until it is closed */
+static void *drain_thread(void *arg) {
+	int socket = *(int *) arg;
+	char buffer[65536];
+	while (read(socket, buffer, sizeof(buffer)) > 0) {
+		/* discarding */
+	}
+	return NULL;
+}
+
+/* the time per response in nanoseconds, and the writes per response */
+static double benchmark(transport_t *transport, http_response_headers_t *headers, int new, size_t count, double *writes) {
+	size_t i;
+	write_calls = 0;
+	double start = time_now();
+	for (i = 0; i < count; i++)
+		if (!(new ? write_new(transport, headers) : write_old(transport, headers)))
+			return -1;
+	*writes = (double) write_calls / count;
+	return (time_now() - start) / count;
+}
+
+/* (boolean) both ways must produce the same bytes */
+static int check_equal(transport_t *transport, http_response_headers_t *old_headers, http_response_headers_t *new_headers) {
+	char expected[4096];
+	size_t expected_length;
+
+	sink_length = 0;
+	write_old(transport, old_headers);
+	expected_length = sink_length;
+	memcpy(expected, sink, expected_length);
+
+	sink_length = 0;
+	write_new(transport, new_headers);
+	return sink_length == expected_length && !memcmp(expected, sink, expected_length);
+}
+
+int main(int argc, char **argv) {
+	size_t count = 200000;
+	int option;
+	while ((option = getopt(argc, argv, "n:")) != -1) {
+		if (option != 'n') {
+			fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		count = strtoul(optarg, NULL, 10);
+	}
+
+	GLOBAL_SETTING_read_timeout = 1000;
+	GLOBAL_SETTING_server_name = "wss";
+	GLOBAL_SETTING_HEADER_sts = "max-age=63072000; includeSubDomains; preload";
+	GLOBAL_SETTING_HEADER_tk = "N";
+
+	http_response_headers_t *old_headers = http_create_response_headers(10);
+	http_response_headers_t *new_headers = http_create_response_headers(10);
+	if (!old_headers || !new_headers || !add_headers(old_headers, 1) || !add_headers(new_headers, 0)
+		|| !http1_serializer_setup()) {
+		puts("\x1B[31mFailed to set up the response\x1B[0m");
+		return EXIT_FAILURE;
+	}
+
+	transport_t memory;
+	memset(&memory, 0, sizeof(memory));
+	memory.ops = &memory_ops;
+	if (!check_equal(&memory, old_headers, new_headers)) {
+		puts("\x1B[31mThe serialized response differs from the old one\x1B[0m");
+		return EXIT_FAILURE;
+	}
+	printf("Response: %zu bytes (head %zu, body %zu), %zu iterations\n",
+		sink_length, sink_length - (sizeof(body) - 1), sizeof(body) - 1, count);
+
+	double old_writes, new_writes;
+	double old_time = benchmark(&memory, old_headers, 0, count, &old_writes);
+	double new_time = benchmark(&memory, new_headers, 1, count, &new_writes);
+	printf("  memory transport\n");
+	printf("    old (line by line)      %8.1f ns/response  %4.1f writes/response\n", old_time, old_writes);
+	printf("    serialized + writev     %8.1f ns/response  %4.1f writes/response\n", new_time, new_writes);
+	benchmark_fixed(&memory, count);
+
+	int sockets[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == -1) {
+		perror("socketpair");
+		return EXIT_FAILURE;
+	}
+	pthread_t thread;
+	pthread_create(&thread, NULL, drain_thread, &sockets[1]);
+	transport_t *cleartext = transport_create_cleartext(sockets[0]);
+	if (!cleartext)
+		return EXIT_FAILURE;
+
+	/* the writes aren't counted by this transport */
+	old_time = benchmark(cleartext, old_headers, 0, count, &old_writes);
+	new_time = benchmark(cleartext, new_headers, 1, count, &new_writes);
+	printf("  cleartext transport (socket pair)\n");
+	printf("    old (line by line)      %8.1f ns/response\n", old_time);
+	printf("    serialized + writev     %8.1f ns/response\n", new_time);
+
+	transport_destroy(cleartext);
+	close(sockets[0]);
+	pthread_join(thread, NULL);
+	close(sockets[1]);
+
+	http_response_headers_destroy(old_headers);
+	http_response_headers_destroy(new_headers);
+	http1_serializer_destroy();
+	return old_time < 0 || new_time < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Generates the state machine of the HPACK Huffman decoder (see
+ * http2/huffman.c) from the codes in http2/huffman_table.h. The decoder reads
+ * four bits at a time: a state is a node of the Huffman tree, the position in
+ * a code that hasn't ended yet, and for every state and every nibble the
+ * table has the next state and the symbol that was completed, if any. Since
+ * the shortest code has five bits, a nibble completes at most one symbol.
+ *
+ * Usage: huffman-fsm output
+ *
+ * The output is a header that defines:
+ *
+ *   huffman_fsm_entry_t       a transition
+ *   HUFFMAN_FSM_ACCEPT        the string may end after the transition: the
+ *                             bits of the unfinished code are at most 7 ones,
+ *                             the padding of RFC 7541 Section 5.2
+ *   HUFFMAN_FSM_SYMBOL        the transition completes 'symbol'
+ *   HUFFMAN_FSM_FAIL          the transition completes EOS, which is an error
+ *   huffman_fsm[256][16]      the transitions, state 0 is the root
+ *
+ * The output only depends on the codes, so a regenerated table is the same.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "http2/huffman_table.h"
+
+#define SYMBOLS 257
+#define EOS 256
+/* a tree with 257 leaves has 256 internal nodes */
+#define STATES 256
+
+typedef struct {
+	/* the children, an internal node or -1 - symbol for a leaf */
+	int children[2];
+	/* the depth in the tree */
+	int depth;
+	/* (boolean) the bits on the way to the node are all ones */
+	int ones;
+} node_t;
+
+static node_t nodes[STATES];
+static int node_count = 1;
+
+/* (boolean) adds the code of the symbol to the tree */
+static int add_code(int symbol) {
+	int node = 0;
+	int i;
+	for (i = http2_huffman_code_lengths[symbol] - 1; i >= 0; i--) {
+		int bit = (http2_huffman_codes[symbol] >> i) & 1;
+		int *child = &nodes[node].children[bit];
+		if (i == 0) {
+			if (*child != 0)
+				return 0;
+			*child = -1 - symbol;
+			return 1;
+		}
+		if (*child < 0)
+			return 0;
+		if (*child == 0) {
+			if (node_count == STATES)
+				return 0;
+			nodes[node_count].depth = nodes[node].depth + 1;
+			nodes[node_count].ones = nodes[node].ones && bit;
+			*child = node_count++;
+		}
+		node = *child;
+	}
+	return 0;
+}
+
+/* writes the transition of 'state' for 'nibble' */
+static void write_transition(FILE *file, int state, int nibble) {
+	int node = state;
+	int symbol = -1;
+	int fail = 0;
+	int i;
+	for (i = 3; i >= 0; i--) {
+		int child = nodes[node].children[(nibble >> i) & 1];
+		if (child >= 0) {
+			node = child;
+			continue;
+		}
+		if (-1 - child == EOS)
+			fail = 1;
+		else
+			symbol = -1 - child;
+		node = 0;
+	}
+
+	int accept = !fail && (node == 0 || (nodes[node].ones && nodes[node].depth <= 7));
+	fprintf(file, "{ %d, %s, %d }", fail ? 0 : node,
+			fail ? "HUFFMAN_FSM_FAIL" : symbol >= 0 ? (accept ? "HUFFMAN_FSM_SYMBOL | HUFFMAN_FSM_ACCEPT" : "HUFFMAN_FSM_SYMBOL")
+			: (accept ? "HUFFMAN_FSM_ACCEPT" : "0"),
+			symbol >= 0 && !fail ? symbol : 0);
+}
+
+int main(int argc, char **argv) {
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s output\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	nodes[0].ones = 1;
+	int symbol;
+	for (symbol = 0; symbol < SYMBOLS; symbol++) {
+		if (!add_code(symbol)) {
+			fprintf(stderr, "The code of symbol %d isn't a prefix code\n", symbol);
+			return EXIT_FAILURE;
+		}
+	}
+	int state;
+	for (state = 0; state < node_count; state++) {
+		if (nodes[state].children[0] == 0 || nodes[state].children[1] == 0) {
+			fprintf(stderr, "The codes don't form a complete tree\n");
+			return EXIT_FAILURE;
+		}
+	}
+	if (node_count != STATES) {
+		fprintf(stderr, "The tree has %d instead of %d states\n", node_count, STATES);
+		return EXIT_FAILURE;
+	}
+
+	FILE *file = fopen(argv[1], "w");
+	if (!file) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	fputs("/**\n * Generated by tools/huffman-fsm.c from src/http2/huffman_table.h, don't edit.\n */\n", file);
+	fputs("#ifndef HTTP2_HUFFMAN_FSM_H\n#define HTTP2_HUFFMAN_FSM_H\n\n#include <stdint.h>\n\n", file);
+	fputs("#define HUFFMAN_FSM_ACCEPT 0x1\n#define HUFFMAN_FSM_SYMBOL 0x2\n#define HUFFMAN_FSM_FAIL 0x4\n\n", file);
+	fputs("typedef struct {\n\tuint8_t state;\n\tuint8_t flags;\n\tuint8_t symbol;\n} huffman_fsm_entry_t;\n\n", file);
+	fprintf(file, "static const huffman_fsm_entry_t huffman_fsm[%d][16] = {\n", STATES);
+	for (state = 0; state < STATES; state++) {
+		fprintf(file, "\t/* %d */\n\t{\n", state);
+		int nibble;
+		for (nibble = 0; nibble < 16; nibble++) {
+			fputs("\t\t", file);
+			write_transition(file, state, nibble);
+			fputs(nibble < 15 ? ",\n" : "\n", file);
+		}
+		fputs(state < STATES - 1 ? "\t},\n" : "\t}\n", file);
+	}
+	fputs("};\n\n#endif /* HTTP2_HUFFMAN_FSM_H */\n", file);
+
+	if (fclose(file)) {
+		perror(argv[1]);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,330 @@
+/**
+ * Copyright (C) 2020 Tristan
+ * For conditions of distribution and use, see copyright notice in the COPYING file.
+ *
+ * Generates a lookup table for a fixed vocabulary: the words get a slot
+ * each (a perfect hash, see utils/perfect_hash.h), and the lookup function
+ * is a switch over the slots, so a word is hashed once and compared to one
+ * candidate.
+ *
+ * Usage: perfect-hash [-i] prefix input output
+ *
+ * Every line of the input is a word, optionally followed by whitespace and a
+ * value. Empty lines and lines starting with '#' are skipped. With '-i' the
+ * words are matched case-insensitively. 'output'.h declares:
+ *
+ *   PREFIX_COUNT            the amount of words
+ *   PREFIX_WORD             the index of every word, e.g. HTTP_METHOD_GET
+ *   prefix_words[]          the words, in the order of the input
+ *   prefix_values[]         the values, if any line has one
+ *   prefix_lookup(w, l)     the index of the word, or -1
+ *
+ * and 'output'.c defines them.
+ *
+ * The output only depends on the input, so a regenerated table is the same.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "utils/perfect_hash.c"
+
+#define WORDS_MAX 1024
+#define LINE_MAX_LENGTH 512
+#define NAME_MAX_LENGTH 128
+#define PATH_MAX_LENGTH 1024
+/* the seeds that are tried for a table size, before the size is doubled */
+#define SEEDS_PER_SIZE (1UL << 20)
+
+typedef struct {
+	char *word;
+	size_t length;
+	/* (nullable) */
+	char *value;
+} entry_t;
+
+static entry_t entries[WORDS_MAX];
+static size_t count;
+static int fold_case;
+
+/* (boolean) reads the vocabulary */
+static int read_input(const char *path) {
+	FILE *file = fopen(path, "r");
+	if (!file) {
+		perror(path);
+		return 0;
+	}
+
+	char line[LINE_MAX_LENGTH];
+	size_t number = 0;
+	while (fgets(line, sizeof(line), file)) {
+		number++;
+		size_t length = strcspn(line, "\r\n");
+		line[length] = 0;
+		if (length == 0 || line[0] == '#')
+			continue;
+		if (count == WORDS_MAX) {
+			fprintf(stderr, "%s: more than %d words\n", path, WORDS_MAX);
+			fclose(file);
+			return 0;
+		}
+
+		entry_t *entry = &entries[count];
+		entry->length = strcspn(line, " \t");
+		char *value = line + entry->length;
+		value += strspn(value, " \t");
+
+		entry->word = malloc(entry->length + 1);
+		entry->value = *value ? malloc(strlen(value) + 1) : NULL;
+		if (!entry->word || (*value && !entry->value)) {
+			fclose(file);
+			return 0;
+		}
+		memcpy(entry->word, line, entry->length);
+		entry->word[entry->length] = 0;
+		if (entry->value)
+			strcpy(entry->value, value);
+
+		size_t i;
+		if (fold_case)
+			for (i = 0; i < entry->length; i++)
+				if (entry->word[i] >= 'A' && entry->word[i] <= 'Z')
+					entry->word[i] |= 0x20;
+		for (i = 0; i < count; i++) {
+			if (entries[i].length == entry->length && !memcmp(entries[i].word, entry->word, entry->length)) {
+				fprintf(stderr, "%s:%zu: duplicate word '%s'\n", path, number, entry->word);
+				fclose(file);
+				return 0;
+			}
+		}
+		count++;
+	}
+
+	fclose(file);
+	if (count == 0) {
+		fprintf(stderr, "%s: no words\n", path);
+		return 0;
+	}
+	return 1;
+}
+
+/* (boolean) every word gets its own slot with this seed */
+static int try_seed(unsigned long seed, unsigned long mask, long *slots) {
+	size_t i;
+	for (i = 0; i <= mask; i++)
+		slots[i] = -1;
+	for (i = 0; i < count; i++) {
+		unsigned long slot = perfect_hash(entries[i].word, entries[i].length, seed, fold_case) & mask;
+		if (slots[slot] != -1)
+			return 0;
+		slots[slot] = i;
+	}
+	return 1;
+}
+
+/* writes a string literal */
+static void write_string(FILE *file, const char *string) {
+	fputc('"', file);
+	for (; *string; string++) {
+		if (*string == '"' || *string == '\\')
+			fputc('\\', file);
+		fputc(*string, file);
+	}
+	fputc('"', file);
+}
+
+/* the name of the constant of a word: the prefix and the word in uppercase,
+ * other characters than letters and digits become '_' (leading ones are skipped) */
+static void constant_name(char *name, size_t size, const char *upper, const char *word) {
+	size_t length = strlen(upper);
+	while (*word && !isalnum((unsigned char) *word))
+		word++;
+	memcpy(name, upper, length);
+	name[length++] = '_';
+	for (; *word && length < size - 1; word++)
+		name[length++] = isalnum((unsigned char) *word) ? toupper((unsigned char) *word) : '_';
+	name[length] = 0;
+}
+
+/* writes the constants, declarations and the documentation */
+static void write_header(FILE *file, const char *prefix, const char *upper, const char *input, int values) {
+	char name[NAME_MAX_LENGTH];
+	size_t i, max = 0;
+	for (i = 0; i < count; i++)
+		if (entries[i].length > max)
+			max = entries[i].length;
+
+	fprintf(file, "/**\n * Generated by tools/perfect-hash.c from %s, don't edit.\n */\n", input);
+	fprintf(file, "#ifndef %s_TABLE_H\n#define %s_TABLE_H\n\n#include <stddef.h>\n\n", upper, upper);
+	fprintf(file, "#define %s_COUNT %zu\n#define %s_LENGTH_MAX %zu\n\n", upper, count, upper, max);
+	fputs("/* the indices of the words */\n", file);
+	for (i = 0; i < count; i++) {
+		constant_name(name, sizeof(name), upper, entries[i].word);
+		fprintf(file, "#define %s %zu\n", name, i);
+	}
+
+	fprintf(file, "\n/* the words, in the order of %s */\n", input);
+	fprintf(file, "extern const char *const %s_words[%s_COUNT];\n", prefix, upper);
+	if (values)
+		fprintf(file, "/* the values of the words, or NULL */\nextern const char *const %s_values[%s_COUNT];\n", prefix, upper);
+	fprintf(file, "\n/**\n * Description:\n *   Finds the word%s.\n", fold_case ? ", case-insensitively" : "");
+	fputs(" *\n * Parameters:\n *   const char *\n *     The word, it doesn't have to be null-terminated.\n", file);
+	fputs(" *   size_t\n *     The length of the word.\n *\n", file);
+	fprintf(file, " * Return Value:\n *   The index of the word in %s_words, or -1\n */\n", prefix);
+	fprintf(file, "int %s_lookup(const char *, size_t);\n\n#endif /* %s_TABLE_H */\n", prefix, upper);
+}
+
+/* writes a table of strings */
+static void write_strings(FILE *file, const char *prefix, const char *upper, const char *table, int use_values) {
+	size_t i;
+	fprintf(file, "const char *const %s_%s[%s_COUNT] = {\n", prefix, table, upper);
+	for (i = 0; i < count; i++) {
+		const char *string = use_values ? entries[i].value : entries[i].word;
+		fputc('\t', file);
+		if (string)
+			write_string(file, string);
+		else
+			fputs("NULL", file);
+		fputs(i + 1 < count ? ",\n" : "\n", file);
+	}
+	fputs("};\n\n", file);
+}
+
+/* writes the tables and the lookup function, a switch over the slots */
+static void write_source(FILE *file, const char *prefix, const char *upper, const char *input, const char *header,
+		int values, unsigned long seed, unsigned long mask, const long *slots) {
+	size_t i, min = (size_t) -1, max = 0;
+	for (i = 0; i < count; i++) {
+		if (entries[i].length < min)
+			min = entries[i].length;
+		if (entries[i].length > max)
+			max = entries[i].length;
+	}
+
+	fprintf(file, "/**\n * Generated by tools/perfect-hash.c from %s, don't edit.\n", input);
+	fprintf(file, " * %zu words in %lu slots, seed %lu.\n */\n", count, mask + 1, seed);
+	fprintf(file, "#include \"%s\"\n\n#include <string.h>\n\n#include \"utils/perfect_hash.h\"\n\n", header);
+	write_strings(file, prefix, upper, "words", 0);
+	if (values)
+		write_strings(file, prefix, upper, "values", 1);
+
+	fprintf(file, "int %s_lookup(const char *word, size_t length) {\n", prefix);
+	fprintf(file, "\tif (length < %zu || length > %zu)\n\t\treturn -1;\n", min, max);
+	fprintf(file, "\tswitch (perfect_hash(word, length, %luUL, %d) & %luUL) {\n", seed, fold_case, mask);
+	for (i = 0; i <= mask; i++) {
+		if (slots[i] == -1)
+			continue;
+		const entry_t *entry = &entries[slots[i]];
+		fprintf(file, "\t\tcase %zu:\n\t\t\treturn length == %zu && ", i, entry->length);
+		fprintf(file, fold_case ? "perfect_hash_equal_fold(word, " : "!memcmp(word, ");
+		write_string(file, entry->word);
+		fprintf(file, ", %zu) ? %ld : -1;\n", entry->length, slots[i]);
+	}
+	fputs("\t\tdefault:\n\t\t\treturn -1;\n\t}\n}\n", file);
+}
+
+/* (boolean) writes 'output'.h and 'output'.c */
+static int write_output(const char *prefix, const char *input, const char *output, unsigned long seed, unsigned long mask, const long *slots) {
+	char upper[NAME_MAX_LENGTH], name[NAME_MAX_LENGTH], other[NAME_MAX_LENGTH];
+	char path[PATH_MAX_LENGTH];
+	size_t i, j;
+	int values = 0;
+	for (i = 0; prefix[i] && i < sizeof(upper) - 1; i++)
+		upper[i] = toupper((unsigned char) prefix[i]);
+	upper[i] = 0;
+	for (i = 0; i < count; i++)
+		values |= entries[i].value != NULL;
+
+	/* the constants must be unique as well */
+	for (i = 0; i < count; i++) {
+		constant_name(name, sizeof(name), upper, entries[i].word);
+		for (j = 0; j < i; j++) {
+			constant_name(other, sizeof(other), upper, entries[j].word);
+			if (!strcmp(name, other)) {
+				fprintf(stderr, "%s: '%s' and '%s' have the same constant %s\n", input, entries[j].word, entries[i].word, name);
+				return 0;
+			}
+		}
+	}
+
+	if (strlen(output) + 3 > sizeof(path)) {
+		fprintf(stderr, "%s: the path is too long\n", output);
+		return 0;
+	}
+	const char *header = strrchr(output, '/');
+	header = header ? header + 1 : output;
+
+	int success = 1;
+	for (i = 0; i < 2 && success; i++) {
+		sprintf(path, "%s.%c", output, i == 0 ? 'h' : 'c');
+		FILE *file = fopen(path, "w");
+		if (!file) {
+			perror(path);
+			return 0;
+		}
+		if (i == 0) {
+			write_header(file, prefix, upper, input, values);
+		} else {
+			sprintf(name, "%s.h", header);
+			write_source(file, prefix, upper, input, name, values, seed, mask, slots);
+		}
+		if (fclose(file)) {
+			perror(path);
+			success = 0;
+		}
+	}
+	return success;
+}
+
+int main(int argc, char **argv) {
+	int option;
+	while ((option = getopt(argc, argv, "i")) != -1) {
+		if (option != 'i') {
+			fprintf(stderr, "Usage: %s [-i] prefix input output\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		fold_case = 1;
+	}
+	if (argc - optind != 3) {
+		fprintf(stderr, "Usage: %s [-i] prefix input output\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	const char *prefix = argv[optind];
+	const char *input = argv[optind + 1];
+	const char *output = argv[optind + 2];
+
+	if (!read_input(input))
+		return EXIT_FAILURE;
+
+	/* the smallest power of two the words fit in */
+	unsigned long size = 1;
+	while (size < count)
+		size <<= 1;
+
+	long *slots = NULL;
+	unsigned long seed = 0;
+	int found = 0;
+	while (!found && size <= 16 * WORDS_MAX) {
+		long *resized = realloc(slots, size * sizeof(long));
+		if (!resized)
+			break;
+		slots = resized;
+		for (seed = 0; seed < SEEDS_PER_SIZE; seed++)
+			if ((found = try_seed(seed, size - 1, slots)))
+				break;
+		if (!found)
+			size <<= 1;
+	}
+	if (!found) {
+		fprintf(stderr, "%s: no perfect hash was found\n", input);
+		return EXIT_FAILURE;
+	}
+
+	int success = write_output(prefix, input, output, seed, size - 1, slots);
+	free(slots);
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}